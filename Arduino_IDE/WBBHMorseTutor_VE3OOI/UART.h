@@ -2,7 +2,7 @@
 #define _UART_H_
 
 
-#define RBUFF 40		// Max RS232 Buffer Size
+#define RBUFF 80		// Max RS232 Buffer Size (room for "W S <ssid>")
 #define MAXIMUM_DIGITS 6	// Max numerical digits to process
 #define MAX_COMMAND_ENTRIES 6 
 #define BANNER "\r\n\r\nCLI v0.1 (c)VE3OOI"
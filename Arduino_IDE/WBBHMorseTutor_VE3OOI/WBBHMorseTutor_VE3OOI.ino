@@ -113,7 +113,6 @@ following define (see mail.h)
 #include <Adafruit_GFX.h>      // Version 1.5.3
 #include <Adafruit_ILI9341.h>  // Version 1.5.6
 #include <EEPROM.h>
-#include <SD.h>
 #include <WiFi.h>
 #include <arduino.h>
 //#include <esp_now.h>
@@ -124,6 +123,28 @@ following define (see mail.h)
 #include "UART.h"
 #include "main.h"
 #include "network.h"
+#include "latency.h"
+#include "stream.h"
+#include "presence.h"
+#include "telemetry.h"
+#include "classroom.h"
+#include "webserver.h"
+#include "content.h"
+#include "reader.h"
+#include "library.h"
+#include "bookmark.h"
+#include "navindex.h"
+#include "playlist.h"
+#include "morse.h"
+#include "mrs.h"
+#include "normalize.h"
+#include "corpus.h"
+#include "storage.h"
+#include "wordlist.h"
+#include "adaptive.h"
+#include "statlog.h"
+#include "cards.h"
+#include "grammar.h"
 
 const word colors[] = {BLACK, BLUE,  NAVY,   RED,  MAROON,  GREEN,  LIME,
                        CYAN,  TEAL,  PURPLE, PINK, YELLOW,  ORANGE, BROWN,
@@ -142,127 +163,7 @@ volatile long button_downtime = 0L;  // ms the button was pushed before released
 //===================================  Morse Code Variables
 //=============================
 
-// The following is a list of the 100 most-common English words, in frequency
-// order. See: https://www.dictionary.com/e/common-words/ from The Brown Corpus
-// Standard Sample of Present-Day American English (Providence, RI: Brown
-// University Press, 1979)
-
-// Modified by VE3OOI to address converstion from *char *const
-char *words[] = {
-    (char *)"THE",   (char *)"OF",    (char *)"AND",     (char *)"TO",
-    (char *)"A",     (char *)"IN",    (char *)"THAT",    (char *)"IS",
-    (char *)"WAS",   (char *)"HE",    (char *)"FOR",     (char *)"IT",
-    (char *)"WITH",  (char *)"AS",    (char *)"HIS",     (char *)"ON",
-    (char *)"BE",    (char *)"AT",    (char *)"BY",      (char *)"I",
-    (char *)"THIS",  (char *)"HAD",   (char *)"NOT",     (char *)"ARE",
-    (char *)"BUT",   (char *)"FROM",  (char *)"OR",      (char *)"HAVE",
-    (char *)"AN",    (char *)"THEY",  (char *)"WHICH",   (char *)"ONE",
-    (char *)"YOU",   (char *)"WERE",  (char *)"ALL",     (char *)"HER",
-    (char *)"SHE",   (char *)"THERE", (char *)"WOULD",   (char *)"THEIR",
-    (char *)"WE",    (char *)"HIM",   (char *)"BEEN",    (char *)"HAS",
-    (char *)"WHEN",  (char *)"WHO",   (char *)"WILL",    (char *)"NO",
-    (char *)"MORE",  (char *)"IF",    (char *)"OUT",     (char *)"SO",
-    (char *)"UP",    (char *)"SAID",  (char *)"WHAT",    (char *)"ITS",
-    (char *)"ABOUT", (char *)"THAN",  (char *)"INTO",    (char *)"THEM",
-    (char *)"CAN",   (char *)"ONLY",  (char *)"OTHER",   (char *)"TIME",
-    (char *)"NEW",   (char *)"SOME",  (char *)"COULD",   (char *)"THESE",
-    (char *)"TWO",   (char *)"MAY",   (char *)"FIRST",   (char *)"THEN",
-    (char *)"DO",    (char *)"ANY",   (char *)"LIKE",    (char *)"MY",
-    (char *)"NOW",   (char *)"OVER",  (char *)"SUCH",    (char *)"OUR",
-    (char *)"MAN",   (char *)"ME",    (char *)"EVEN",    (char *)"MOST",
-    (char *)"MADE",  (char *)"AFTER", (char *)"ALSO",    (char *)"DID",
-    (char *)"MANY",  (char *)"OFF",   (char *)"BEFORE",  (char *)"MUST",
-    (char *)"WELL",  (char *)"BACK",  (char *)"THROUGH", (char *)"YEARS",
-    (char *)"MUCH",  (char *)"WHERE", (char *)"YOUR",    (char *)"WAY"};
-char *antenna[] = {(char *)"YAGI", (char *)"DIPOLE", (char *)"VERTICAL",
-                   (char *)"HEXBEAM", (char *)"MAGLOOP"};
-char *weather[] = {(char *)"HOT",    (char *)"SUNNY",  (char *)"WARM",
-                   (char *)"CLOUDY", (char *)"RAINY",  (char *)"COLD",
-                   (char *)"SNOWY",  (char *)"CHILLY", (char *)"WINDY",
-                   (char *)"FOGGY"};
-char *names[] = {
-    (char *)"WAYNE", (char *)"TYE",  (char *)"DARREN",   (char *)"MICHAEL",
-    (char *)"SARAH", (char *)"DOUG", (char *)"FERNANDO", (char *)"CHARLIE",
-    (char *)"HOLLY", (char *)"KEN",  (char *)"SCOTT",    (char *)"DAN",
-    (char *)"ERVIN", (char *)"GENE", (char *)"PAUL",     (char *)"VINCENT"};
-char *cities[] = {(char *)"DAYTON, OH",      (char *)"HADDONFIELD, NJ",
-                  (char *)"MURRYSVILLE, PA", (char *)"BALTIMORE, MD",
-                  (char *)"ANN ARBOR, MI",   (char *)"BOULDER, CO",
-                  (char *)"BILLINGS, MT",    (char *)"SANIBEL, FL",
-                  (char *)"CIMMARON, NM",    (char *)"TYLER, TX",
-                  (char *)"OLYMPIA, WA"};
-char *rigs[] = {(char *)"YAESU FT101", (char *)"KENWOOD 780",
-                (char *)"ELECRAFT K3", (char *)"HOMEBREW",
-                (char *)"QRPLABS QCX", (char *)"ICOM 7410",
-                (char *)"FLEX 6400"};
-char punctuation[] = "!@$&()-+=,.:;'/";
-char prefix[] = {'A', 'W', 'K', 'N'};
-char koch[] = "KMRSUAPTLOWI.NJEF0Y,VG5/Q9ZH38B?427C1D6X";
-byte morse[] = {
-    // Each character is encoded into an 8-bit byte:
-    0b01001010,  // ! exclamation
-    0b01101101,  // " quotation
-    0b01010111,  // # pound                   // No Morse, mapped to SK
-    0b10110111,  // $ dollar or ~SX
-    0b00000000,  // % percent
-    0b00111101,  // & ampersand or ~AS
-    0b01100001,  // ' apostrophe
-    0b00110010,  // ( open paren
-    0b01010010,  // ) close paren
-    0b0,         // * asterisk                // No Morse
-    0b00110101,  // + plus or ~AR
-    0b01001100,  // , comma
-    0b01011110,  // - hypen
-    0b01010101,  // . period
-    0b00110110,  // / slant
-    0b00100000,  // 0                         // Read the bits from RIGHT to
-                 // left,
-    0b00100001,  // 1                         // with a "1"=dit and "0"=dah
-    0b00100011,  // 2                         // example: 2 = 11000 or
-                 // dit-dit-dah-dah-dah
-    0b00100111,  // 3                         // the final bit is always 1 =
-                 // stop bit.
-    0b00101111,  // 4                         // see "sendElements" routine for
-                 // more info.
-    0b00111111,  // 5
-    0b00111110,  // 6
-    0b00111100,  // 7
-    0b00111000,  // 8
-    0b00110000,  // 9
-    0b01111000,  // : colon
-    0b01101010,  // ; semicolon
-    0b0,         // <                         // No Morse
-    0b00101110,  // = equals or ~BT
-    0b0,         // >                         // No Morse
-    0b01110011,  // ? question
-    0b01101001,  // @ at or ~AC
-    0b00000101,  // A
-    0b00011110,  // B
-    0b00011010,  // C
-    0b00001110,  // D
-    0b00000011,  // E
-    0b00011011,  // F
-    0b00001100,  // G
-    0b00011111,  // H
-    0b00000111,  // I
-    0b00010001,  // J
-    0b00001010,  // K
-    0b00011101,  // L
-    0b00000100,  // M
-    0b00000110,  // N
-    0b00001000,  // O
-    0b00011001,  // P
-    0b00010100,  // Q
-    0b00001101,  // R
-    0b00001111,  // S
-    0b00000010,  // T
-    0b00001011,  // U
-    0b00010111,  // V
-    0b00001001,  // W
-    0b00010110,  // X
-    0b00010010,  // Y
-    0b00011100   // Z
-};
+char koch[] = KOCH_ORDER;
 
 int charSpeed = DEFAULTSPEED;  // speed at which characters are sent, in WPM
 int codeSpeed = DEFAULTSPEED;  // overall code speed, in WPM
@@ -278,6 +179,8 @@ int xWordSpaces = 0;           // extra spaces between words
 int keyerMode = IAMBIC_B;      // current keyer mode
 bool usePaddles = false;       // if true, using paddles; if false, straight key
 bool paused = false;           // if true, morse output is paused
+bool navigating = false;       // if true, encoder moves through an SD text
+int jumpSteps = 0;             // sentences to move when the pause ends
 bool ditRequest = false;       // dit memory for iambic sending
 bool dahRequest = false;       // dah memory for iambic sending
 bool inStartup = true;         // startup flag
@@ -286,6 +189,11 @@ int textColor = TEXTCOLOR;  // foreground (text) color
 int bgColor = BG;           // background (screen) color
 int brightness = 100;       // backlight level (range 0-100%)
 int startItem = 0;          // startup activity.  0 = main menu
+extern volatile int webSelection;  // Defined in webhooks.cpp
+extern TaskHandle_t netTaskHandle;  // Defined in network.cpp
+int activity = -1;          // menu selection now running, -1 = in menus
+bool playingRx = false;     // sendCharacter() is sounding received text
+unsigned long keyStart = 0; // millis() the last keyed character began
 
 //===================================  Menu Variables
 //===================================
@@ -296,10 +204,12 @@ char *menu0[] = {(char *)" Koch    ", (char *)" Letters ", (char *)" Words   ",
                  (char *)" QSO     ", (char *)" Callsign", (char *)" Exit    "};
 char *menu1[] = {(char *)" Practice", (char *)" Copy One", (char *)" Copy Two",
                  (char *)" Cpy Word", (char *)" Cpy Call", (char *)" Flashcrd",
-                 (char *)" Head Cpy", (char *)" Two-Way ", (char *)" Exit    "};
+                 (char *)" Head Cpy", (char *)" Two-Way ", (char *)" Class   ",
+                 (char *)" Exit    "};
 char *menu2[] = {(char *)" Speed   ", (char *)" Chk Spd ", (char *)" Tone    ",
                  (char *)" Key     ", (char *)" Callsign", (char *)" Screen  ",
-                 (char *)" Defaults", (char *)" CLI    ",  (char *)" Exit    "};
+                 (char *)" Defaults", (char *)" CLI    ",  (char *)" Roster  ",
+                 (char *)" Exit    "};
 
 // Added by VE3OOI
 unsigned char addr = DEFAULT_EEPROM_ADDRESS;
@@ -317,8 +227,10 @@ extern char errmsg[4];
 
 #define MAXIMUM_STRING_LENGTH 80
 char line[MAXIMUM_STRING_LENGTH];
+bool cliActive = false;  // serial CLI open; remote commands are refused
 
 #endif
+Print *cliOut = &Serial;  // CLI output, redirected for remote commands
 
 //===================================  Wireless Code
 //===================================
@@ -330,6 +242,12 @@ void setStatusLED(int color) {
   tft.fillRect(xPos, yPos, size, size, color);  // fill it in with desired color
 }
 
+void setPingLED(int color) {
+  const int width = 6, height = 20;  // narrow bar left of the status LED
+  const int xPos = DISPLAYWIDTH - 20 - 2 - width, yPos = 0;
+  tft.fillRect(xPos, yPos, width, height, color);
+}
+
 //===================================  Rotary Encoder Code
 //=============================
 
@@ -477,6 +395,7 @@ void wordSpace() {
 void dit() {                            // send a dit
   ditRequest = false;                   // clear any pending request
   keyDown();                            // turN on sound & led
+  unsigned long keyed = micros();       // for element timing statistics
   int finished = millis() + ditPeriod;  // wait for duration of dit
   while (millis() < finished) {         // check dah paddle while dit sounding
     if ((keyerMode == IAMBIC_B) &&
@@ -484,6 +403,7 @@ void dit() {                            // send a dit
       dahRequest = true;  // request it for next element
   }
   keyUp();                          // turn off sound & led
+  noteElement(ditPeriod, micros() - keyed);
   finished = millis() + ditPeriod;  // wait before next element sent
   while (millis() < finished) {     // check dah paddle while waiting
     if (keyerMode && dahPressed())  // if iambic A or B & dah was pressed,
@@ -494,6 +414,7 @@ void dit() {                            // send a dit
 void dah() {                                // send a dah
   dahRequest = false;                       // clear any pending request
   keyDown();                                // turn on sound & led
+  unsigned long keyed = micros();           // for element timing statistics
   int finished = millis() + ditPeriod * 3;  // wait for duration of dah
   while (millis() < finished) {  // check dit paddle while dah sounding
     if ((keyerMode == IAMBIC_B) &&
@@ -501,6 +422,7 @@ void dah() {                                // send a dah
       ditRequest = true;  // request it for next element
   }
   keyUp();                          // turn off sound & led
+  noteElement(ditPeriod * 3, micros() - keyed);
   finished = millis() + ditPeriod;  // wait before next element sent
   while (millis() < finished) {     // check dit paddle while waiting
     if (keyerMode && ditPressed())  // if iambic A or B & dit was pressed,
@@ -536,17 +458,29 @@ void roger() {
 
 void sendCharacter(char c) {   // send a single ASCII character in Morse
   if (button_pressed) return;  // user wants to quit, so vamoose
+  if ((uint8_t)c >= NORM_PROSIGN) {  // prosign from a text, e.g. <SOS>
+    sendCoded('*', normProsign(c));
+    return;
+  }
   if (c < 32) return;          // ignore control characters
   if (c > 96) c -= 32;         // convert lower case to upper case
   if (c > 90) return;          // not a character
+  sendCoded(c, (c == 32) ? 0 : morse[c - 33]);
+}
+
+void sendCoded(char c, int code)  // show a character & send its code
+{
+  if (button_pressed) return;  // user wants to quit, so vamoose
   addCharacter(c);             // display character on LCD
+  webEvent(playingRx ? WEB_EV_RX : WEB_EV_OUT, c);  // and on any browser
   if (c == 32)
     wordSpace();  // space between words
   else
-    sendElements(morse[c - 33]);  // send the character
-  checkForSpeedChange();          // allow change in speed while sending
+    sendElements(code);   // send the character
+  checkForSpeedChange();  // allow change in speed while sending
   do {
     checkPause();
+    if (paused) checkJump();  // choose a sentence while paused
   } while (paused);  // allow user to pause morse output
 }
 
@@ -584,6 +518,11 @@ void checkForSpeedChange() {
   }
 }
 
+void checkJump()  // in an indexed SD text, each encoder step is a sentence
+{
+  if (navigating) jumpSteps += readEncoder();
+}
+
 void checkPause() {
   bool userKeyed =
       (ditPressed() ^ dahPressed());  // did user press a key (not both)
@@ -599,19 +538,28 @@ void checkPause() {
 //===================================  Koch Method
 //=====================================
 
-void sendKochLesson(int lesson)  // send letter/number groups...
+void sendKochLesson(int lesson)  // send letter/number groups & real words
 {
   const int maxCount = 175;  // full screen = 20 x 9
   int charCount = 0;
+  char word[WORDLIST_LEN];
+  bool useWords = (wordListKochCount(lesson) >= KOCH_WORDS);
+  adaptBegin(lesson);                                // weak chars more often
   newScreen();                                       // start with empty screen
   while (!button_pressed && (charCount < maxCount))  // full screen = 1 lesson
   {
-    for (int i = 0; i < WORDSIZE; i++)  // break them up into "words"
-    {
-      int c = koch[random(lesson + 1)];  // pick a random character
-      sendCharacter(c);                  // and send it
-      charCount++;                       // keep track of #chars sent
-    }
+    uint64_t want = 1ULL << adaptPick();  // a word with a char to practice
+    if (useWords && random(2) &&
+        wordListKochPick(lesson, want, word, sizeof(word))) {
+      sendString(word);                 // a word using only lesson chars
+      charCount += strlen(word);
+    } else
+      for (int i = 0; i < WORDSIZE; i++)  // break them up into "words"
+      {
+        int c = koch[adaptPick()];         // pick a character to practice
+        sendCharacter(c);                  // and send it
+        charCount++;                       // keep track of #chars sent
+      }
     sendCharacter(' ');  // send a space between words
   }
 }
@@ -672,50 +620,6 @@ void sendKoch() {
 //===================================  Receive Menu
 //====================================
 
-void addChar(char *str, char ch)  // adds 1 character to end of string
-{
-  char c[2] = " ";  // happy hacking: char into string
-  c[0] = ch;        // change char 'A' to string "A"
-  strcat(str, c);   // and add it to end of string
-}
-
-char randomLetter()  // returns a random uppercase letter
-{
-  return 'A' + random(0, 26);
-}
-
-char randomNumber()  // returns a random single-digit # 0-9
-{
-  return '0' + random(0, 10);
-}
-
-void randomCallsign(char *call)  // returns with random US callsign in "call"
-{
-  strcpy(call, "");            // start with empty callsign
-  int i = random(0, 4);        // 4 possible start letters for US
-  char c = prefix[i];          // Get first letter of prefix
-  addChar(call, c);            // and add it to callsign
-  i = random(0, 3);            // single or double-letter prefix?
-  if ((i == 2) or (c == 'A'))  // do a double-letter prefix
-  {                            // allowed combinations are:
-    if (c == 'A')
-      i = random(0, 12);  // AA-AL, or
-    else
-      i = random(0, 26);     // KA-KZ, NA-NZ, WA-WZ
-    addChar(call, 'A' + i);  // add second char to prefix
-  }
-  addChar(call, randomNumber());          // add zone number to callsign
-  for (int i = 0; i < random(1, 4); i++)  // Suffix contains 1-3 letters
-    addChar(call, randomLetter());        // add suffix letter(s) to call
-}
-
-void randomRST(char *rst) {
-  strcpy(rst, "");                    // start with empty string
-  addChar(rst, '0' + random(3, 6));   // readability 3-5
-  addChar(rst, '0' + random(5, 10));  // strength: 6-9
-  addChar(rst, '9');                  // tone usually 9
-}
-
 void sendNumbers() {
   while (!button_pressed) {
     for (int i = 0; i < WORDSIZE; i++)  // break them up into "words"
@@ -755,11 +659,20 @@ void sendPunctuation() {
   }
 }
 
+void randomWord(char *word, int size)  // common words more often
+{
+  if (wordListPick(word, size)) return;
+  int index = random(0, ELEMENTS(words));  // no list: eeny, meany, miney, moe
+  strncpy(word, words[index], size - 1);
+  word[size - 1] = 0;
+}
+
 void sendWords() {
+  char word[WORDLIST_LEN];
   while (!button_pressed) {
-    int index = random(0, ELEMENTS(words));  // eeny, meany, miney, moe
-    sendString(words[index]);                // send the word
-    sendCharacter(' ');                      // and a space between words
+    randomWord(word, sizeof(word));  // pick a word
+    sendString(word);                // send the word
+    sendCharacter(' ');              // and a space between words
   }
 }
 
@@ -774,168 +687,488 @@ void sendCallsigns()  // send random US callsigns
 }
 
 void sendQSO() {
-  char otherCall[8];
-  char temp[20];
-  char qso[300];  // string to hold entire QSO
-  randomCallsign(otherCall);
-  strcpy(qso, myCall);  // start of QSO
-  strcat(qso, " de ");
-  strcat(qso, otherCall);  // another ham is calling you
-  strcat(qso, " K  TNX FER CALL= UR RST ");
-  randomRST(temp);  // add RST
-  strcat(qso, temp);
-  strcat(qso, " ");
-  strcat(qso, temp);
-  strcat(qso, "= NAME HERE IS ");
-  strcpy(temp, names[random(0, ELEMENTS(names))]);
-  strcat(qso, temp);  // add name
-  strcat(qso, " ? ");
-  strcat(qso, temp);  // add name again
-  strcat(qso, "= QTH IS ");
-  strcpy(temp, cities[random(0, ELEMENTS(cities))]);
-  strcat(qso, temp);  // add QTH
-  strcat(qso, "= RIG HR IS ");
-  strcpy(temp, rigs[random(0, ELEMENTS(rigs))]);  // add rig
-  strcat(qso, temp);
-  strcat(qso, " ES ANT IS ");  // add antenna
-  strcat(qso, antenna[random(0, ELEMENTS(antenna))]);
-  strcat(qso, "== WX HERE IS ");  // add weather
-  strcat(qso, weather[random(0, ELEMENTS(weather))]);
-  strcat(qso, "= SO HW CPY? ");  // back to other ham
-  strcat(qso, myCall);
-  strcat(qso, " de ");
-  strcat(qso, otherCall);
-  strcat(qso, " KN");
-  sendString(qso);  // send entire QSO
-}
-
-int getFileList(char list[][FNAMESIZE])  // gets list of files on SD card
+  char otherCall[CALL_LEN];
+  int c;
+  randomCallsign(otherCall);        // another ham is calling you
+  grammarStart(myCall, otherCall);  // pick a QSO from the grammar
+  while (!button_pressed && ((c = grammarNext()) >= 0))
+    sendCharacter(c);  // send it as it is made
+  grammarEnd();
+}
+
+// Rows above a folder's entries: ".." below root, and "Play all" if it
+// holds any files (folders sort first, so the last entry tells)
+int libraryLead(bool up) {
+  LIB_ENTRY e;
+  int lead = up ? LEAD_UP : 0;
+  if (libraryEntry(libraryCount() - 1, &e) && !e.isDir) lead |= LEAD_ALL;
+  return lead;
+}
+
+int libraryLeadRows(int lead) {
+  return ((lead & LEAD_UP) ? 1 : 0) + ((lead & LEAD_ALL) ? 1 : 0);
+}
+
+int libraryItem(int item, int lead)  // menu row: ROW_UP, ROW_ALL or entry
 {
-  File root = SD.open("/");  // open root directory on the SD card
-  int count = 0;             // count the number of files
-  while (count < MAXFILES)   // only room for so many!
-  {
-    File entry = root.openNextFile();  // get next file in the SD root directory
-    if (!entry) break;                 // leave if there aren't any more
-    if (!entry.isDirectory() &&        // ignore directory names
-        (entry.name()[0] != '_'))      // ignore hidden "_name" Mac files
+  if (lead & LEAD_UP) {
+    if (item == 0) return ROW_UP;
+    item--;
+  }
+  if (lead & LEAD_ALL) {
+    if (item == 0) return ROW_ALL;
+    item--;
+  }
+  return item;
+}
 
-      // Modified by VE3OOI.  Removed entry.name()[1] so that full file name can
-      // be retrieved
-      strcpy(list[count++],
-             entry.name());  // add SD file to the list (ESP32: remove '/')
-    entry.close();           // close the file
+// Menu text for a row of the folder being browsed
+void libraryRow(int item, int lead, char *s) {
+  LIB_ENTRY e;
+  const int width = MAXCOL - 3;  // room right of the menu's left margin
+  item = libraryItem(item, lead);
+  if (item == ROW_UP) {
+    strcpy(s, "..");
+    return;
+  }
+  if (item == ROW_ALL) {
+    strcpy(s, "> Play all");
+    return;
+  }
+  if (!libraryEntry(item, &e)) {
+    s[0] = 0;
+    return;
+  }
+  int room = e.isDir ? width - 1 : width;  // folders end in '/'
+  if ((int)strlen(e.name) > room) {          // long name: show the start
+    e.name[room - 1] = '~';
+    e.name[room] = 0;
   }
-  root.close();
-  return count;
+  snprintf(s, MAXCOL, "%s%s", e.name, e.isDir ? "/" : "");
 }
 
-void displayFiles(char menu[][FNAMESIZE], int top, int itemCount) {
+void displayLibrary(int top, int itemCount, int lead) {
+  char s[MAXCOL];
   int x = 30;                       // x-coordinate of this menu
   newScreen();                      // clear screen below menu
   for (int i = 0; i < MAXROW; i++)  // for all items in the frame
   {
     int y = TOPMARGIN + i * ROWSPACING;  // calculate y coordinate
     int item = top + i;
-    if (item < itemCount)                      // make sure item exists
-      showMenuItem(menu[item], x, y, FG, BG);  // and show the item.
+    if (item < itemCount)  // make sure item exists
+    {
+      libraryRow(item, lead, s);       // read it from the index
+      showMenuItem(s, x, y, FG, BG);   // and show the item.
+    }
   }
+  if (!itemCount) tft.print((char *)"No files");
 }
 
-int fileMenu(char menu[][FNAMESIZE],
-             int itemCount)  // Display list of files & get user selection
+int libraryMenu(bool up)  // Display current folder & get user selection
 {
+  char s[MAXCOL];
   int index = 0, top = 0, pos = 0, x = 30, y;
-  button_pressed = false;              // reset button flag
-  displayFiles(menu, 0, itemCount);    // display as many files as possible
-  showMenuItem(menu[0], x, TOPMARGIN,  // highlight first item
-               SELECTFG, SELECTBG);
+  int lead = libraryLead(up);  // "..", "Play all" rows
+  int itemCount = libraryCount() + libraryLeadRows(lead);
+  button_pressed = false;               // reset button flag
+  displayLibrary(0, itemCount, lead);   // display as many files as possible
+  if (itemCount) {
+    libraryRow(0, lead, s);
+    showMenuItem(s, x, TOPMARGIN, SELECTFG, SELECTBG);  // highlight first item
+  }
   while (!button_pressed)  // exit on button press
   {
+    if (libraryStale())  // files changed since the folder was indexed
+    {
+      newScreen();
+      tft.print((char *)"Updating index");
+      libraryRebuild();
+      lead = libraryLead(up);
+      itemCount = libraryCount() + libraryLeadRows(lead);
+      index = top = pos = 0;
+      displayLibrary(0, itemCount, lead);
+      if (itemCount) {
+        libraryRow(0, lead, s);
+        showMenuItem(s, x, TOPMARGIN, SELECTFG, SELECTBG);
+      }
+      button_pressed = false;
+    }
     int dir = readEncoder();  // check for encoder movement
     if (dir)                  // it moved!
     {
       if ((dir > 0) &&
-          (index == (itemCount - 1)))  // dont try to go below last item
+          (index >= (itemCount - 1)))  // dont try to go below last item
         continue;
       if ((dir < 0) && (index == 0))  // dont try to go above first item
         continue;
       if ((dir > 0) &&
           (pos == (MAXROW - 1)))  // does the frame need to move down?
       {
-        top++;                               // yes: move frame down,
-        displayFiles(menu, top, itemCount);  // display it,
-        index++;                             // and select next item
-      } else if ((dir < 0) && (pos == 0))    // does the frame need to move up?
+        top++;                                 // yes: move frame down,
+        displayLibrary(top, itemCount, lead);  // display it,
+        index++;                               // and select next item
+      } else if ((dir < 0) && (pos == 0))      // does the frame need to move up?
       {
-        top--;                               // yes: move frame up,
-        displayFiles(menu, top, itemCount);  // display it,
-        index--;                             // and select previous item
+        top--;                                 // yes: move frame up,
+        displayLibrary(top, itemCount, lead);  // display it,
+        index--;                               // and select previous item
       } else  // we must be moving within the frame
       {
         y = TOPMARGIN + pos * ROWSPACING;  // calc y-coord of current item
-        showMenuItem(menu[index], x, y, FG, BG);  // deselect current item
-        index += dir;                             // go to next/prev item
+        libraryRow(index, lead, s);
+        showMenuItem(s, x, y, FG, BG);     // deselect current item
+        index += dir;                      // go to next/prev item
       }
       pos = index - top;  // posn of selected item in visible list
       y = TOPMARGIN + pos * ROWSPACING;  // calc y-coord of new item
-      showMenuItem(menu[index], x, y, SELECTFG, SELECTBG);  // select new item
+      libraryRow(index, lead, s);
+      showMenuItem(s, x, y, SELECTFG, SELECTBG);  // select new item
     }
   }
-  return index;
+  if (!itemCount) return ROW_NONE;  // nothing to choose
+  return libraryItem(index, lead);
+}
+
+// Let the user walk the card's folders and pick a file, playlist file or
+// (with "Play all") folder to play.  Returns false if there is nothing to
+// play.
+bool browseLibrary(char *path, int size) {
+  char dir[LIB_PATH_LEN] = "/";
+  LIB_ENTRY e;
+  for (;;) {
+    newScreen();
+    tft.print((char *)"Reading ");
+    tft.print((char *)storeName());
+    if (!libraryOpen(dir)) {  // no card, or folder gone
+      tft.print((char *)" - failed");
+      libraryClose();
+      return false;
+    }
+    int choice = libraryMenu(strcmp(dir, "/") != 0);
+    if (choice == ROW_NONE) break;  // empty root: nothing to play
+    if (choice == ROW_UP) {         // up a level
+      libraryParent(dir);
+      continue;
+    }
+    if (choice == ROW_ALL) {  // the whole folder
+      strncpy(path, dir, size - 1);
+      path[size - 1] = 0;
+      libraryClose();
+      return true;
+    }
+    if (!libraryEntry(choice, &e)) break;
+    libraryJoin(path, size, dir, e.name);
+    if (!e.isDir) {  // a file: play it
+      libraryClose();
+      return true;
+    }
+    strncpy(dir, path, sizeof(dir) - 1);  // a folder: go into it
+    dir[sizeof(dir) - 1] = 0;
+  }
+  libraryClose();
+  return false;
+}
+
+bool askResume(long offset, long size)  // offer to continue a book
+{
+  tft.print((char *)"Left off at ");
+  tft.print(size ? offset * 100 / size : 0);
+  tft.println((char *)"%");
+  tft.println((char *)"Dit = resume");
+  tft.println((char *)"Dah = start over");
+  while (!ditPressed() && !dahPressed())
+    ;
+  bool yes = ditPressed();
+  while (ditPressed() || dahPressed())  // wait for release
+    delay(10);
+  newScreen();
+  return yes;
 }
 
-void sendFile(char *filename)  // output a file to screen & morse
+long jumpFrom(long pos, int steps, bool paragraph)  // move through an SD text
+{
+  for (; steps > 0; steps--) {
+    long to = navNext(pos, paragraph);
+    if (to < 0) break;  // nothing further
+    pos = to;
+  }
+  for (; steps < 0; steps++) pos = navPrev(pos, paragraph);
+  return pos;
+}
+
+void sendFile(char *filename)  // output a text, folder or playlist
 {
-  char s[FNAMESIZE] = "/";   // ESP32: need space for whole filename
-  strcat(s, filename);       // ESP32: prepend filename with slash
   const int pageSkip = 250;  // number of characters to skip, if asked to
+  char ahead[STREAM_AHEAD];  // text read from file but not yet played
+  long aheadTo[STREAM_AHEAD];  // file position just after each one's source
+  char chunk[STREAM_CHUNK + NORM_MAX];  // text read but not yet streamed
+  long chunkTo[STREAM_CHUNK + NORM_MAX];
+  int pending = 0;                      // characters in chunk[]
+  char path[LIB_PATH_LEN];   // file being played
+  char next[LIB_PATH_LEN];   // and the one after it
+  int head = 0, count = 0;   // oldest unplayed char and number unplayed
+  int item = 0;              // playlist item being played
+  long size = 0, resume = 0; // its size, and where the first one starts
+  long played = 0;           // file position of the next sound
   newScreen();               // clear screen below menu
 
-  // Notes by VE3OOI.  Sending file contends via network is a bad idea.  Can
-  // result in a buffer overflow
-  bool wireless = longPress();   // if long button press, send file wirelessly
-  if (wireless) initWireless();  // start wireless
-  if (!(cfg.conflag & SRV_CONNECTED)) {
-    tft.print((char *)"Wifi Err");
-    closeWireless();
-    wireless = false;
+  // With a long press the file is streamed to the room in chunks, ahead of
+  // local audio and throttled by the queue space receivers report.
+  bool wireless = longPress();  // if long button press, send file wirelessly
+  if (wireless) {
+    initWireless();  // start wireless
+    if (!(cfg.conflag & SRV_CONNECTED)) {
+      tft.print((char *)"Wifi Err");
+      closeWireless();
+      wireless = false;
+    }
+  }
+  int items = playlistOpen(filename);  // a folder or playlist has several
+  bool isList = playlistIsList();
+  if (isList) item = bookmarkGet(filename, items);  // where the list was left
+  if (playlistItem(item, path, sizeof(path))) {
+    File f = store().open(path);
+    if (f) {
+      size = f.size();
+      f.close();
+    }
+    resume = bookmarkGet(path, size);
+    if ((item || resume) &&
+        !askResume(isList ? item : resume, isList ? items : size))
+      item = resume = 0;  // start over
   }
-  //    transmission
   button_pressed = false;  // reset flag for new presses
-  File book = SD.open(s);  // look for book on sd card
-  if (book) {              // find it?
-    while (!button_pressed &&
-           book.available())  // do for all characters in book:
+  int ch = READER_EOF;     // last readerGet(): character, wait, next or end
+  bool started = false;    // first item has been opened
+  bool playing = false;    // an item's bookmark is open
+  while (!button_pressed) {
+    if (!count && !pending &&
+        (ch == READER_EOF || ch == READER_NEXT)) {  // item played
+      if (playing) {
+        bookmarkClose(0);  // finished it
+        navClose();
+        playing = false;
+        item++;
+        if (isList) bookmarkPut(filename, items, item < items ? item : 0);
+      }
+      if (!playlistItem(item, path, sizeof(path))) break;  // end of the list
+      if (ch == READER_EOF && !readerOpen(path)) break;  // not queued: open it
+      navigating = navOpen(path);
+      if (!navigating && !started) {  // first time: index the text
+        tft.print((char *)"Indexing");
+        navBuild(path);
+        navigating = navOpen(path);
+        newScreen();
+      }
+      size = readerSize();
+      bookmarkOpen(path, size);
+      playing = true;
+      played = 0;
+      if (!started && resume)
+        readerSeek(played = resume);  // pick up where the student left off
+      normReset();
+      if (playlistItem(item + 1, next, sizeof(next)))
+        readerQueue(next);  // no gap before it
+      started = true;
+      jumpSteps = 0;
+      ch = 0;
+    }
+    // top up the look-ahead buffer: one chunk at a time when streaming.  The
+    // normalizer may hold a few bytes back or give several characters for one.
+    // A chunk joins the buffer only once the room has it, so the tutor never
+    // plays text its receivers did not get.
+    int want = wireless ? STREAM_CHUNK : 1;
+    while ((pending || (ch != READER_EOF && ch != READER_NEXT)) &&
+           (STREAM_AHEAD - count >= want + NORM_MAX) &&
+           (!wireless || pending || streamCanSend(want + NORM_MAX))) {
+      int got = 0;
+      long at = readerPosition();
+      while (!pending && got < want && (ch = readerGet()) >= 0) {
+        at = readerPosition();
+        int n = normByte(ch, chunk + got);
+        for (int i = got; i < got + n; i++) chunkTo[i] = at;
+        got += n;
+      }
+      if (!pending && (ch == READER_EOF || ch == READER_NEXT)) {  // item end
+        int n = normEnd(chunk + got);
+        for (int i = got; i < got + n; i++) chunkTo[i] = at;
+        got += n;
+      }
+      if (!pending) pending = got;
+      if (wireless && pending && !streamChunk(chunk, pending)) {
+        if (cfg.conflag & SRV_CONNECTED) break;  // queue full: try again
+        wireless = false;  // lost the room: carry on alone
+      }
+      for (int i = 0; i < pending; i++) {
+        ahead[(head + count) % STREAM_AHEAD] = chunk[i];
+        aheadTo[(head + count++) % STREAM_AHEAD] = chunkTo[i];
+      }
+      pending = 0;
+      if (!wireless || ch < 0) break;  // one char will do, or card is behind
+    }
+    if (!count) {  // receivers are full or the card is catching up
+      if (pending || ch == READER_WAIT || ch >= 0) delay(10);
+      continue;
+    }
+    sendCharacter(ahead[head]);  // and send it
+    played = aheadTo[head];
+    head = (head + 1) % STREAM_AHEAD;
+    count--;
+    bookmarkUpdate(played);  // position played to
+
+    if (jumpSteps)  // sentences chosen with the encoder while paused
+    {
+      count = pending = 0;  // drop what was read ahead
+      if (wireless) streamSeek();  // and have receivers drop it too
+      readerSeek(played = jumpFrom(played, jumpSteps, false));
+      normReset();
+      jumpSteps = 0;
+      ch = 0;
+    }
+    if (ditPressed() && dahPressed())  // user wants to 'skip' ahead:
     {
-      char ch = book.read();     // get next character
-      if (ch == '\n') ch = ' ';  // convert LN to a space
-      sendCharacter(ch);         // and send it
+      int steps = 0;
+      sendString((char *)"= ");  // acknowledge the skip with ~BT
+      while (ditPressed() && dahPressed())  // turn to choose paragraphs
+        steps += readEncoder();
+      count = pending = 0;  // drop what was read ahead
+      if (wireless) streamSeek();  // and have receivers drop it too
+      if (navigating)
+        played = jumpFrom(played, steps ? steps : 1, true);
+      else
+        played += pageSkip;  // no index: skip a bunch of text!
+      readerSeek(played);
+      normReset();
+      ch = 0;
+    }
+  }
+  if (playing) {  // stopped partway through
+    bookmarkClose(played);
+    if (isList) bookmarkPut(filename, items, item);
+  }
+  readerClose();  // close the file
+  navClose();
+  navigating = false;
+  playlistClose();
+  if (wireless) closeWireless();  // close wireless transmission
+}
 
-      // Notes by VE3OOI.  Sending file contends via network is a bad idea.  Can
-      // result in a buffer overflow
-      if (wireless) sendWireless(ch);
+int mrsByte(void)  // next byte of a .MRS file from the reader, -1 at the end
+{
+  int b;
+  while ((b = readerGet()) == READER_WAIT)  // only after opening or seeking
+    delay(1);
+  return b < 0 ? -1 : b;
+}
+
+// Offset of the seek table entry "ahead" entries past the one holding "at"
+static long mrsMark(File &f, MRS_HEADER *h, long at, int ahead) {
+  uint32_t mark;
+  long lo = 0, hi = h->seekCount;  // last entry at or before "at"
+  while (hi - lo > 1) {
+    long mid = (lo + hi) / 2;
+    f.seek(sizeof(MRS_HEADER) + mid * 4);
+    f.read((uint8_t *)&mark, 4);
+    if ((long)mark <= at)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  if (lo + ahead >= (long)h->seekCount) return -1;
+  f.seek(sizeof(MRS_HEADER) + (lo + ahead) * 4);
+  f.read((uint8_t *)&mark, 4);
+  return mark;
+}
+
+void sendMorseFile(char *path)  // play a pre-encoded .MRS file
+{
+  MRS_HEADER h;
+  newScreen();
+  File f = store().open(path);  // for the header & seek table
+  if (!f || f.read((uint8_t *)&h, sizeof(h)) != sizeof(h) ||
+      h.magic != MRS_MAGIC || !h.seekCount) {
+    tft.print((char *)"Not a Morse file");
+    if (f) f.close();
+    delay(2000);
+    return;
+  }
+  long data = sizeof(h) + h.seekCount * 4;  // first record
+  button_pressed = false;  // reset flag for new presses
+  if (readerOpen(path)) {
+    long size = readerSize();
+    long resume = bookmarkOpen(path, size);
+    if (resume > data && askResume(resume - data, size - data))
+      readerSeek(resume);  // bookmarks are always at a record
+    else
+      readerSeek(data);
+    long at = readerPosition();  // start of the next record
+    int shown = 0;
+    while (!button_pressed && (shown = mrsByte()) >= 0) {
+      int code = mrsByte();
+      if (shown & MRS_LONG) code |= mrsByte() << 8;
+      if (code < 0) break;  // cut short
+      sendCoded(shown & ~MRS_LONG, code);
+      at = readerPosition();
+      bookmarkUpdate(at);
       if (ditPressed() && dahPressed())  // user wants to 'skip' ahead:
       {
-        sendString((char *)"= ");  // acknowledge the skip with ~BT
-        for (int i = 0; i < pageSkip; i++)
-          book.read();  // skip a bunch of text!
+        sendString((char *)"= ");      // acknowledge the skip with ~BT
+        long to = mrsMark(f, &h, at, 2);  // 129 to 256 characters on
+        if (to >= 0) readerSeek(to);
+        at = readerPosition();
       }
     }
-    book.close();  // close the file
+    bookmarkClose(shown < 0 ? 0 : at);  // 0: finished
+    readerClose();
   }
-  // Notes by VE3OOI.  Sending file contends via network is a bad idea.  Can
-  // result in a buffer overflow
-  if (wireless) closeWireless();  // close wireless transmission
+  f.close();
 }
 
-void sendFromSD()  // show files on SD card, get user selection & send it.
+int corpusMenu()  // choose a text built into flash
 {
-  char list[MAXFILES][FNAMESIZE];      // hold list of SD filenames (DOS 8.3
-                                       // format, 13 char)
-  int count = getFileList(list);       // get list of files on the SD card
-  int choice = fileMenu(list, count);  // display list & let user choose one
-  sendFile(list[choice]);              // output text & morse until user quits
+  char rows[CORPUS_TEXTS][CORPUS_NAME_LEN + 2];
+  char *menu[CORPUS_TEXTS];
+  int count = min(corpusCount(), CORPUS_TEXTS);
+  for (int i = 0; i < count; i++) {
+    snprintf(rows[i], sizeof(rows[i]), " %-*s", CORPUS_NAME_LEN - 1,
+             corpusName(i));
+    menu[i] = rows[i];
+  }
+  newScreen();
+  return subMenu(menu, count);
+}
+
+void sendCorpus(int text)  // output a built-in text until user quits
+{
+  const int pageSkip = 250;  // number of characters to skip, if asked to
+  int c;
+  newScreen();
+  button_pressed = false;  // reset flag for new presses
+  corpusStart(text, 0);
+  while (!button_pressed && (c = corpusGet()) >= 0) {
+    sendCharacter(c);
+    if (ditPressed() && dahPressed())  // user wants to 'skip' ahead
+    {
+      sendString((char *)"= ");  // acknowledge the skip with ~BT
+      while (ditPressed() && dahPressed())
+        ;
+      corpusStart(text, corpusPosition() + pageSkip);
+    }
+  }
+}
+
+void sendFromSD()  // browse the SD card, get user selection & send it.
+{
+  char path[LIB_PATH_LEN];  // full path of the chosen file
+  if (!browseLibrary(path, sizeof(path))) {
+    if (corpusCount()) sendCorpus(corpusMenu());  // nothing stored: built in
+    return;
+  }
+  int len = strlen(path);
+  if (len > 4 && !strcasecmp(path + len - 4, MRS_EXT))
+    sendMorseFile(path);  // pre-encoded morse
+  else
+    sendFile(path);  // output text & morse until user quits
 }
 
 //===================================  Send Menu
@@ -975,6 +1208,7 @@ char paddleInput()  // monitor paddles & return a decoded char
     if (ditRequest ||                   // dit was requested
         (ditPressed() && !dahRequest))  // or user now pressing it
     {
+      if (!bit) keyStart = millis();  // first element of the character
       dit();                 // so sound it out
       code += (1 << bit++);  // add a '1' element to code
       start = millis();      // and reset timeout.
@@ -982,6 +1216,7 @@ char paddleInput()  // monitor paddles & return a decoded char
     if (dahRequest ||                   // dah was requested
         (dahPressed() && !ditRequest))  // or user now pressing it
     {
+      if (!bit) keyStart = millis();  // first element of the character
       dah();             // so sound it tout
       bit++;             // add '0' element to code
       start = millis();  // and reset the timeout.
@@ -1015,6 +1250,7 @@ char straightKeyInput()  // decode straight key input
       timeUp = start - end;
       if (timeUp > 10)  // was key up for 10mS?
       {
+        if (!bit) keyStart = start;  // first element of the character
         keying = true;  // mark key as down
         keyDown();      // turn on sound & led
       }
@@ -1049,10 +1285,13 @@ char straightKeyInput()  // decode straight key input
 
 char morseInput()  // get & decode user input from key
 {
+  char ch;
   if (usePaddles)
-    return paddleInput();  // it can be either paddle input
+    ch = paddleInput();  // it can be either paddle input
   else
-    return straightKeyInput();  // or straight key, depending on setting
+    ch = straightKeyInput();  // or straight key, depending on setting
+  if (ch) webEvent(WEB_EV_IN, ch);  // show browsers what was keyed
+  return ch;
 }
 
 void practice()  // get Morse from user & display it
@@ -1096,11 +1335,10 @@ void copyTwoChars() {
 
 void copyWords()  // show a callsign & see if user can copy it
 {
-  char text[10];
+  char text[WORDLIST_LEN];
   while (!button_pressed) {
-    int index = random(0, ELEMENTS(words));  // eeny, meany, miney, moe
-    strcpy(text, words[index]);              // pick a random word
-    mimic(text);                             // and ask user to copy it
+    randomWord(text, sizeof(text));  // pick a random word
+    mimic(text);                     // and ask user to copy it
   }
 }
 
@@ -1139,25 +1377,53 @@ void showScore()  // helper fn for mimic()
   encourageUser();  // show encouraging message periodically
 }
 
-void mimic1(char *text) {
-  char ch, response[20];
-  textRow = 1;
-  textCol = 6;           // set position of text
-  sendString(text);      // display text & morse it
-  strcpy(response, "");  // start with empty response
+void readReply(char *response, unsigned int *ms)  // key & time an answer
+{
+  char ch;
+  unsigned long last = millis();  // prompt has just ended
+  strcpy(response, "");           // start with empty response
   textRow = 2;
   textCol = 6;                             // set position of response
   while (!button_pressed && !ditPressed()  // wait until user is ready
          && !dahPressed())
     ;
-  do {                                     // user has started keying...
-    ch = morseInput();                     // get a character
-    if (ch != ' ') addChar(response, ch);  // add it to the response
-    addCharacter(ch);                      // and put it on screen
-  } while (ch != ' ');                     // space = word timeout
-  if (button_pressed) return;              // leave without scoring
-  if (!strcmp(text, response))             // did user match the text?
-    score++;                               // yes, so increment score
+  do {                  // user has started keying...
+    ch = morseInput();  // get a character
+    int len = strlen(response);
+    if ((ch != ' ') && (len < ADAPT_REPLY)) {
+      ms[len] = (keyStart > last) ? keyStart - last : 0;  // hesitation
+      addChar(response, ch);  // add it to the response
+    }
+    last = millis();
+    addCharacter(ch);   // and put it on screen
+  } while (ch != ' ');  // space = word timeout
+}
+
+// Score an answer character by character: ms[i] is the hesitation before
+// response[i].  Feeds adaptive Koch, the statistics log and flashcards.
+void scoreReply(char *text, char *response, unsigned int *ms) {
+  int keyed = strlen(response);
+  for (int i = 0; text[i]; i++) {
+    bool answered = (i < keyed);
+    bool correct = answered && (response[i] == text[i]);
+    unsigned int t = answered ? ms[i] : ADAPT_SLOW;
+    adaptAnswer(text[i], correct, t);
+    statsAdd(text[i], activity, charSpeed, correct, t);
+    cardsAnswer(text[i], correct ? CARD_RIGHT : CARD_WRONG);
+  }
+}
+
+void mimic1(char *text) {
+  char response[ADAPT_REPLY + 1];
+  unsigned int ms[ADAPT_REPLY];
+  textRow = 1;
+  textCol = 6;                    // set position of text
+  sendString(text);               // display text & morse it
+  readReply(response, ms);        // get user's answer
+  if (button_pressed) return;     // leave without scoring
+  scoreReply(text, response, ms);  // note which characters were hard
+  if (!strcmp(text, response))    // did user match the text?
+    score++;                      // yes, so increment score
   else
     score = 0;            // no, so reset score to 0
   showScore();            // display score for user
@@ -1175,11 +1441,10 @@ void showHitsAndMisses(int hits, int misses)  // helper fn for mimic2()
 
 void headCopy()  // show a callsign & see if user can copy it
 {
-  char text[10];
+  char text[WORDLIST_LEN];
   while (!button_pressed) {
-    int index = random(0, ELEMENTS(words));  // eeny, meany, miney, moe
-    strcpy(text, words[index]);              // pick a random word
-    mimic2(text);                            // and ask user to copy it
+    randomWord(text, sizeof(text));  // pick a random word
+    mimic2(text);                    // and ask user to copy it
   }
 }
 
@@ -1199,26 +1464,19 @@ void missTone() {
 
 void mimic2(char *text)  // used by head-copy feature
 {
-  char ch, response[20];
+  char response[ADAPT_REPLY + 1];
+  unsigned int ms[ADAPT_REPLY];
   bool correct, leave;
-  do {                     // repeat same word until correct
-    sendMorseWord(text);   // morse the text, NO DISPLAY
-    strcpy(response, "");  // start with empty response
-    textRow = 2;
-    textCol = 6;                             // set position of response
-    while (!button_pressed && !ditPressed()  // wait until user is ready
-           && !dahPressed())
-      ;
-    do {                                     // user has started keying...
-      ch = morseInput();                     // get a character
-      if (ch != ' ') addChar(response, ch);  // add it to the response
-      addCharacter(ch);                      // and put it on screen
-    } while (ch != ' ');                     // space = word timeout
-    if (button_pressed) return;              // leave without scoring
-    correct = !strcmp(text, response);       // did user match the text?
-    leave = !strcmp(response, "=");          // user entered BT/break to skip
-    if (correct) {                           // did user match the text?
-      hits++;                                // got it right!
+  do {                                  // repeat same word until correct
+    sendMorseWord(text);                // morse the text, NO DISPLAY
+    readReply(response, ms);            // get user's answer
+    if (button_pressed) return;         // leave without scoring
+    leave = !strcmp(response, "=");     // user entered BT/break to skip
+    if (!leave)                         // a skip says nothing about them,
+      scoreReply(text, response, ms);   // else note which were hard
+    correct = !strcmp(text, response);  // did user match the text?
+    if (correct) {                      // did user match the text?
+      hits++;                           // got it right!
       hitTone();
     } else {
       misses++;  // user muffed it
@@ -1237,17 +1495,30 @@ void mimic(char *text) {
     mimic1(text);  // no, so use original scoring mode
 }
 
+int gradeCard()  // dit = knew it, dah = missed it, neither = just seen
+{
+  unsigned long shown = millis();
+  int grade = CARD_SEEN;
+  while (!button_pressed && (millis() - shown < FLASHCARDDELAY)) {
+    if (ditPressed()) grade = CARD_RIGHT;
+    if (dahPressed()) grade = CARD_WRONG;
+    if (grade != CARD_SEEN) break;
+  }
+  while (ditPressed() || dahPressed())
+    ;  // wait for key release
+  return grade;
+}
+
 void flashcards() {
+  setTopMenu((char *)"Knew it? Dit=YES, Dah=NO");  // cards are self-graded
   tft.setTextSize(7);
   while (!button_pressed) {
-    int index = random(0, ELEMENTS(morse));  // get a random character
-    int code = morse[index];                 // convert to morse code
-    if (!code) continue;                     // only do valid morse chars
-    sendElements(code);                      // sound it out
-    delay(1000);                             // wait for user to guess
+    int index = cardsNext();      // the card due soonest
+    sendElements(morse[index]);   // sound it out
+    delay(1000);                  // wait for user to guess
     tft.setCursor(120, 70);
     tft.print(char('!' + index));  // show the answer
-    delay(FLASHCARDDELAY);         // wait a little
+    cardsAnswer('!' + index, gradeCard());  // reschedule it
     newScreen();                   // and start over.
   }
 }
@@ -1263,7 +1534,9 @@ void twoWay()  // wireless QSO between units
   }
   char oldCh = ' ';
   while (!button_pressed) {
-    processMQTT();
+    updatePingLED();  // show how the link to the other units is doing
+    if (!(cfg.conflag & SRV_CONNECTED))  // netTask() lost the broker
+      setStatusLED(RED);
     char ch = morseInput();                // get a morse character from user
     if (!((ch == ' ') && (oldCh == ' ')))  // only 1 word space at a time.
     {
@@ -1275,16 +1548,242 @@ void twoWay()  // wireless QSO between units
 
     while (ch = deQueue())  // any characters to receive?
     {
-      processMQTT();  // Address potential buffer overflow - clear any
-                      // received characters
+      setStatusLED(GREEN);        // green status LED for data received
       tft.setTextColor(RXCOLOR);  // change text color
+      playingRx = true;
       sendCharacter(ch);          // sound it out and show it.
+      playingRx = false;
+    }
+
+    while (ch = webText())  // text typed in a browser goes out as if keyed
+    {
+      tft.setTextColor(TXCOLOR);
+      sendCharacter(ch);
+      sendWireless(ch);
     }
   }
   tft.setTextColor(TEXTCOLOR);
   closeWireless();
 }
 
+void showLeaderboard(unsigned int seq)  // instructor's view of the class
+{
+  PUPIL list[CLASS_PUPILS];
+  int n = getLeaderboard(list, CLASS_PUPILS);
+  newScreen();
+  tft.setTextColor(CYAN, bgColor);
+  tft.print((char *)"Lesson ");
+  tft.print(seq);
+  tft.print((char *)"  answers: ");
+  tft.print(lessonAnswers(seq));
+  tft.setTextColor(textColor, bgColor);
+  for (int row = 1; row < MAXROW && row <= n; row++) {
+    PUPIL *p = &list[row - 1];
+    tft.setCursor(0, TOPMARGIN + row * ROWSPACING);
+    tft.print(row);
+    tft.print((char *)" ");
+    tft.print(p->call);
+    tft.setCursor(14 * COLSPACING, TOPMARGIN + row * ROWSPACING);
+    tft.print(p->points);
+    tft.print((char *)"/");
+    tft.print(p->answered);
+    tft.setCursor(21 * COLSPACING, TOPMARGIN + row * ROWSPACING);
+    tft.print(p->totalMs / p->answered / 1000.0, 1);  // average seconds
+  }
+}
+
+void instructor()  // send lessons to the room & rank the answers
+{
+  LESSON lesson;
+  setTopMenu((char *)"Class: instructor");
+  tft.println((char *)"Dit = copy (text shown)");
+  tft.println((char *)"Dah = head copy");
+  while (!button_pressed && !ditPressed() && !dahPressed())
+    ;
+  if (button_pressed) return;
+  lesson.mode = ditPressed() ? 1 : 2;
+  initWireless(false);  // no CQ: students are waiting for lessons
+  if (!(cfg.conflag & SRV_CONNECTED)) {
+    tft.print((char *)"Network Err");
+    closeWireless();
+    delay(5000);
+    return;
+  }
+  startClass(CLASS_INSTRUCTOR);
+  delay(CLASS_SYNC_MS * 3);  // give students a few clock beacons first
+  lesson.seq = 0;
+  while (!button_pressed) {
+    lesson.seq++;
+    randomWord(lesson.text, sizeof(lesson.text));
+    lesson.wpm = charSpeed;
+    lesson.fwpm = codeSpeed;
+    lesson.window = CLASS_ANSWER_MS;
+    lesson.start = classClock() + CLASS_LEAD;
+    if (!postLesson(&lesson)) {
+      setStatusLED(RED);
+      delay(1000);
+      continue;
+    }
+    newScreen();
+    while (!button_pressed && (long)(classClock() - lesson.start) < 0)
+      ;
+    textRow = 1;
+    textCol = 6;
+    sendString(lesson.text);  // instructor always sees the text
+    unsigned long until = millis() + lesson.window + CLASS_LEAD;
+    int shown = -1;
+    while (!button_pressed && (long)(millis() - until) < 0) {
+      int answers = lessonAnswers(lesson.seq);
+      if (answers != shown)  // answers arrive as students finish
+        showLeaderboard(lesson.seq);
+      shown = answers;
+    }
+    delay(FLASHCARDDELAY);
+  }
+  endClass();
+  closeWireless();
+}
+
+void student()  // play the instructor's lessons & report answers
+{
+  LESSON lesson;
+  char ch, response[CLASS_MAX_TEXT];
+  int oldCharSpeed = charSpeed, oldCodeSpeed = codeSpeed;
+  initWireless(false);  // no CQ: the room is a classroom
+  if (!(cfg.conflag & SRV_CONNECTED)) {
+    tft.print((char *)"Network Err");
+    closeWireless();
+    delay(5000);
+    return;
+  }
+  startClass(CLASS_STUDENT);
+  tft.print((char *)"Waiting for instructor");
+  while (!button_pressed) {
+    if (!getLesson(&lesson)) continue;
+    if (!classSynced()) lesson.start = classClock();  // no beacon yet
+    newScreen();
+    while (!button_pressed && (long)(classClock() - lesson.start) < 0)
+      ;
+    charSpeed = lesson.wpm;  // everyone sends at the instructor's speed
+    codeSpeed = lesson.fwpm;
+    ditPeriod = intracharDit();
+    textRow = 1;
+    textCol = 6;
+    if (lesson.mode == 2)
+      sendMorseWord(lesson.text);  // head copy: morse only, no display
+    else
+      sendString(lesson.text);
+    charSpeed = oldCharSpeed;
+    codeSpeed = oldCodeSpeed;
+    ditPeriod = intracharDit();
+
+    unsigned long sent = millis();
+    strcpy(response, "");
+    textRow = 2;
+    textCol = 6;
+    while (!button_pressed && !ditPressed() && !dahPressed() &&
+           (millis() - sent < lesson.window))
+      ;
+    if (button_pressed) break;
+    if (ditPressed() || dahPressed()) {
+      do {
+        ch = morseInput();
+        if (ch != ' ' && strlen(response) < sizeof(response) - 1)
+          addChar(response, ch);
+        addCharacter(ch);
+      } while (ch != ' ');
+    }
+    if (button_pressed) break;
+    bool correct = !strcmp(lesson.text, response);
+    postScore(&lesson, correct, millis() - sent);
+    if (lesson.mode == 2) {
+      if (correct) {
+        hits++;
+        hitTone();
+      } else {
+        misses++;
+        missTone();
+      }
+      showHitsAndMisses(hits, misses);
+    } else {
+      score = correct ? score + 1 : 0;
+      showScore();
+    }
+  }
+  charSpeed = oldCharSpeed;  // in case we left mid-lesson
+  codeSpeed = oldCodeSpeed;
+  ditPeriod = intracharDit();
+  endClass();
+  closeWireless();
+}
+
+void classroom()  // long press = instructor, otherwise student
+{
+  if (button_downtime > LONGPRESS)
+    instructor();
+  else
+    student();
+}
+
+void showRoster()  // who is in our room, and which other rooms are active
+{
+  STATION stations[ROSTER_MAX];
+  ROOM list[ROOMS_MAX];
+  int top = 0, n = -1, m = -1;
+  unsigned long drawn = 0;
+  initWireless(false);  // connect quietly: no CQ to the room
+  if (!(cfg.conflag & SRV_CONNECTED)) {
+    tft.print((char *)"Network Err");
+    closeWireless();
+    delay(5000);
+    return;
+  }
+  netSubscribe(DIRECTORY_PREFIX "+");  // retained entries arrive at once
+  while (!button_pressed) {
+    int dir = readEncoder();
+    int oldN = n, oldM = m;
+    n = getRoster(stations, ROSTER_MAX);
+    m = getRooms(list, ROOMS_MAX);
+    int lines = n + m + 2;  // two heading lines
+    top = constrain(top + dir, 0, max(0, lines - MAXROW));
+    if (!dir && n == oldN && m == oldM && (millis() - drawn < 10000))
+      continue;  // nothing new to show
+    drawn = millis();
+    newScreen();
+    for (int row = 0; row < MAXROW && top + row < lines; row++) {
+      int item = top + row;
+      tft.setCursor(0, TOPMARGIN + row * ROWSPACING);
+      if (item == 0) {  // heading for our room
+        tft.setTextColor(CYAN, bgColor);
+        tft.print(cfg.room);
+        tft.print((char *)" (");
+        tft.print(n);
+        tft.print((char *)")");
+      } else if (item <= n) {  // station in our room
+        STATION *st = &stations[item - 1];
+        tft.setTextColor(textColor, bgColor);
+        tft.print((char *)" ");
+        tft.print(st->call);
+        tft.setCursor(14 * COLSPACING, TOPMARGIN + row * ROWSPACING);
+        tft.print(st->minutes);
+        tft.print((char *)"m");
+      } else if (item == n + 1) {  // heading for room directory
+        tft.setTextColor(CYAN, bgColor);
+        tft.print((char *)"Active rooms");
+      } else {  // another room
+        ROOM *rm = &list[item - n - 2];
+        tft.setTextColor(textColor, bgColor);
+        tft.print((char *)" ");
+        tft.print(rm->name);
+        tft.setCursor(22 * COLSPACING, TOPMARGIN + row * ROWSPACING);
+        tft.print(rm->stations);
+      }
+    }
+    tft.setTextColor(textColor, bgColor);
+  }
+  closeWireless();
+}
+
 //===================================  Config Menu
 //=====================================
 
@@ -1298,23 +1797,42 @@ void clearMem(void) {
 void dumpMem(void) {
   memset(eebuf, 0, sizeof(eebuf));
   EEPROM.readBytes(0, eebuf, sizeof(eebuf));
-  Serial.print("EEPROM Dump for ");
-  Serial.print(sizeof(eebuf));
-  Serial.println(" bytes");
+  cliOut->print("EEPROM Dump for ");
+  cliOut->print(sizeof(eebuf));
+  cliOut->println(" bytes");
 
-  Serial.println("Addr\tHex\tDec\tASCII");
+  cliOut->println("Addr\tHex\tDec\tASCII");
   for (int i = 0; i < sizeof(eebuf); i++) {
-    Serial.print(i);
-    Serial.print("\t");
-    Serial.print(eebuf[i], HEX);
-    Serial.print("\t");
-    Serial.print((unsigned char)eebuf[i]);
-    Serial.print("\t");
-    Serial.print((char)eebuf[i]);
-    Serial.println();
+    cliOut->print(i);
+    cliOut->print("\t");
+    cliOut->print(eebuf[i], HEX);
+    cliOut->print("\t");
+    cliOut->print((unsigned char)eebuf[i]);
+    cliOut->print("\t");
+    cliOut->print((char)eebuf[i]);
+    cliOut->println();
   }
 }
 
+void corpusBenchmark(void)  // decode every built-in text once, timed
+{
+  long chars = 0;
+  unsigned long start = micros();
+  for (int i = 0; i < corpusCount(); i++) {
+    corpusStart(i, 0);
+    while (corpusGet() >= 0) chars++;
+  }
+  unsigned long us = micros() - start;
+  cliOut->print(corpusCount());
+  cliOut->print(" built-in texts, ");
+  cliOut->print(chars);
+  cliOut->print(" characters decoded in ");
+  cliOut->print(us);
+  cliOut->print(" us: ");
+  cliOut->print(us ? (unsigned long)(chars * 1000000.0 / us) : 0);
+  cliOut->println(" characters per second");
+}
+
 void initializeMem(void) {
   Serial.println("Initializing cfg and mem");
   memset((char *)&cfg, 0, sizeof(cfg));
@@ -1346,6 +1864,7 @@ void initializeMem(void) {
   strcpy(cfg.mqtt_password, DEFAULT_MQTT_PASSWORD);
   strcpy(cfg.mqtt_server, DEFAULT_SERVER_ADDRESS);
   strcpy(cfg.room, DEFAULT_MQTT_ROOM);
+  strcpy(cfg.cli_key, DEFAULT_CLI_KEY);
   setRunningConfig();
   saveConfig();
 }
@@ -1353,69 +1872,69 @@ void initializeMem(void) {
 // Modified by VE3OOI
 void printConfig(unsigned char ee)  // debugging only; not called
 {
-  TUTOR_STRUT cfgbck;
-
-  if (ee) {
-    memset((char *)&cfgbck, 0, sizeof(cfgbck));
-    memcpy((char *)&cfgbck, (char *)&cfg,
-           sizeof(cfgbck));  // backup running config
-    loadConfig();
-    if (cfg.flag != INIT_FLAG) {
+  TUTOR_STRUT saved;
+  const TUTOR_STRUT *c = &cfg;
+
+  if (ee) {  // read a copy; cfg and the running settings stay untouched
+    EEPROM.readBytes(addr, (char *)&saved, sizeof(saved));
+    if (saved.flag != INIT_FLAG) {
+      cliOut->println("EEPROM config not initialized");
       return;
     }
-  }
-  Serial.print("\r\nEEPROM Config at Addr: ");
-  Serial.print(addr);
-  Serial.print(" size: ");
-  Serial.println(sizeof(cfg));
-  Serial.print("  flag: ");
-  Serial.println(cfg.flag);
-  Serial.print("  charSpeed: ");
-  Serial.println(cfg.charSpeed);
-  Serial.print("  codeSpeed: ");
-  Serial.println(cfg.codeSpeed);
-  Serial.print("  pitch: ");
-  Serial.println(cfg.pitch);
-  Serial.print("  ditPaddle: ");
-  Serial.println(cfg.ditPaddle);
-  Serial.print("  kochLevel: ");
-  Serial.println(cfg.kochLevel);
-  Serial.print("  usePaddles");
-  Serial.println(cfg.usePaddles);
-  Serial.print("  xWordSpaces: ");
-  Serial.println(cfg.xWordSpaces);
-  Serial.print("  myCall: ");
-  Serial.println(cfg.myCall);
-  Serial.print("  keyerMode: ");
-  Serial.println(cfg.keyerMode);
-  Serial.print("  startItem: ");
-  Serial.println(cfg.startItem);
-  Serial.print("  brightness: ");
-  Serial.println(cfg.brightness);
-  Serial.print("  textColor: ");
-  Serial.println(cfg.textColor);
-  Serial.print("  bgColor: ");
-  Serial.println(cfg.bgColor);
-  Serial.print("  Connection Flag: ");
-  Serial.println(cfg.conflag);
-  Serial.print("  wifi_ssid: ");
-  Serial.println(cfg.wifi_ssid);
-  Serial.print("  wifi_password: ");
-  Serial.println(cfg.wifi_password);
-  Serial.print("  mqtt_userid: ");
-  Serial.println(cfg.mqtt_userid);
-  Serial.print("  mqtt_password: ");
-  Serial.println(cfg.mqtt_password);
-  Serial.print("  mqtt_server: ");
-  Serial.println(cfg.mqtt_server);
-  Serial.print("  room: ");
-  Serial.println(cfg.room);
-
-  if (ee) {  // loadConfig sets running config, need to restore back to original
-    memcpy((char *)&cfg, (char *)&cfgbck,
-           sizeof(cfg));  // restore running config
-    setRunningConfig();
-  }
+    c = &saved;
+  }
+  cliOut->print("\r\nEEPROM Config at Addr: ");
+  cliOut->print(addr);
+  cliOut->print(" size: ");
+  cliOut->println(sizeof(*c));
+  cliOut->print("  flag: ");
+  cliOut->println(c->flag);
+  cliOut->print("  charSpeed: ");
+  cliOut->println(c->charSpeed);
+  cliOut->print("  codeSpeed: ");
+  cliOut->println(c->codeSpeed);
+  cliOut->print("  pitch: ");
+  cliOut->println(c->pitch);
+  cliOut->print("  ditPaddle: ");
+  cliOut->println(c->ditPaddle);
+  cliOut->print("  kochLevel: ");
+  cliOut->println(c->kochLevel);
+  cliOut->print("  usePaddles");
+  cliOut->println(c->usePaddles);
+  cliOut->print("  xWordSpaces: ");
+  cliOut->println(c->xWordSpaces);
+  cliOut->print("  myCall: ");
+  cliOut->println(c->myCall);
+  cliOut->print("  keyerMode: ");
+  cliOut->println(c->keyerMode);
+  cliOut->print("  startItem: ");
+  cliOut->println(c->startItem);
+  cliOut->print("  brightness: ");
+  cliOut->println(c->brightness);
+  cliOut->print("  textColor: ");
+  cliOut->println(c->textColor);
+  cliOut->print("  bgColor: ");
+  cliOut->println(c->bgColor);
+  cliOut->print("  Connection Flag: ");
+  cliOut->println(c->conflag);
+  if (netTaskHandle) {  // low water mark, to check NET_TASK_STACK
+    cliOut->print("  netTask stack never used: ");
+    cliOut->println(uxTaskGetStackHighWaterMark(netTaskHandle));
+  }
+  cliOut->print("  wifi_ssid: ");
+  cliOut->println(c->wifi_ssid);
+  cliOut->print("  wifi_password: ");
+  cliOut->println(cliOut == &Serial ? c->wifi_password : "****");
+  cliOut->print("  mqtt_userid: ");
+  cliOut->println(c->mqtt_userid);
+  cliOut->print("  mqtt_password: ");
+  cliOut->println(cliOut == &Serial ? c->mqtt_password : "****");
+  cliOut->print("  mqtt_server: ");
+  cliOut->println(c->mqtt_server);
+  cliOut->print("  room: ");
+  cliOut->println(c->room);
+  cliOut->print("  cli_key: ");
+  cliOut->println(c->cli_key[0] ? "set" : "not set");
 }
 
 // Modified by VE3OOI
@@ -1435,6 +1954,7 @@ void saveConfig(void) {
   cfg.bgColor = bgColor;
 
   EEPROM.writeBytes(addr, (char *)&cfg, sizeof(cfg));
+  EEPROM.write(addr + offsetof(TUTOR_STRUT, conflag), 0);  // not a setting
   EEPROM.commit();
 }
 
@@ -1458,8 +1978,10 @@ void setRunningConfig(void) {
 
 // Modified by VE3OOI
 void loadConfig(void) {
+  unsigned char conflag = cfg.conflag;  // keep connection state
   memset((char *)&cfg, 0, sizeof(cfg));
   EEPROM.readBytes(addr, (char *)&cfg, sizeof(cfg));
+  cfg.conflag = conflag;
   if (cfg.flag != INIT_FLAG) {
     Serial.println("EEPROM config not defined. Running config not defined!!");
     Serial.println("Restart or use CLI to initialize EEPROM");
@@ -1531,12 +2053,24 @@ void checkConfig(void)  // ensure config settings are valid
     changed = true;
   }
 
-  if ((startItem < -1) || (startItem > 27)) {
+  if ((startItem < -1) || (startItem > 28)) {
     Serial.println("Invalid startItem. Resetting");
     startItem = -1;  // validate startup screen
     changed = true;
   }
 
+  // cli_key was added after INIT_FLAG 0xA1; older EEPROM images hold erased
+  // flash (0xFF) here, which must not become a key
+  for (int i = 0; i < (int)sizeof(cfg.cli_key); i++) {
+    if (!cfg.cli_key[i]) break;
+    if (!isPrintable(cfg.cli_key[i]) || i == sizeof(cfg.cli_key) - 1) {
+      Serial.println("Invalid cli_key. Resetting");
+      memset(cfg.cli_key, 0, sizeof(cfg.cli_key));
+      changed = true;
+      break;
+    }
+  }
+
   if (changed) {
     Serial.println("Saving changes to EEPROM");
     saveConfig();
@@ -1606,7 +2140,7 @@ void showMenuChoice(int choice) {
 
 void changeStartup()  // choose startup activity
 {
-  const int LASTITEM = 27;  // currenly 27 choices
+  const int LASTITEM = 28;  // currenly 28 choices
   tft.setTextSize(2);
   tft.println((char *)"\nStartup:");
   int i = startItem;
@@ -1955,6 +2489,7 @@ int getMenuSelection()  // Display menu system & get user selection
   newScreen();  // start with fresh screen
   menuCol = topMenu(mainMenu,
                     ELEMENTS(mainMenu));  // show horiz menu & get user choice
+  if (webSelection != -2) return -1;      // browser picked instead; see loop()
   switch (menuCol)                        // now show menu that user selected:
   {
     case 0:
@@ -2118,9 +2653,7 @@ void initMorse() {
 }
 
 void initSD() {
-  delay(200);       // dont rush things on power-up
-  SD.begin(SD_CS);  // initialize SD library
-  delay(100);       // takin' it easy
+  storeBegin();  // SD card, or the flash store without one
 }
 
 void initScreen() {
@@ -2156,6 +2689,11 @@ void setup() {
   EEPROM.begin(sizeof(eebuf));  // ESP32 specific for bytes used of flash
 
   initSD();  // initialize SD library
+  corpusOpen(corpusData);  // texts built in for units without a card
+  wordListOpen();          // practice words: the store's list or built in
+  statsBegin();            // answer totals, adaptive Koch starts from them
+  cardsBegin();            // flashcard boxes from the last session
+  grammarOpen();           // practice QSOs: the store's grammar or built in
 
   // Added by VE3OOI
 #ifndef REMOVE_CLI
@@ -2168,6 +2706,9 @@ void setup() {
   }
 
   splashScreen();  // show we are ready
+#ifdef WEB_SERVER
+  startWiFi();     // status page comes up once Wi-Fi connects
+#endif
   initEncoder();   // attach encoder interrupts
   initMorse();     // attach paddles & adjust speed
   delay(2000);     // keep splash screen on for a while
@@ -2177,9 +2718,14 @@ void setup() {
 
 void loop() {
   int selection = startItem;  // start with user specified startup screen
-  if (!inStartup || (startItem < 0))  // but, if there isn't one,
+  if ((webSelection == -2) &&         // unless a browser picked one,
+      (!inStartup || (startItem < 0)))  // or if there isn't one,
     selection = getMenuSelection();   // get menu selection from user instead
   inStartup = false;                  // reset startup flag
+  if (webSelection != -2) {           // browser asked for an activity
+    selection = takeWebMode();
+    if (selection < 0) return;  // back to the menus
+  }
   showSelection(selection);  // display users selection at top of screen
   newScreen();               // and clear the screen below it.
   button_pressed = false;    // reset flag for new presses
@@ -2187,6 +2733,7 @@ void loop() {
   score = 0;
   hits = 0;
   misses = 0;  // restart score for copy challenges
+  activity = selection;  // reported by fleet telemetry
 
   switch (selection)  // do action requested by user
   {
@@ -2239,6 +2786,9 @@ void loop() {
     case 17:
       twoWay();
       break;
+    case 18:
+      classroom();
+      break;
 
     case 20:
       setSpeed();
@@ -2264,8 +2814,25 @@ void loop() {
     case 27:
       openCLI();
       break;
+    case 28:
+      showRoster();
+      break;
     default:;
   }
+  statsFlush();  // write out answers still held in RAM
+  cardsSave();   // and where the flashcards are up to
+  activity = -1;
+}
+
+// True if selection is an activity on one of the menus (or -1 for menus)
+bool validSelection(int selection) {
+  int i = selection / 10, j = selection % 10;
+  if (selection == -1) return true;
+  if (selection < 0) return false;
+  if (i == 0) return j < ELEMENTS(menu0) - 1;  // last item is Exit
+  if (i == 1) return j < ELEMENTS(menu1) - 1;
+  if (i == 2) return j < ELEMENTS(menu2) - 1;
+  return false;
 }
 
 void openCLI(void) {
@@ -2274,10 +2841,12 @@ void openCLI(void) {
   resetSerial();
   printPrompt();
 
+  cliActive = true;
   while (!button_pressed)  // exit on button press
   {
     processSerial();
   }
+  cliActive = false;
   resetSerial();
 
 #else
@@ -2303,22 +2872,37 @@ void executeSerial(char *str) {
   // entered after the command. E.g. F [n] [m] would be mean "F 0 7000000" is
   // entered (no square brackets entered)
   switch (commands[0]) {
+    case 'A':  // Answer statistics by character
+      if (commands[1] == 'R')
+        statsDump();  // every logged answer, as CSV
+      else if (commands[1] == 'E')
+        statsErase();
+      else
+        statsPrint();
+      break;
+
+    case 'B':  // Built-in texts: decoding speed
+      corpusBenchmark();
+      break;
+
     case 'C':  // Get call sign
-      Serial.print("Current: ");
-      Serial.println(cfg.myCall);
-      readSerialLine((char *)"Call Sign: ", MAX_CALLSIGN_STRING);
+      cliOut->print("Current: ");
+      cliOut->println(cfg.myCall);
+      if (!getArgument(str, 1, (char *)"Call Sign: ", MAX_CALLSIGN_STRING))
+        break;
       if (strlen(line) > MIN_STRING) {
-        Serial.print("\r\nChanging: ");
-        Serial.print(cfg.myCall);
-        Serial.print(" to: ");
-        Serial.println(line);
+        cliOut->print("\r\nChanging: ");
+        cliOut->print(cfg.myCall);
+        cliOut->print(" to: ");
+        cliOut->println(line);
         // already forced checking for array size MAX_CHAR_STRING
         // forced "line" to be zero filled so no danger of buffer overflow here
         memset(cfg.myCall, 0, sizeof(cfg.myCall));
+        memset(myCall, 0, sizeof(myCall));
         strncpy(cfg.myCall, line, strlen(line));
         strncpy(myCall, line, strlen(line));
       } else {
-        Serial.println("Empty input");
+        cliOut->println("Empty input");
       }
       break;
 
@@ -2331,48 +2915,87 @@ void executeSerial(char *str) {
       break;
 
     case 'H':  // Help
-      Serial.println("Help:");
-      Serial.println("C - enter callsign");
-      Serial.println("D - dump eeprom");
-      Serial.println("E - erase eeprom");
-      Serial.println("I - init eeprom with defaults");
-      Serial.println("L - load eeprom & run");
-      Serial.println("M - enter server name");
-      Serial.println("P - print running config");
-      Serial.println("P E - print eeprom config");
-      Serial.println("R - enter room name");
-      Serial.println("S - save running config to eeprom");
-      Serial.println("T - test network connection");
-      Serial.println("U U - enter MQTT username");
-      Serial.println("U P - enter MQTT password");
-      Serial.println("W S - enter Wi-Fi SSID");
-      Serial.println("W P - enter Wi-Fi password");
+      cliOut->println("Help:");
+      cliOut->println("A - print answer statistics by character");
+      cliOut->println("A R - print every logged answer (CSV)");
+      cliOut->println("A E - erase answer statistics");
+      cliOut->println("B - time decoding of built-in texts");
+      cliOut->println("C [call] - enter callsign");
+      cliOut->println("D - dump eeprom");
+      cliOut->println("E - erase eeprom");
+      cliOut->println("I - init eeprom with defaults");
+      cliOut->println("K [key] - enter remote CLI key (serial only)");
+      cliOut->println("L - load eeprom & run");
+      cliOut->println("M [name] - enter server name");
+      cliOut->println("N - print network latency");
+      cliOut->println("N R - run network latency test");
+      cliOut->println("P - print running config");
+      cliOut->println("P E - print eeprom config");
+      cliOut->println("R [room] - enter room name");
+      cliOut->println("S - save running config to eeprom");
+      cliOut->println("T - test network connection");
+      cliOut->println("U U [name] - enter MQTT username");
+      cliOut->println("U P [password] - enter MQTT password");
+      cliOut->println("W S [ssid] - enter Wi-Fi SSID");
+      cliOut->println("W P [password] - enter Wi-Fi password");
       break;
 
     case 'I':  // Initialize EEPROM
       initializeMem();
       break;
 
+    case 'K':  // Key for remote CLI over MQTT.  Never shown or set remotely.
+      if (cliOut != &Serial) {
+        errorOut();
+        break;
+      }
+      if (!getArgument(str, 1, (char *)"Remote CLI key: ", MAX_CHAR_STRING))
+        break;
+      memset(cfg.cli_key, 0, sizeof(cfg.cli_key));
+      if (strlen(line) >= MIN_REMOTE_KEY) {
+        strncpy(cfg.cli_key, line, strlen(line));
+        Serial.println("\r\nRemote CLI enabled");
+      } else {
+        Serial.println("\r\nRemote CLI disabled");
+      }
+      break;
+
     case 'L':  // Load config EEPROM
       loadConfig();
       break;
 
     case 'M':  // Get MQTT Server name
-      Serial.print("Current: ");
-      Serial.println(cfg.mqtt_server);
-      readSerialLine((char *)"Server DNS Name: ", MAX_CHAR_STRING);
+      cliOut->print("Current: ");
+      cliOut->println(cfg.mqtt_server);
+      if (!getArgument(str, 1, (char *)"Server DNS Name: ", MAX_CHAR_STRING))
+        break;
       if (strlen(line) > MIN_STRING) {
-        Serial.print("\r\nChanging: ");
-        Serial.print(cfg.mqtt_server);
-        Serial.print(" to: ");
-        Serial.println(line);
+        cliOut->print("\r\nChanging: ");
+        cliOut->print(cfg.mqtt_server);
+        cliOut->print(" to: ");
+        cliOut->println(line);
         // already forced checking for array size MAX_CHAR_STRING
         // forced "line" to be zero filled so no danger of buffer overflow here
         memset(cfg.mqtt_server, 0, sizeof(cfg.mqtt_server));
         strncpy(cfg.mqtt_server, line, strlen(line));
       } else {
-        Serial.println("Empty input");
+        cliOut->println("Empty input");
+      }
+      break;
+
+    case 'N':  // Network round trip statistics
+      if (commands[1] == 'R') {
+        cliOut->println("Measuring round trip to other units in room");
+        initWireless();
+        if (!(cfg.conflag & SRV_CONNECTED)) {
+          cliOut->println("FAILURE! Please check config");
+          closeWireless();
+          break;
+        }
+        delay(PING_INTERVAL * 10);  // netTask() probes in the background
+        closeWireless();
       }
+      printLatency();
       break;
 
     case 'P':  // Print memory Config
@@ -2384,20 +3007,20 @@ void executeSerial(char *str) {
       break;
 
     case 'R':  // Get MQTT Topic which I call room
-      Serial.print("Current: ");
-      Serial.println(cfg.room);
-      readSerialLine((char *)"Room Name: ", MAX_CHAR_STRING);
+      cliOut->print("Current: ");
+      cliOut->println(cfg.room);
+      if (!getArgument(str, 1, (char *)"Room Name: ", MAX_CHAR_STRING)) break;
       if (strlen(line) > MIN_STRING) {
-        Serial.print("\r\nChanging: ");
-        Serial.print(cfg.room);
-        Serial.print(" to: ");
-        Serial.println(line);
+        cliOut->print("\r\nChanging: ");
+        cliOut->print(cfg.room);
+        cliOut->print(" to: ");
+        cliOut->println(line);
         // already forced checking for array size MAX_CHAR_STRING
         // forced "line" to be zero filled so no danger of buffer overflow here
         memset(cfg.room, 0, sizeof(cfg.room));
         strncpy(cfg.room, line, strlen(line));
       } else {
-        Serial.println("Empty input");
+        cliOut->println("Empty input");
       }
       break;
 
@@ -2406,86 +3029,90 @@ void executeSerial(char *str) {
       break;
 
     case 'T':  // Test WiFi and MQTT Connection
-      Serial.print("Testing WiFi and MQTT Connection");
+      cliOut->print("Testing WiFi and MQTT Connection");
       initWireless();  // look for another unit & connect
       if (!(cfg.conflag & SRV_CONNECTED)) {
-        Serial.println("FAILURE! Please check config");
+        cliOut->println("FAILURE! Please check config");
       } else {
-        Serial.println("SUCESS!!!  Don't forget to save config");
+        cliOut->println("SUCESS!!!  Don't forget to save config");
       }
-      Serial.println("Closing WiFi...");
+      cliOut->println("Closing WiFi...");
       closeWireless();
       break;
 
     case 'U':  // Enter user info
       if (commands[1] == 'U') {
-        Serial.print("Current: ");
-        Serial.println(cfg.mqtt_userid);
-        readSerialLine((char *)"Enter username: ", MAX_CHAR_STRING);
+        cliOut->print("Current: ");
+        cliOut->println(cfg.mqtt_userid);
+        if (!getArgument(str, 2, (char *)"Enter username: ", MAX_CHAR_STRING))
+          break;
       } else if (commands[1] == 'P') {
-        Serial.print("Current: ");
-        Serial.println(cfg.mqtt_password);
-        readSerialLine((char *)"Enter password: ", MAX_CHAR_STRING);
+        cliOut->print("Current: ");
+        cliOut->println(cliOut == &Serial ? cfg.mqtt_password : "****");
+        if (!getArgument(str, 2, (char *)"Enter password: ", MAX_CHAR_STRING))
+          break;
       } else {
-        Serial.println("Usage: 'U U' or 'U P'");
+        cliOut->println("Usage: 'U U' or 'U P'");
         break;
       }
       if (strlen(line) > MIN_STRING && commands[1] == 'U') {
-        Serial.print("\r\nChanging: ");
-        Serial.print(cfg.mqtt_userid);
-        Serial.print(" to: ");
-        Serial.println(line);
+        cliOut->print("\r\nChanging: ");
+        cliOut->print(cfg.mqtt_userid);
+        cliOut->print(" to: ");
+        cliOut->println(line);
         // already forced checking for array size MAX_CHAR_STRING
         // forced "line" to be zero filled so no danger of buffer overflow here
         memset(cfg.mqtt_userid, 0, sizeof(cfg.mqtt_userid));
         strncpy(cfg.mqtt_userid, line, strlen(line));
       } else if (strlen(line) > MIN_STRING && commands[1] == 'P') {
-        Serial.print("\r\nChanging: ");
-        Serial.print(cfg.mqtt_password);
-        Serial.print(" to: ");
-        Serial.println(line);
+        cliOut->print("\r\nChanging: ");
+        cliOut->print(cliOut == &Serial ? cfg.mqtt_password : "****");
+        cliOut->print(" to: ");
+        cliOut->println(cliOut == &Serial ? line : "****");
         // already forced checking for array size MAX_CHAR_STRING
         // forced "line" to be zero filled so no danger of buffer overflow here
         memset(cfg.mqtt_password, 0, sizeof(cfg.mqtt_password));
         strncpy(cfg.mqtt_password, line, strlen(line));
       } else
-        Serial.println("Empty input");
+        cliOut->println("Empty input");
       break;
 
     case 'W':  // Print memory Config
       if (commands[1] == 'S') {
-        Serial.print("Current: ");
-        Serial.println(cfg.wifi_ssid);
-        readSerialLine((char *)"Enter SSID: ", MAX_CHAR_STRING);
+        cliOut->print("Current: ");
+        cliOut->println(cfg.wifi_ssid);
+        if (!getArgument(str, 2, (char *)"Enter SSID: ", MAX_CHAR_STRING))
+          break;
       } else if (commands[1] == 'P') {
-        Serial.print("Current: ");
-        Serial.println(cfg.wifi_password);
-        readSerialLine((char *)"Enter password: ", MAX_CHAR_STRING);
+        cliOut->print("Current: ");
+        cliOut->println(cliOut == &Serial ? cfg.wifi_password : "****");
+        if (!getArgument(str, 2, (char *)"Enter password: ", MAX_CHAR_STRING))
+          break;
 
       } else {
-        Serial.println("Usage: 'W S' or 'W P'");
+        cliOut->println("Usage: 'W S' or 'W P'");
         break;
       }
       if (strlen(line) > MIN_STRING && commands[1] == 'S') {
-        Serial.print("\r\nChanging: ");
-        Serial.print(cfg.wifi_ssid);
-        Serial.print(" to: ");
-        Serial.println(line);
+        cliOut->print("\r\nChanging: ");
+        cliOut->print(cfg.wifi_ssid);
+        cliOut->print(" to: ");
+        cliOut->println(line);
         // already forced checking for array size MAX_CHAR_STRING
         // forced "line" to be zero filled so no danger of buffer overflow here
         memset(cfg.wifi_ssid, 0, sizeof(cfg.wifi_ssid));
         strncpy(cfg.wifi_ssid, line, strlen(line));
       } else if (strlen(line) > MIN_STRING && commands[1] == 'P') {
-        Serial.print("\r\nChanging: ");
-        Serial.print(cfg.wifi_password);
-        Serial.print(" to: ");
-        Serial.println(line);
+        cliOut->print("\r\nChanging: ");
+        cliOut->print(cliOut == &Serial ? cfg.wifi_password : "****");
+        cliOut->print(" to: ");
+        cliOut->println(cliOut == &Serial ? line : "****");
         // already forced checking for array size MAX_CHAR_STRING
         // forced "line" to be zero filled so no danger of buffer overflow here
         memset(cfg.wifi_password, 0, sizeof(cfg.wifi_password));
         strncpy(cfg.wifi_password, line, strlen(line));
       } else
-        Serial.println("Empty input");
+        cliOut->println("Empty input");
       break;
 
     // If an undefined command is entered, display an error message
@@ -2526,4 +3153,40 @@ void readSerialLine(char *inprompt, int size) {
   }
 }
 
-#endif  // REMOVE_CLI
\ No newline at end of file
+// Text after the first 'skip' words of a command line, or NULL if none
+char *cliArgument(char *str, int skip) {
+  char *end;
+  while (skip--) {
+    while (*str == ' ') str++;
+    while (*str && *str != ' ') str++;
+  }
+  while (*str == ' ') str++;
+  if (!*str) return NULL;
+  end = str + strlen(str) - 1;
+  while (end > str && *end == ' ') *end-- = 0;  // drop trailing spaces
+  return str;
+}
+
+// Put a new setting value in line[]: taken from the command line when given
+// (e.g. "W S MYWIFI"), otherwise prompted for on the serial port.  Remote
+// commands must always give the value.
+bool getArgument(char *str, int skip, char *inprompt, int size) {
+  char *arg = cliArgument(str, skip);
+  if (arg) {
+    memset(line, 0, sizeof(line));
+    if ((int)strlen(arg) >= size) {
+      cliOut->println("String Too Long");
+      return false;
+    }
+    strcpy(line, arg);
+    return true;
+  }
+  if (cliOut != &Serial) {
+    cliOut->println("Missing value");
+    return false;
+  }
+  readSerialLine(inprompt, size);
+  return true;
+}
+
+#endif  // REMOVE_CLI
@@ -0,0 +1,94 @@
+/*
+
+  Adaptive Koch character selection (see adaptive.h).
+
+  Statistics are kept by place in the Koch order.  Characters outside it,
+  such as the apostrophe in a practice word, are not counted.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+
+#include "main.h"
+#include "wordlist.h"
+#include "adaptive.h"
+
+static const char kochOrder[] = KOCH_ORDER;
+static ADAPT_STAT stats[WORDLIST_LEVELS];
+static int adaptLesson = 0;    // picks come from kochOrder[0..adaptLesson]
+static long adaptTotal = 0;    // their weights, summed
+
+static uint16_t weightOf(const ADAPT_STAT *s) {
+  int weight = ADAPT_BASE + s->miss / 4 + s->ms / ADAPT_MS;
+  if (s->tries < ADAPT_NEW) weight += 2 * (ADAPT_NEW - s->tries);
+  return weight;
+}
+
+static long counted(int i)  // weight as it counts in this lesson
+{
+  return (long)stats[i].weight * (i == adaptLesson ? ADAPT_NEWEST : 1);
+}
+
+void adaptBegin(int lesson)  // pick from koch[0..lesson] from now on
+{
+  if (lesson < 0) lesson = 0;
+  if (lesson >= WORDLIST_LEVELS) lesson = WORDLIST_LEVELS - 1;
+  adaptLesson = lesson;
+  adaptTotal = 0;
+  for (int i = 0; i <= lesson; i++) {
+    if (!stats[i].weight) stats[i].weight = weightOf(&stats[i]);
+    adaptTotal += counted(i);
+  }
+}
+
+int adaptPick(void)  // place in the Koch order of the next character
+{
+  long r = random(adaptTotal);
+  for (int i = 0; i < adaptLesson; i++) {
+    r -= counted(i);
+    if (r < 0) return i;
+  }
+  return adaptLesson;
+}
+
+void adaptAnswer(char c, bool correct, unsigned int ms)  // one copied char
+{
+  const char *p = strchr(kochOrder, toupper(c));
+  if (!c || !p) return;
+  int i = p - kochOrder;
+  ADAPT_STAT *s = &stats[i];
+  int miss = correct ? 0 : 255;
+  if (!correct || ms > ADAPT_SLOW) ms = ADAPT_SLOW;
+  if (!s->tries) {  // first answer: start the averages there
+    s->miss = miss;
+    s->ms = ms;
+  } else {
+    s->miss += (miss - s->miss) >> ADAPT_SHIFT;
+    s->ms += ((int)ms - s->ms) >> ADAPT_SHIFT;
+  }
+  if (s->tries < 0xFFFF) s->tries++;
+  long before = counted(i);
+  s->weight = weightOf(s);
+  if (i <= adaptLesson) adaptTotal += counted(i) - before;
+}
+
+// Start a character from long-term totals (see statlog.h)
+void adaptSeed(int index, long tries, long misses, unsigned int ms) {
+  if (index < 0 || index >= WORDLIST_LEVELS) return;
+  ADAPT_STAT *s = &stats[index];
+  s->tries = (tries > 0xFFFF) ? 0xFFFF : tries;
+  s->miss = tries ? misses * 255 / tries : 0;
+  s->ms = (ms > ADAPT_SLOW) ? ADAPT_SLOW : ms;
+  long before = counted(index);
+  s->weight = weightOf(s);
+  if (index <= adaptLesson) adaptTotal += counted(index) - before;
+}
+
+void adaptReset(void)  // forget all answers
+{
+  memset(stats, 0, sizeof(stats));
+  adaptBegin(adaptLesson);
+}
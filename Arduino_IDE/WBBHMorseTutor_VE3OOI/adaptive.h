@@ -0,0 +1,42 @@
+#ifndef _ADAPTIVE_H_
+#define _ADAPTIVE_H_
+
+#include <Arduino.h>
+#include "main.h"
+#include "wordlist.h"
+
+//===================================  Adaptive Koch Constants
+//===========================
+// Koch lessons pick characters by weight rather than evenly.  Each answer in
+// a copy mode updates the character's smoothed miss rate and hesitation
+// (time from the end of the prompt, or the previous character, to the
+// first element keyed) and recomputes its weight on the spot:
+//   ADAPT_BASE + miss rate / 4 + hesitation / ADAPT_MS + newness
+// where newness falls from 2 * ADAPT_NEW to 0 over the first ADAPT_NEW
+// answers.  The lesson's newest character counts ADAPT_NEWEST times.  The
+// weights of the lesson's characters are kept summed, so an answer costs
+// a few additions and a pick is one walk along at most WORDLIST_LEVELS
+// weights.  Until there are answers every character weighs the same.
+#define ADAPT_BASE 16     // weight of a character that is always right
+#define ADAPT_SHIFT 3     // each answer moves the averages 1/8 of the way
+#define ADAPT_MS 50       // mS of hesitation per unit of weight
+#define ADAPT_SLOW 3000   // mS: slower answers (and misses) count as this
+#define ADAPT_NEW 20      // answers before a character stops being new
+#define ADAPT_NEWEST 2    // weight multiple of the lesson's newest character
+#define ADAPT_REPLY 20    // longest reply timed by the copy modes
+
+typedef struct {
+  uint16_t tries;   // answers, up to 65535
+  uint8_t miss;     // smoothed miss rate, 0-255
+  uint16_t ms;      // smoothed hesitation, mS
+  uint16_t weight;  // current weight (see above)
+} ADAPT_STAT;
+
+// Function Prototypes
+void adaptBegin(int lesson);
+int adaptPick(void);
+void adaptAnswer(char c, bool correct, unsigned int ms);
+void adaptSeed(int index, long tries, long misses, unsigned int ms);
+void adaptReset(void);
+
+#endif  // _ADAPTIVE_H_
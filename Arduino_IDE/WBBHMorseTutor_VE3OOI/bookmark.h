@@ -0,0 +1,24 @@
+#ifndef _BOOKMARK_H_
+#define _BOOKMARK_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  Bookmark Constants
+//================================
+// Where each SD text was left, so a long book picks up where the student
+// stopped.  One small table on the card holds BOOKMARK_SLOTS files (the
+// least recently used is forgotten).  The position is written at most once
+// per BOOKMARK_MS while playing, and once more when playback stops.
+#define BOOKMARK_FILE "/_BOOKMRK.MTL"  // hidden from the SD card library
+#define BOOKMARK_SLOTS 64              // files remembered
+#define BOOKMARK_MS 60000              // least time between writes, in mS
+
+// Function Prototypes
+long bookmarkOpen(const char *path, long size);
+void bookmarkUpdate(long offset);
+void bookmarkClose(long offset);
+long bookmarkGet(const char *path, long size);
+void bookmarkPut(const char *path, long size, long offset);
+
+#endif  // _BOOKMARK_H_
@@ -0,0 +1,125 @@
+/*
+
+  Leitner flashcard scheduling (see cards.h).
+
+  Due times are 16-bit and compared by their difference, so the clock can
+  wrap.  No card can fall far behind it: an overdue card is at the top of
+  the heap and is shown within a few cards.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "main.h"
+#include "storage.h"
+#include "morse.h"
+#include "wordlist.h"
+#include "cards.h"
+
+static const uint16_t gaps[CARD_BOXES] = CARD_GAPS;
+static CARD_STATE cards;
+static uint8_t heap[MORSE_COUNT];  // morse[] indexes, soonest due first
+static int8_t place[MORSE_COUNT];  // each card's place in heap[], -1 = none
+static int heapSize = 0;
+static bool cardsChanged = false;  // not yet saved
+
+static bool sooner(int a, int b)  // is card a due before card b?
+{
+  return (int16_t)(cards.due[a] - cards.due[b]) < 0;
+}
+
+static void swapPlaces(int i, int j) {
+  uint8_t t = heap[i];
+  heap[i] = heap[j];
+  heap[j] = t;
+  place[heap[i]] = i;
+  place[heap[j]] = j;
+}
+
+static void siftUp(int i) {
+  while (i > 0 && sooner(heap[i], heap[(i - 1) / 2])) {
+    swapPlaces(i, (i - 1) / 2);
+    i = (i - 1) / 2;
+  }
+}
+
+static void siftDown(int i) {
+  while (true) {
+    int first = i, left = 2 * i + 1, right = left + 1;
+    if (left < heapSize && sooner(heap[left], heap[first])) first = left;
+    if (right < heapSize && sooner(heap[right], heap[first])) first = right;
+    if (first == i) return;
+    swapPlaces(i, first);
+    i = first;
+  }
+}
+
+static void freshCards(void)  // every card new, due in Koch order first
+{
+  const char *koch = KOCH_ORDER;
+  memset(&cards, 0, sizeof(cards));
+  cards.magic = CARD_MAGIC;
+  for (int i = 0; i < MORSE_COUNT; i++) {
+    const char *p = strchr(koch, MORSE_FIRST + i);
+    cards.due[i] = p ? p - koch : WORDLIST_LEVELS + i;
+  }
+}
+
+void cardsBegin(void)  // load saved boxes or start afresh, & build the heap
+{
+  File f = store().exists(CARD_FILE) ? store().open(CARD_FILE) : File();
+  if (!f || f.read((uint8_t *)&cards, sizeof(cards)) != sizeof(cards) ||
+      cards.magic != CARD_MAGIC)
+    freshCards();
+  if (f) f.close();
+  heapSize = 0;
+  for (int i = 0; i < MORSE_COUNT; i++) {
+    place[i] = -1;
+    if (!morse[i]) continue;  // no code, no card
+    if (cards.box[i] >= CARD_BOXES) cards.box[i] = 0;
+    heap[heapSize] = i;
+    place[i] = heapSize++;
+  }
+  for (int i = heapSize / 2 - 1; i >= 0; i--) siftDown(i);
+  cardsChanged = false;
+}
+
+int cardsNext(void)  // morse[] index of the card due soonest
+{
+  cards.clock++;
+  cardsChanged = true;
+  return heapSize ? heap[0] : 0;
+}
+
+void cardsAnswer(char c, int grade)  // reschedule after any answer
+{
+  if (c > 96) c -= 32;  // upper case
+  int i = c - MORSE_FIRST;
+  if (i < 0 || i >= MORSE_COUNT || place[i] < 0) return;
+  uint16_t before = cards.due[i];
+  if (grade == CARD_RIGHT && cards.box[i] < CARD_BOXES - 1) cards.box[i]++;
+  if (grade == CARD_WRONG) cards.box[i] = 0;
+  cards.due[i] = cards.clock + gaps[cards.box[i]];
+  if ((int16_t)(cards.due[i] - before) < 0)
+    siftUp(place[i]);
+  else
+    siftDown(place[i]);
+  cardsChanged = true;
+}
+
+void cardsSave(void)  // write the boxes out if they have changed
+{
+  if (!cardsChanged || storeKind() == STORE_NONE) return;
+  File f = store().open(CARD_FILE, FILE_WRITE);
+  if (!f) {
+    Serial.println("Cards: cannot write " CARD_FILE);
+    return;
+  }
+  f.write((uint8_t *)&cards, sizeof(cards));
+  f.close();
+  cardsChanged = false;
+}
@@ -0,0 +1,39 @@
+#ifndef _CARDS_H_
+#define _CARDS_H_
+
+#include <Arduino.h>
+#include "main.h"
+#include "morse.h"
+
+//===================================  Flashcard Constants
+//===============================
+// Flashcards are scheduled Leitner fashion.  Every character with a code is
+// a card in one of CARD_BOXES boxes: a right answer moves it up a box, a
+// wrong one back to the first.  A card in box b comes round again
+// CARD_GAPS[b] cards after it was answered, counted on a clock that ticks
+// once per card shown, so no real-time clock is needed.  The cards are kept
+// in a min-heap on their due time: the next card is the top, and
+// rescheduling one after an answer, in any mode, is one sift.  The whole
+// state is a few hundred bytes and is kept in CARD_FILE between sessions.
+#define CARD_FILE "/_CARDS.MTL"    // hidden from the SD card library
+#define CARD_MAGIC 0x3146544DUL    // "MTF1"
+#define CARD_BOXES 6
+#define CARD_GAPS {2, 6, 15, 40, 100, 250}  // cards until due again, by box
+#define CARD_SEEN 0                // cardsAnswer(): shown, not graded
+#define CARD_RIGHT 1               //   knew it
+#define CARD_WRONG 2               //   missed it
+
+typedef struct {
+  uint32_t magic;            // CARD_MAGIC
+  uint16_t clock;            // cards shown
+  uint8_t box[MORSE_COUNT];  // by morse[] index
+  uint16_t due[MORSE_COUNT]; // clock when next due
+} CARD_STATE;
+
+// Function Prototypes
+void cardsBegin(void);
+int cardsNext(void);
+void cardsAnswer(char c, int grade);
+void cardsSave(void);
+
+#endif  // _CARDS_H_
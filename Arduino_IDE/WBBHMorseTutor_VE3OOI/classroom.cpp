@@ -0,0 +1,234 @@
+/*
+
+  Classroom broadcast: one instructor unit drives lessons on many students.
+
+  Students estimate the instructor's clock from periodic beacons.  A beacon
+  can only arrive late, never early, so the offset is taken from the beacon
+  that arrived soonest within the last CLASS_SYNC_WINDOW (a minimum filter on
+  the network delay).  Lessons carry a start time on that clock so every
+  student begins sending on the same element.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+
+#include "main.h"
+#include "network.h"
+#include "latency.h"
+#include "classroom.h"
+
+extern PubSubClient client;  // Defined in network.cpp
+extern char localid[10];     // Defined in network.cpp
+extern char myCall[MAX_CALLSIGN_STRING];  // Defined in main.cpp
+extern TUTOR_STRUT cfg;      // Defined in main.cpp
+
+int classRole = CLASS_OFF;
+char syncTopic[MAX_TOPIC_LEN], lessonTopic[MAX_TOPIC_LEN];
+char scoreTopic[MAX_TOPIC_LEN];
+portMUX_TYPE classMux = portMUX_INITIALIZER_UNLOCKED;
+unsigned long lastBeacon = 0;
+
+// Student side
+long syncSample[CLASS_SYNC_WINDOW];  // instructor clock less local clock
+int syncCount = 0, syncHead = 0;
+long clockOffset = 0;
+LESSON pending;
+bool newLesson = false;
+
+// Instructor side
+PUPIL pupils[CLASS_PUPILS];
+int pupilCount = 0;
+
+// Called after initWireless() with CLASS_STUDENT or CLASS_INSTRUCTOR
+void startClass(int role) {
+  char base[MAX_TOPIC_LEN];
+  snprintf(base, sizeof(base), "%s%s", cfg.room, CLASS_SUFFIX);
+  snprintf(syncTopic, sizeof(syncTopic), "%ssync", base);
+  snprintf(lessonTopic, sizeof(lessonTopic), "%slesson", base);
+  snprintf(scoreTopic, sizeof(scoreTopic), "%sscore", base);
+  portENTER_CRITICAL(&classMux);
+  syncCount = syncHead = 0;
+  clockOffset = 0;
+  newLesson = false;
+  memset(pupils, 0, sizeof(pupils));
+  pupilCount = 0;
+  portEXIT_CRITICAL(&classMux);
+  lastBeacon = 0;
+  pauseLatency();  // room wide probes grow with the square of the class size
+  classRole = role;
+  if (role == CLASS_INSTRUCTOR) {
+    netSubscribe(scoreTopic);
+  } else {
+    netSubscribe(syncTopic);
+    netSubscribe(lessonTopic);
+  }
+}
+
+// Called before closeWireless()
+void endClass(void) { classRole = CLASS_OFF; }
+
+static void addSyncSample(long sample) {
+  long best;
+  portENTER_CRITICAL(&classMux);
+  syncSample[syncHead] = sample;
+  syncHead = (syncHead + 1) % CLASS_SYNC_WINDOW;
+  if (syncCount < CLASS_SYNC_WINDOW) syncCount++;
+  best = syncSample[0];
+  for (int i = 1; i < syncCount; i++)
+    if (syncSample[i] > best) best = syncSample[i];  // least delayed beacon
+  clockOffset = best;
+  portEXIT_CRITICAL(&classMux);
+}
+
+static void addScore(char *id, char *call, unsigned int seq, bool correct,
+                     unsigned long ms) {
+  PUPIL *p = NULL;
+  if (strlen(id) >= sizeof(p->id)) return;
+  portENTER_CRITICAL(&classMux);
+  for (int i = 0; i < pupilCount && !p; i++)
+    if (!strcmp(pupils[i].id, id)) p = &pupils[i];
+  if (!p && pupilCount < CLASS_PUPILS) {  // new student
+    p = &pupils[pupilCount++];
+    memset(p, 0, sizeof(*p));
+    strcpy(p->id, id);
+  }
+  if (p && (!p->answered || p->lastSeq != seq)) {
+    strncpy(p->call, call, sizeof(p->call) - 1);
+    p->lastSeq = seq;
+    p->answered++;
+    if (correct) p->points++;
+    p->totalMs += ms;
+  }
+  portEXIT_CRITICAL(&classMux);
+}
+
+// Called from MQTTcallback().  Returns true if the message was consumed.
+bool classMessage(char *topic, byte *data, unsigned int len) {
+  char msg[CLASS_MAX_MSG_LEN + 1], *field[7];
+  int n = 0;
+
+  if (classRole == CLASS_OFF) return false;
+  if (strcmp(topic, syncTopic) && strcmp(topic, lessonTopic) &&
+      strcmp(topic, scoreTopic))
+    return false;
+  if (len > CLASS_MAX_MSG_LEN) return true;
+  memcpy(msg, data, len);
+  msg[len] = 0;
+
+  if (!strcmp(topic, syncTopic)) {
+    if (classRole == CLASS_STUDENT)
+      addSyncSample((long)(strtoul(msg, NULL, 10) - millis()));
+    return true;
+  }
+
+  field[n++] = msg;  // split on delimiters; lesson text is the last field
+  for (char *p = msg; *p && n < 7; p++) {
+    if (*p == MQTT_DELIMETER) {
+      *p = 0;
+      field[n++] = p + 1;
+    }
+  }
+
+  if (!strcmp(topic, lessonTopic) && classRole == CLASS_STUDENT) {
+    if (n != 7 || strlen(field[6]) >= sizeof(pending.text)) return true;
+    portENTER_CRITICAL(&classMux);
+    pending.seq = atoi(field[0]);
+    pending.start = strtoul(field[1], NULL, 10);
+    pending.wpm = constrain(atoi(field[2]), MINSPEED, MAXSPEED);
+    pending.fwpm = constrain(atoi(field[3]), MINSPEED, pending.wpm);
+    pending.mode = atoi(field[4]);
+    pending.window = strtoul(field[5], NULL, 10);
+    strcpy(pending.text, field[6]);
+    newLesson = true;
+    portEXIT_CRITICAL(&classMux);
+  } else if (!strcmp(topic, scoreTopic) && classRole == CLASS_INSTRUCTOR) {
+    if (n == 5)
+      addScore(field[0], field[1], atoi(field[2]), atoi(field[3]),
+               strtoul(field[4], NULL, 10));
+  }
+  return true;
+}
+
+// Called from netTask().  The instructor publishes its clock.
+void classPoll(void) {
+  char msg[12];
+  unsigned long now = millis();
+  if (classRole != CLASS_INSTRUCTOR || (now - lastBeacon < CLASS_SYNC_MS))
+    return;
+  lastBeacon = now;
+  snprintf(msg, sizeof(msg), "%lu", now);
+  client.publish(syncTopic, (const uint8_t *)msg, strlen(msg));
+}
+
+// Instructor clock in mS.  Students are only in step once classSynced().
+unsigned long classClock(void) {
+  long offset;
+  portENTER_CRITICAL(&classMux);
+  offset = clockOffset;
+  portEXIT_CRITICAL(&classMux);
+  return millis() + offset;
+}
+
+bool classSynced(void) { return syncCount > 0; }
+
+bool postLesson(LESSON *lesson) {
+  char msg[CLASS_MAX_MSG_LEN];
+  snprintf(msg, sizeof(msg), "%u:%lu:%d:%d:%d:%lu:%s", lesson->seq,
+           lesson->start, lesson->wpm, lesson->fwpm, lesson->mode,
+           lesson->window, lesson->text);
+  return netPublish(lessonTopic, msg, strlen(msg), false);
+}
+
+// True, with a copy of it, if a lesson has arrived since the last call
+bool getLesson(LESSON *lesson) {
+  bool fresh;
+  portENTER_CRITICAL(&classMux);
+  fresh = newLesson;
+  if (fresh) *lesson = pending;
+  newLesson = false;
+  portEXIT_CRITICAL(&classMux);
+  return fresh;
+}
+
+bool postScore(LESSON *lesson, bool correct, unsigned long ms) {
+  char msg[CLASS_MAX_MSG_LEN];
+  snprintf(msg, sizeof(msg), "%s:%s:%u:%d:%lu", localid, myCall, lesson->seq,
+           correct, ms);
+  return netPublish(scoreTopic, msg, strlen(msg), false);
+}
+
+// Students ranked by correct answers, then by average answer time
+int getLeaderboard(PUPIL *list, int max) {
+  int n = 0;
+  portENTER_CRITICAL(&classMux);
+  for (int i = 0; i < pupilCount && n < max; i++) list[n++] = pupils[i];
+  portEXIT_CRITICAL(&classMux);
+  for (int i = 1; i < n; i++) {  // insertion sort: at most CLASS_PUPILS
+    PUPIL p = list[i];
+    int j = i;
+    for (; j > 0; j--) {
+      PUPIL *q = &list[j - 1];
+      if (q->points > p.points) break;
+      if (q->points == p.points &&
+          q->totalMs * p.answered <= p.totalMs * q->answered)
+        break;
+      list[j] = *q;
+    }
+    list[j] = p;
+  }
+  return n;
+}
+
+// Number of students who have answered lesson seq
+int lessonAnswers(unsigned int seq) {
+  int n = 0;
+  portENTER_CRITICAL(&classMux);
+  for (int i = 0; i < pupilCount; i++)
+    if (pupils[i].answered && pupils[i].lastSeq == seq) n++;
+  portEXIT_CRITICAL(&classMux);
+  return n;
+}
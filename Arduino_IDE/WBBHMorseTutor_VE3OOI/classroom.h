@@ -0,0 +1,62 @@
+#ifndef _CLASSROOM_H_
+#define _CLASSROOM_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  Classroom Constants
+//===============================
+// One instructor unit per room drives lessons on every student unit:
+//   "<room>/class/sync"   instructor clock "<millis>" every CLASS_SYNC_MS
+//   "<room>/class/lesson" "<seq>:<start>:<wpm>:<fwpm>:<mode>:<window>:<text>"
+//                         <start> is on the instructor clock, <mode> 1 shows
+//                         the text while sending, 2 is head copy
+//   "<room>/class/score"  "<id>:<call>:<seq>:<correct>:<mS>" from students
+// A lesson is one message however many students are listening, and playback
+// starts at <start> rather than on arrival, so broker fan-out delay does not
+// put students out of step.
+#define CLASS_SUFFIX "/class/"
+#define CLASS_SYNC_MS 1000     // mS between instructor clock beacons
+#define CLASS_SYNC_WINDOW 8    // beacons used by the clock offset filter
+#define CLASS_LEAD 1500        // mS between posting a lesson and playing it
+#define CLASS_ANSWER_MS 12000  // mS students have to key their answer
+#define CLASS_MAX_TEXT 24      // longest lesson text
+#define CLASS_PUPILS 32        // students tracked on the leaderboard
+#define CLASS_MAX_MSG_LEN 64   // longest class message accepted
+
+#define CLASS_OFF 0
+#define CLASS_STUDENT 1
+#define CLASS_INSTRUCTOR 2
+
+typedef struct {
+  unsigned int seq;
+  unsigned long start;   // instructor clock, mS
+  int wpm, fwpm;         // character and overall (Farnsworth) speed
+  int mode;              // 1 = copy text shown, 2 = head copy
+  unsigned long window;  // mS allowed for the answer
+  char text[CLASS_MAX_TEXT];
+} LESSON;
+
+typedef struct {
+  char id[4];                     // connection id (localid) of student
+  char call[MAX_CALLSIGN_STRING];
+  unsigned int points;            // correct answers
+  unsigned int answered;          // lessons answered
+  unsigned long totalMs;          // sum of answer times, for ties
+  unsigned int lastSeq;           // last lesson scored, ignores repeats
+} PUPIL;
+
+// Function Prototypes
+void startClass(int role);
+void endClass(void);
+bool classMessage(char *topic, byte *data, unsigned int len);
+void classPoll(void);
+unsigned long classClock(void);
+bool classSynced(void);
+bool postLesson(LESSON *lesson);
+bool getLesson(LESSON *lesson);
+bool postScore(LESSON *lesson, bool correct, unsigned long ms);
+int getLeaderboard(PUPIL *list, int max);
+int lessonAnswers(unsigned int seq);
+
+#endif  // _CLASSROOM_H_
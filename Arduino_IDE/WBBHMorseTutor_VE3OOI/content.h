@@ -0,0 +1,50 @@
+#ifndef _CONTENT_H_
+#define _CONTENT_H_
+
+// Portable: builds for the ESP32 and for Linux (see tools/qsobot) so that
+// practice text is the same on a tutor and from a bot.
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+
+//===================================  Content Constants
+//=================================
+#define WORD_COUNT 100        // words[]: most common English words
+#define ANTENNA_COUNT 5
+#define WEATHER_COUNT 10
+#define NAME_COUNT 16
+#define CITY_COUNT 11
+#define RIG_COUNT 7
+#define PUNCTUATION_COUNT 16  // sizeof "!@$&()-+=,.:;'/"
+#define PREFIX_COUNT 4        // first letters of US callsigns
+#define CALL_LEN 8            // longest random callsign + 1
+#define RST_LEN 4             // "599" + 1
+#define QSO_LEN 300           // longest generated QSO text + 1
+
+extern char *words[WORD_COUNT];
+extern char *antenna[ANTENNA_COUNT];
+extern char *weather[WEATHER_COUNT];
+extern char *names[NAME_COUNT];
+extern char *cities[CITY_COUNT];
+extern char *rigs[RIG_COUNT];
+extern char punctuation[PUNCTUATION_COUNT];
+extern char prefix[PREFIX_COUNT];
+extern const char qsoGrammar[];  // practice QSOs (grammar.h)
+
+// Function Prototypes
+void addChar(char *str, char ch);
+char randomLetter(void);
+char randomNumber(void);
+void randomCallsign(char *call);
+void randomRST(char *rst);
+void qsoCQ(char *text, int size, const char *from);
+void qsoAnswer(char *text, int size, const char *to, const char *from);
+void qsoExchange(char *text, int size, const char *to, const char *from);
+void qsoSignoff(char *text, int size, const char *to, const char *from);
+
+#ifndef ARDUINO
+long random(long lo, long hi);  // supplied by the host program
+#endif
+
+#endif  // _CONTENT_H_
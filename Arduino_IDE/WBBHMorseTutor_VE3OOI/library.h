@@ -0,0 +1,42 @@
+#ifndef _LIBRARY_H_
+#define _LIBRARY_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  Library Constants
+//=================================
+// Every folder on the card gets a LIB_INDEX file listing its files and
+// folders in order (folders first, then by name), so a page of a folder of
+// any size is read with a few seeks.  The index remembers a signature of the
+// listing it was built from; while a folder is browsed, libraryStale() reads
+// a few directory entries per call and reports when they no longer match.
+// Names beginning with '_' or '.' are hidden, as are the index files.
+#define LIB_INDEX "_INDEX.MTL"     // sorted index, one per folder
+#define LIB_RECORDS "_INDEX.TMP"   // unsorted entries while building
+#define LIB_KEYS "_KEYS.TMP"       // sort keys while building
+#define LIB_MAGIC 0x314C544DUL     // "MTL1": index is complete
+#define LIB_NAME_LEN 256           // longest name (FAT allows 255) + 1
+#define LIB_PATH_LEN 320           // longest path handled + 1
+#define LIB_KEY_LEN 28             // leading name characters used for order
+#define LIB_SORT_BATCH 1024        // entries placed per pass (32K while building)
+#define LIB_CHECK_STEP 4           // entries checked per libraryStale() call
+#define LIB_LIST_CACHE 16          // entries kept when listing without index
+
+typedef struct {
+  bool isDir;
+  unsigned long size;         // bytes, 0 for folders
+  char name[LIB_NAME_LEN];
+} LIB_ENTRY;
+
+// Function Prototypes
+bool libraryOpen(const char *dir);
+int libraryCount(void);
+bool libraryEntry(int i, LIB_ENTRY *e);
+bool libraryStale(void);
+bool libraryRebuild(void);
+void libraryClose(void);
+void libraryJoin(char *path, int size, const char *dir, const char *name);
+void libraryParent(char *dir);
+
+#endif  // _LIBRARY_H_
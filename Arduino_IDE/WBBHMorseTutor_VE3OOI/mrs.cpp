@@ -0,0 +1,30 @@
+/*
+
+  Morse stream (.MRS) records, shared by the tutor and tools/mrs.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+
+#include "morse.h"
+#include "mrs.h"
+
+int mrsRecord(uint8_t *out, char shown, int code)  // returns its length
+{
+  if (code > 0xFF) {
+    out[0] = shown | MRS_LONG;
+    out[1] = code & 0xFF;
+    out[2] = code >> 8;
+    return 3;
+  }
+  out[0] = shown;
+  out[1] = code;
+  return 2;
+}
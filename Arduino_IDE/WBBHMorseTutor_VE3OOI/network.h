@@ -26,17 +26,46 @@
   6  // Only allow 10 character messages xxnxxxx:x (x=alphabetic, n=digit)
 
 
+// Network task.  PubSubClient is only touched from this task once connected.
+#define NET_TASK_STACK 8192   // bytes of stack for netTask(); it also runs
+                              // CLI commands from the web and remote CLI.
+                              // 'P' shows how much has never been used.
+#define NET_TASK_PRIORITY 1   // same as the Arduino loop() task
+#define NET_TASK_CORE 0       // loop() runs on core 1, WiFi stack on core 0
+#define NET_PUMP_MS 10        // client.loop() cadence, mS
+#define NET_TX_BURST 8        // max messages published per pump
+#define NET_FLUSH_WAIT 500    // mS closeWireless() waits for queued output
+#define TX_QUEUE_LEN 32       // outbound messages waiting for netTask()
+#define RX_QUEUE_LEN 256      // received characters waiting for twoWay()
+#define MAX_TOPIC_LEN 48      // room name (MAX_CHAR_STRING) plus suffix
+#define MAX_PAYLOAD_LEN 64    // largest message posted through netPublish()
+
+typedef struct {
+  char topic[MAX_TOPIC_LEN];
+  byte payload[MAX_PAYLOAD_LEN];
+  unsigned char len;
+  bool retain;
+} NET_MSG;
+
 // Added by VE3OOI
 // Function Prototypes
 void MQTTcallback(char *topic, byte *payload, unsigned int len);
-void processMQTT(void);
+void netTask(void *param);
+void startNetTask(void);
+void deviceId(char *id, int size);
+bool netPublish(const char *topic, const void *data, unsigned int len,
+                bool retain);
+bool netSubscribe(const char *topic);
+bool netUnsubscribe(const char *topic);
 
 void enQueue(char ch);
 char deQueue(void);
 void setStatusLED(int color);
+void setPingLED(int color);
 void sendWireless(uint8_t data);
 void closeWireless(void);
-void initWireless(void);
+void startWiFi(void);
+void initWireless(bool announce = true);
 void initializeMem(void);
 
 #endif  // _NETWORK_H_
\ No newline at end of file
@@ -0,0 +1,220 @@
+/*
+
+  Presence heartbeats and room directory.
+
+  Heartbeats are retained so a unit joining a room learns who is there at
+  once, without waiting a full HB_INTERVAL.  Traffic per unit is one short
+  message a minute to its own room, so a broker can carry hundreds of units.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+
+#include "main.h"
+#include "network.h"
+#include "presence.h"
+
+extern PubSubClient client;  // Defined in network.cpp
+extern char localid[10];     // Defined in network.cpp
+extern char myCall[MAX_CALLSIGN_STRING];  // Defined in main.cpp
+extern TUTOR_STRUT cfg;      // Defined in main.cpp
+
+STATION roster[ROSTER_MAX];
+ROOM rooms[ROOMS_MAX];
+portMUX_TYPE presenceMux = portMUX_INITIALIZER_UNLOCKED;
+char hbPrefix[MAX_TOPIC_LEN];  // "<room>/hb/"
+unsigned long lastBeat = 0, joined = 0;
+int publishedCount = -1;  // station count we last put in the directory
+
+// Build heartbeat topic for a station id
+void presenceTopic(char *topic, int size, const char *id) {
+  snprintf(topic, size, "%s%s%s", cfg.room, HB_SUFFIX, id);
+}
+
+static void heartbeat(void) {
+  char topic[MAX_TOPIC_LEN], msg[HB_MAX_MSG_LEN];
+  presenceTopic(topic, sizeof(topic), localid);
+  snprintf(msg, sizeof(msg), "%s,%lu", myCall, (millis() - joined) / 60000);
+  client.publish(topic, (const uint8_t *)msg, strlen(msg), true);
+  lastBeat = millis();
+}
+
+// Called by initWireless() once connected.  The directory of other rooms is
+// only subscribed to (with netSubscribe) while the roster is displayed.
+void initPresence(void) {
+  char topic[MAX_TOPIC_LEN];
+  portENTER_CRITICAL(&presenceMux);
+  memset(roster, 0, sizeof(roster));
+  memset(rooms, 0, sizeof(rooms));
+  portEXIT_CRITICAL(&presenceMux);
+  snprintf(hbPrefix, sizeof(hbPrefix), "%s%s", cfg.room, HB_SUFFIX);
+  publishedCount = -1;
+  joined = millis();
+  snprintf(topic, sizeof(topic), "%s+", hbPrefix);
+  client.subscribe(topic);
+  heartbeat();
+}
+
+// Called from MQTTcallback().  Returns true if the message was consumed.
+bool presenceMessage(char *topic, byte *data, unsigned int len) {
+  char msg[HB_MAX_MSG_LEN], *p;
+  int slot = -1, unused = -1;
+
+  if (len >= sizeof(msg)) len = sizeof(msg) - 1;
+  memcpy(msg, data, len);
+  msg[len] = 0;
+
+  if (!strncmp(topic, DIRECTORY_PREFIX, strlen(DIRECTORY_PREFIX))) {
+    char *name = topic + strlen(DIRECTORY_PREFIX);
+    if (strlen(name) >= sizeof(rooms[0].name)) return true;
+    p = strchr(msg, ',');
+    if (p) *p++ = 0;
+    if (!p || strlen(p) >= sizeof(rooms[0].leader)) p = (char *)"";
+    portENTER_CRITICAL(&presenceMux);
+    for (int i = 0; i < ROOMS_MAX && slot < 0; i++) {
+      if (!rooms[i].stations) {
+        if (unused < 0) unused = i;
+      } else if (!strcmp(rooms[i].name, name)) {
+        slot = i;
+      }
+    }
+    if (slot < 0) {
+      slot = unused;
+      if (slot >= 0) rooms[slot].state = 0;
+    }
+    if (slot >= 0) {
+      strcpy(rooms[slot].name, name);
+      rooms[slot].stations = atoi(msg);  // empty message clears the room
+      if (strcmp(rooms[slot].leader, p) || !rooms[slot].state) {
+        strcpy(rooms[slot].leader, p);   // new writer: watch its heartbeat
+        rooms[slot].state = *p ? ROOM_HEARD : 0;
+      }
+    }
+    portEXIT_CRITICAL(&presenceMux);
+    return true;
+  }
+
+  // Heartbeat of a directory writer tells us whether its entry is still live.
+  // Our own room is also matched below, so do not return here.
+  portENTER_CRITICAL(&presenceMux);
+  for (int i = 0; i < ROOMS_MAX; i++) {
+    int n = strlen(rooms[i].name);
+    if (!rooms[i].stations || !rooms[i].state) continue;
+    if (strncmp(topic, rooms[i].name, n)) continue;
+    if (strncmp(topic + n, HB_SUFFIX, strlen(HB_SUFFIX))) continue;
+    if (strcmp(topic + n + strlen(HB_SUFFIX), rooms[i].leader)) continue;
+    rooms[i].state = len ? ROOM_LIVE : ROOM_WATCHED;
+  }
+  portEXIT_CRITICAL(&presenceMux);
+
+  if (strncmp(topic, hbPrefix, strlen(hbPrefix))) return false;
+  char *id = topic + strlen(hbPrefix);
+  if (strlen(id) >= sizeof(roster[0].id)) return true;
+  portENTER_CRITICAL(&presenceMux);
+  for (int i = 0; i < ROSTER_MAX && slot < 0; i++) {
+    if (!roster[i].seen) {
+      if (unused < 0) unused = i;
+    } else if (!strcmp(roster[i].id, id)) {
+      slot = i;
+    }
+  }
+  if (!len) {  // heartbeat cleared: station has left
+    if (slot >= 0) roster[slot].seen = 0;
+  } else {
+    if (slot < 0) slot = unused;
+    if (slot >= 0) {
+      p = strchr(msg, ',');
+      if (p) *p++ = 0;
+      strcpy(roster[slot].id, id);
+      strncpy(roster[slot].call, msg, sizeof(roster[slot].call) - 1);
+      roster[slot].call[sizeof(roster[slot].call) - 1] = 0;
+      roster[slot].minutes = p ? atoi(p) : 0;
+      roster[slot].seen = millis();
+    }
+  }
+  portEXIT_CRITICAL(&presenceMux);
+  return true;
+}
+
+// Called from netTask().  Sends our heartbeat, expires silent stations and,
+// if we have the lowest id in the room, keeps the directory entry current.
+// Directory writers heard since the last poll have their heartbeat subscribed
+// here rather than in MQTTcallback(), which must not reuse the client buffer.
+// These subscriptions go with the connection when the roster is closed.
+void presencePoll(void) {
+  char topic[MAX_TOPIC_LEN], msg[HB_MAX_MSG_LEN];
+  int count = 0;
+  bool leader = true;
+  unsigned long now = millis();
+
+  if (now - lastBeat >= HB_INTERVAL) heartbeat();
+
+  for (int i = 0; i < ROOMS_MAX; i++) {
+    topic[0] = 0;
+    portENTER_CRITICAL(&presenceMux);
+    if (rooms[i].stations && rooms[i].state == ROOM_HEARD) {
+      snprintf(topic, sizeof(topic), "%s%s%s", rooms[i].name, HB_SUFFIX,
+               rooms[i].leader);
+      rooms[i].state = ROOM_WATCHED;
+    }
+    portEXIT_CRITICAL(&presenceMux);
+    if (topic[0]) client.subscribe(topic);
+  }
+
+  portENTER_CRITICAL(&presenceMux);
+  for (int i = 0; i < ROSTER_MAX; i++) {
+    if (!roster[i].seen) continue;
+    if (now - roster[i].seen > HB_EXPIRE) {
+      roster[i].seen = 0;
+      continue;
+    }
+    count++;
+    if (strcmp(roster[i].id, localid) < 0) leader = false;
+  }
+  portEXIT_CRITICAL(&presenceMux);
+
+  if (!leader || !count || count == publishedCount) return;
+  snprintf(topic, sizeof(topic), "%s%s", DIRECTORY_PREFIX, cfg.room);
+  snprintf(msg, sizeof(msg), "%d,%s", count, localid);
+  client.publish(topic, (const uint8_t *)msg, strlen(msg), true);
+  publishedCount = count;
+}
+
+// Called by closeWireless() before disconnecting
+void leavePresence(void) {
+  char topic[MAX_TOPIC_LEN];
+  int others = 0;
+  for (int i = 0; i < ROSTER_MAX; i++)
+    if (roster[i].seen && strcmp(roster[i].id, localid)) others++;
+  presenceTopic(topic, sizeof(topic), localid);
+  client.publish(topic, (const uint8_t *)"", 0, true);  // clear heartbeat
+  if (!others) {  // last one out clears the room from the directory
+    snprintf(topic, sizeof(topic), "%s%s", DIRECTORY_PREFIX, cfg.room);
+    client.publish(topic, (const uint8_t *)"", 0, true);
+  }
+}
+
+// Snapshot of stations in our room for display
+int getRoster(STATION *list, int max) {
+  int n = 0;
+  portENTER_CRITICAL(&presenceMux);
+  for (int i = 0; i < ROSTER_MAX && n < max; i++)
+    if (roster[i].seen) list[n++] = roster[i];
+  portEXIT_CRITICAL(&presenceMux);
+  return n;
+}
+
+// Snapshot of active rooms from the directory for display.  Entries whose
+// writer has no heartbeat are left over from a room that dropped off.
+int getRooms(ROOM *list, int max) {
+  int n = 0;
+  portENTER_CRITICAL(&presenceMux);
+  for (int i = 0; i < ROOMS_MAX && n < max; i++)
+    if (rooms[i].stations && rooms[i].state == ROOM_LIVE) list[n++] = rooms[i];
+  portEXIT_CRITICAL(&presenceMux);
+  return n;
+}
@@ -0,0 +1,214 @@
+/*
+
+  Double buffered SD card reader for file playback.
+
+  The file is only touched by readerTask(), or by the caller while holding
+  readerLock.  Blocks pass between the two through their full flags: the task
+  fills a block and sets it, readerGet() empties it, clears it and wakes the
+  task to read the next one.  Skips and rewinds are seeks; a target still in
+  the block being played costs nothing.
+
+  At the end of the file the task goes straight on to a queued file, marking
+  its first block so readerGet() can report where one file ends and the next
+  begins.  Until that mark is reached the caller is still playing the old
+  file: a seek then reopens it and queues the new one again.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "main.h"
+#include "storage.h"
+#include "reader.h"
+
+typedef struct {
+  char data[READER_BLOCK];
+  long offset;  // file position of data[0]
+  int len;      // bytes in data[], 0 = end of file
+  bool starts;  // first block of a queued file
+  bool full;    // set by readerTask(), cleared by readerGet()
+} READ_BLOCK;
+
+READ_BLOCK blocks[2];
+File readerFile;
+SemaphoreHandle_t readerLock = NULL;  // held while touching readerFile
+TaskHandle_t readerTaskHandle = NULL;
+int fillNext = 0;          // readerTask(): next block to fill
+bool readerAtEnd = false;  // readerTask(): end of file block queued
+int readBlock = 0;         // readerGet(): block being played
+int readIndex = 0;         // readerGet(): next byte in that block
+long readPos = 0;          // file position of the next readerGet() byte
+char readerPath[2][LIB_PATH_LEN];  // file being played and the one after
+int playSlot = 0;          // readerPath[] that readerGet() is playing
+int fileSlot = 0;          // readerPath[] that readerFile is
+bool queued = false;       // readerPath[fileSlot ^ 1] is waiting to be read
+
+void readerTask(void *param) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // open, seek or block emptied
+    for (bool filled = true; filled;) {       // fill every empty block
+      xSemaphoreTake(readerLock, portMAX_DELAY);
+      READ_BLOCK *b = &blocks[fillNext];
+      filled = readerFile && !readerAtEnd &&
+               !__atomic_load_n(&b->full, __ATOMIC_ACQUIRE);
+      if (filled) {
+        b->offset = readerFile.position();
+        int n = readerFile.read((uint8_t *)b->data, READER_BLOCK);
+        b->len = n > 0 ? n : 0;
+        b->starts = false;
+        if (!b->len && queued) {  // carry straight on with the next file
+          readerFile.close();
+          fileSlot ^= 1;
+          queued = false;
+          readerFile = store().open(readerPath[fileSlot]);
+          n = readerFile ? readerFile.read((uint8_t *)b->data, READER_BLOCK) : 0;
+          b->offset = 0;
+          b->len = n > 0 ? n : 0;
+          b->starts = true;
+        }
+        readerAtEnd = !b->len;  // an empty block marks the end
+        __atomic_store_n(&b->full, true, __ATOMIC_RELEASE);
+        fillNext ^= 1;
+      }
+      xSemaphoreGive(readerLock);
+    }
+  }
+}
+
+static void startReaderTask(void) {
+  if (readerTaskHandle) return;  // only ever one reader task
+  readerLock = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(readerTask, "reader", READER_TASK_STACK, NULL,
+                          READER_TASK_PRIORITY, &readerTaskHandle,
+                          READER_TASK_CORE);
+}
+
+// If the task has moved on to the queued file, go back to the one being
+// played and queue the other again.  Caller holds readerLock.
+static void backToPlaying(void) {
+  if (fileSlot == playSlot) return;
+  if (readerFile) readerFile.close();
+  fileSlot = playSlot;
+  queued = true;
+  readerFile = store().open(readerPath[fileSlot]);
+}
+
+// Drop both blocks and refill from "where".  Caller holds readerLock.
+static void restart(long where) {
+  backToPlaying();
+  if (readerFile) readerFile.seek(where);
+  __atomic_store_n(&blocks[0].full, false, __ATOMIC_RELEASE);
+  __atomic_store_n(&blocks[1].full, false, __ATOMIC_RELEASE);
+  fillNext = readBlock = readIndex = 0;
+  readerAtEnd = false;
+  readPos = where;
+}
+
+bool readerOpen(const char *path) {
+  startReaderTask();
+  xSemaphoreTake(readerLock, portMAX_DELAY);
+  if (readerFile) readerFile.close();
+  strncpy(readerPath[0], path, LIB_PATH_LEN - 1);
+  playSlot = fileSlot = 0;
+  queued = false;
+  readerFile = store().open(path);
+  restart(0);
+  bool ok = readerFile;
+  xSemaphoreGive(readerLock);
+  if (ok) xTaskNotifyGive(readerTaskHandle);
+  return ok;
+}
+
+// Play this file next, without a gap, once the open one has been read
+void readerQueue(const char *path) {
+  if (!readerTaskHandle) return;
+  xSemaphoreTake(readerLock, portMAX_DELAY);
+  strncpy(readerPath[playSlot ^ 1], path, LIB_PATH_LEN - 1);
+  queued = true;
+  bool waiting = readerAtEnd;  // already read to the end of the open file
+  if (waiting) {
+    readerAtEnd = false;
+    // the empty end block has not been played yet: read the new file into it
+    __atomic_store_n(&blocks[fillNext ^ 1].full, false, __ATOMIC_RELEASE);
+    fillNext ^= 1;
+  }
+  xSemaphoreGive(readerLock);
+  if (waiting) xTaskNotifyGive(readerTaskHandle);
+}
+
+// Next byte of the file, READER_EOF at the end or READER_WAIT if the card
+// has not caught up (only right after opening or seeking).  READER_NEXT
+// means the rest comes from the queued file.
+int readerGet(void) {
+  READ_BLOCK *b = &blocks[readBlock];
+  if (!__atomic_load_n(&b->full, __ATOMIC_ACQUIRE)) return READER_WAIT;
+  if (b->starts) {  // first byte of the queued file is next
+    xSemaphoreTake(readerLock, portMAX_DELAY);
+    b->starts = false;
+    playSlot = fileSlot;
+    readPos = 0;
+    xSemaphoreGive(readerLock);
+    return READER_NEXT;
+  }
+  if (!b->len) return READER_EOF;
+  unsigned char ch = b->data[readIndex++];
+  readPos++;
+  if (readIndex >= b->len) {  // played out: hand it back for the next block
+    readIndex = 0;
+    readBlock ^= 1;
+    __atomic_store_n(&b->full, false, __ATOMIC_RELEASE);
+    xTaskNotifyGive(readerTaskHandle);
+  }
+  return ch;
+}
+
+void readerSeek(long where) {
+  if (!readerTaskHandle) return;
+  READ_BLOCK *b = &blocks[readBlock];
+  if (where < 0) where = 0;
+  if (__atomic_load_n(&b->full, __ATOMIC_ACQUIRE) && !b->starts &&
+      where >= b->offset &&
+      where < b->offset + b->len) {  // still in the block being played
+    readIndex = where - b->offset;
+    readPos = where;
+    return;
+  }
+  xSemaphoreTake(readerLock, portMAX_DELAY);
+  backToPlaying();
+  if (readerFile && where > (long)readerFile.size())
+    where = readerFile.size();
+  restart(where);
+  xSemaphoreGive(readerLock);
+  xTaskNotifyGive(readerTaskHandle);
+}
+
+void readerSkip(long count)  // forward, or back if count is negative
+{
+  readerSeek(readPos + count);
+}
+
+long readerPosition(void) { return readPos; }
+
+long readerSize(void)  // of the file being read (the queued one once reached)
+{
+  long size = 0;
+  if (!readerTaskHandle) return 0;
+  xSemaphoreTake(readerLock, portMAX_DELAY);
+  if (readerFile) size = readerFile.size();
+  xSemaphoreGive(readerLock);
+  return size;
+}
+
+void readerClose(void) {
+  if (!readerTaskHandle) return;
+  xSemaphoreTake(readerLock, portMAX_DELAY);
+  if (readerFile) readerFile.close();
+  fileSlot = playSlot;
+  queued = false;
+  restart(0);
+  xSemaphoreGive(readerLock);
+}
@@ -0,0 +1,35 @@
+#ifndef _READER_H_
+#define _READER_H_
+
+#include <Arduino.h>
+#include "main.h"
+#include "library.h"
+
+//===================================  SD Reader Constants
+//===============================
+// readerTask() keeps two READER_BLOCK buffers filled ahead of readerGet(), so
+// playback takes bytes from RAM while the next block is read from the card.
+// A file queued with readerQueue() is opened as soon as the current one has
+// been read, so its first block is waiting when the last one is played.
+// Each block is read in one call; the SPI library's transactions keep it from
+// interleaving with the display, which shares the bus.  The flash store (see
+// storage.h) is read the same way, without the bus.
+#define READER_BLOCK 1024       // bytes per buffer: two SD sectors
+#define READER_TASK_STACK 3072  // bytes of stack for readerTask()
+#define READER_TASK_PRIORITY 2  // above loop(): a refill is never kept waiting
+#define READER_TASK_CORE 0      // loop() and the display run on core 1
+#define READER_EOF -1           // readerGet(): no more text
+#define READER_WAIT -2          // readerGet(): next block not read yet
+#define READER_NEXT -3          // readerGet(): the queued file starts here
+
+// Function Prototypes
+bool readerOpen(const char *path);
+void readerQueue(const char *path);
+int readerGet(void);
+void readerSeek(long where);
+void readerSkip(long count);
+long readerPosition(void);
+long readerSize(void);
+void readerClose(void);
+
+#endif  // _READER_H_
@@ -0,0 +1,159 @@
+/*
+
+  Remote configuration over MQTT.
+
+  Lets a club or classroom organizer change Wi-Fi, server and room settings
+  on units in the field without a USB cable.  Commands run in netTask(), so
+  only quick configuration commands are allowed and nothing that reconnects.
+  Keys are never shown or changed remotely.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+#include <mbedtls/md.h>
+
+#include "main.h"
+#include "network.h"
+#include "remotecli.h"
+
+#ifndef REMOVE_CLI
+
+extern PubSubClient client;  // Defined in network.cpp
+extern TUTOR_STRUT cfg;      // Defined in main.cpp
+extern Print *cliOut;        // Defined in main.cpp
+extern bool cliActive;       // Defined in main.cpp
+
+char cmdTopic[MAX_TOPIC_LEN];
+char replyTopic[MAX_TOPIC_LEN];
+char challenge[2 * CHALLENGE_BYTES + 1];
+unsigned long lastSeq = 0;  // highest seq accepted this session
+
+ReplyBuffer::ReplyBuffer(const char *topic, unsigned long seq) {
+  this->topic = topic;
+  prefix = len = snprintf(text, sizeof(text), "%lu ", seq);
+}
+
+size_t ReplyBuffer::write(uint8_t ch) {
+  if (len - prefix >= REMOTE_CHUNK) flush();
+  text[len++] = ch;
+  return 1;
+}
+
+void ReplyBuffer::flush(void) {
+  if (len > prefix)
+    client.publish(topic, (const uint8_t *)text, len);  // netLock is held
+  len = prefix;
+}
+
+void ReplyBuffer::finish(const char *status) {
+  flush();
+  len = prefix + snprintf(text + prefix, sizeof(text) - prefix, "%s", status);
+  flush();
+}
+
+static void toHex(char *hex, const unsigned char *bytes, int n) {
+  for (int i = 0; i < n; i++) sprintf(hex + 2 * i, "%02x", bytes[i]);
+}
+
+// Whether a command line may run off the unit, from here or the web page
+// (webhooks.cpp).  Both run it on netTask, so only commands that leave the
+// running config alone are let through.
+bool remoteAllowed(char *command) {
+  char cmd = toupper(command[0]);
+  return cmd && strchr(REMOTE_COMMANDS, cmd) &&
+         !(cmd == 'N' && cliArgument(command, 1));  // 'N R' reconnects
+}
+
+// Lowercase hex HMAC-SHA256 of text under the CLI key.  Also used to check
+// browsers unlocking the web page (webhooks.cpp).
+bool keyMac(const char *text, int len, char *hex) {
+  unsigned char digest[HMAC_BYTES];
+  if (mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256),
+                      (const unsigned char *)cfg.cli_key, strlen(cfg.cli_key),
+                      (const unsigned char *)text, len, digest))
+    return false;
+  toHex(hex, digest, HMAC_BYTES);
+  return true;
+}
+
+// True if mac is the HMAC of "<challenge>:<seq>:<command>" under our key.
+// Compares every character so timing does not reveal how much matched.
+static bool authentic(const char *mac, unsigned long seq, const char *command) {
+  char signed_[REMOTE_MAX_MSG_LEN + sizeof(challenge) + 16];
+  char expect[2 * HMAC_BYTES + 1];
+  unsigned char diff = 0;
+
+  if (strlen(mac) != 2 * HMAC_BYTES) return false;
+  int n = snprintf(signed_, sizeof(signed_), "%s:%lu:%s", challenge, seq,
+                   command);
+  if (!keyMac(signed_, n, expect)) return false;
+  for (int i = 0; i < 2 * HMAC_BYTES; i++) diff |= mac[i] ^ expect[i];
+  return !diff;
+}
+
+// Called by initWireless() once connected, if a CLI key is set
+void initRemoteCLI(void) {
+  char dev[MAX_TOPIC_LEN], topic[MAX_TOPIC_LEN];
+  unsigned char bytes[CHALLENGE_BYTES];
+
+  cmdTopic[0] = 0;
+  if (!cfg.cli_key[0]) return;
+  deviceId(dev, sizeof(dev));
+  snprintf(cmdTopic, sizeof(cmdTopic), "%s%s", REMOTE_PREFIX, dev);
+  snprintf(replyTopic, sizeof(replyTopic), "%s%s", cmdTopic, REPLY_SUFFIX);
+  snprintf(topic, sizeof(topic), "%s%s", cmdTopic, CHALLENGE_SUFFIX);
+  for (int i = 0; i < CHALLENGE_BYTES; i++) bytes[i] = esp_random();
+  toHex(challenge, bytes, CHALLENGE_BYTES);
+  lastSeq = 0;
+  client.publish(topic, (const uint8_t *)challenge, strlen(challenge), true);
+  client.subscribe(cmdTopic);
+}
+
+// Called from MQTTcallback().  Returns true if the message was consumed.
+bool remoteMessage(char *topic, byte *data, unsigned int len) {
+  char msg[REMOTE_MAX_MSG_LEN + 1], *mac, *command;
+  unsigned long seq;
+
+  if (!cmdTopic[0] || strcmp(topic, cmdTopic)) return false;
+  if (len > REMOTE_MAX_MSG_LEN) return true;
+  memcpy(msg, data, len);
+  msg[len] = 0;
+
+  seq = strtoul(msg, &mac, 10);
+  if (*mac != ' ') return true;
+  mac++;
+  command = strchr(mac, ' ');
+  if (command == NULL) return true;
+  *command++ = 0;
+
+  ReplyBuffer reply(replyTopic, seq);
+  if (seq <= lastSeq || !authentic(mac, seq, command)) {
+    Serial.println("Remote CLI: rejected command");
+    reply.finish("ERR auth");
+    return true;
+  }
+  lastSeq = seq;  // only after the MAC checks out
+
+  if (!remoteAllowed(command)) {
+    reply.finish("ERR denied");
+    return true;
+  }
+  if (cliActive) {  // serial CLI owns the command buffers
+    reply.finish("ERR busy");
+    return true;
+  }
+
+  Serial.print("Remote CLI: ");
+  Serial.println(command);
+  cliOut = &reply;
+  executeSerial(command);
+  cliOut = &Serial;
+  reply.finish("OK");
+  return true;
+}
+
+#endif  // REMOVE_CLI
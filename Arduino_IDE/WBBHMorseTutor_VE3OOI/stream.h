@@ -0,0 +1,34 @@
+#ifndef _STREAM_H_
+#define _STREAM_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  File Streaming Constants
+//=========================
+// A unit sending an SD file publishes chunks "<id>:<seq>:<text>" on
+// "<room>/file".  Every receiver reports the free space in its receive queue
+// as "<id>:<free>" on "<room>/flow/<sender id>", so only the sender sees the
+// reports.  The sender never publishes more than the smallest reported space.
+// When the sender skips or jumps, its next chunk is "<id>:S<seq>:<text>":
+// receivers drop the text still queued from before the jump.
+#define FILE_SUFFIX "/file"     // appended to room name for file chunks
+#define FLOW_SUFFIX "/flow/"    // appended to room name for queue reports
+#define STREAM_CHUNK 24         // characters per published chunk
+#define STREAM_AHEAD 96         // max chars published ahead of local audio
+#define STREAM_PEERS 16         // receivers tracked by a sender
+#define STREAM_PEER_TIMEOUT 6000  // mS without a report before peer is dropped
+#define STREAM_IDLE 5000        // mS after last chunk a receiver stops reporting
+#define STREAM_REPORT_MS 3000   // mS between unchanged queue reports
+#define STREAM_REPORT_DELTA 12  // queue change that forces an early report
+#define STREAM_BOOTSTRAP (2 * STREAM_CHUNK)  // sent before anyone reports
+
+// Function Prototypes
+void initStream(void);
+bool streamMessage(char *topic, byte *data, unsigned int len);
+void streamPoll(void);
+bool streamCanSend(int len);
+bool streamChunk(char *text, int len);
+bool streamSeek(void);
+
+#endif  // _STREAM_H_
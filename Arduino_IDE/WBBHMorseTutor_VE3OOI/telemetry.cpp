@@ -0,0 +1,105 @@
+/*
+
+  Fleet telemetry: periodic health and performance records.
+
+  Samples are cheap (a few counters copied into a small array) and are kept
+  while the unit is offline.  The latest TELEMETRY_BATCH samples go out in a
+  single message the next time the unit is connected and idle.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+
+#include "main.h"
+#include "network.h"
+#include "latency.h"
+#include "telemetry.h"
+
+extern PubSubClient client;              // Defined in network.cpp
+extern QueueHandle_t txQueue;            // Defined in network.cpp
+extern SemaphoreHandle_t netLock;        // Defined in network.cpp
+extern unsigned long rxDrops, txDrops;   // Defined in network.cpp
+extern int activity;                     // Defined in main.cpp
+extern TUTOR_STRUT cfg;                  // Defined in main.cpp
+
+TELEMETRY batch[TELEMETRY_BATCH];
+int batched = 0;
+unsigned long lastSample = 0, lastPublish = 0;
+uint16_t connects = 0, connectFails = 0;
+
+// Keydown timing, accumulated by the UI task between samples
+portMUX_TYPE elementMux = portMUX_INITIALIZER_UNLOCKED;
+long errorSum = 0;
+unsigned long worstError = 0;
+unsigned int elementCount = 0;
+
+// Called by dit() and dah() with the requested and measured keydown time
+void noteElement(int intendedMs, unsigned long actualUs) {
+  long error = (long)actualUs - (long)intendedMs * 1000L;
+  portENTER_CRITICAL(&elementMux);
+  errorSum += error;
+  if ((unsigned long)abs(error) > worstError) worstError = abs(error);
+  if (elementCount < 0xFFFF) elementCount++;
+  portEXIT_CRITICAL(&elementMux);
+}
+
+// Called by initWireless() with the outcome of each connection attempt
+void noteConnect(bool ok) {
+  if (ok)
+    connects++;
+  else
+    connectFails++;
+}
+
+static void takeSample(void) {
+  TELEMETRY *t;
+  if (batched == TELEMETRY_BATCH) {  // keep the most recent samples
+    memmove(&batch[0], &batch[1], sizeof(batch[0]) * (TELEMETRY_BATCH - 1));
+    batched--;
+  }
+  t = &batch[batched++];
+  t->version = TELEMETRY_VERSION;
+  t->mode = activity;
+  t->uptime = millis() / 1000;
+  t->freeHeap = ESP.getFreeHeap();
+  t->minHeap = ESP.getMinFreeHeap();
+  t->rxDrops = rxDrops;
+  t->txDrops = txDrops;
+  t->connects = connects;
+  t->connectFails = connectFails;
+  portENTER_CRITICAL(&elementMux);
+  t->elements = elementCount;
+  t->meanError = elementCount ? errorSum / (long)elementCount : 0;
+  t->maxError = min(worstError, 0xFFFFUL);
+  errorSum = 0;
+  worstError = 0;
+  elementCount = 0;
+  portEXIT_CRITICAL(&elementMux);
+  t->rtt = pingAverage();
+}
+
+// Called from netTask() whether or not we are connected
+void telemetryPoll(void) {
+  char topic[MAX_TOPIC_LEN], dev[MAX_TOPIC_LEN];
+  unsigned long now = millis();
+  if (now - lastSample >= TELEMETRY_SAMPLE_MS) {
+    lastSample = now;
+    takeSample();
+  }
+  if (!batched || !(cfg.conflag & SRV_CONNECTED)) return;
+  if (lastPublish && (now - lastPublish < TELEMETRY_MIN_GAP)) return;
+  if (uxQueueMessagesWaiting(txQueue)) return;  // two-way traffic goes first
+
+  deviceId(dev, sizeof(dev));
+  snprintf(topic, sizeof(topic), "%s%s", METRICS_PREFIX, dev);
+  xSemaphoreTake(netLock, portMAX_DELAY);
+  if (cfg.conflag & SRV_CONNECTED)
+    client.publish(topic, (const uint8_t *)batch, sizeof(batch[0]) * batched);
+  xSemaphoreGive(netLock);
+  batched = 0;
+  lastPublish = now;
+}
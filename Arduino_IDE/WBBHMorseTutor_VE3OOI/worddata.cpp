@@ -0,0 +1,963 @@
+/*
+
+  Practice words built into the tutor, weighted by rank.  The list has no
+  counts, so the n'th word is taken to be used 1/n as often as the first.
+
+  Made by tools/words/wordgen -c from:
+    common.txt
+  Do not edit: change the list and run it again.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+
+#include "wordlist.h"
+
+// 508 words in 11247 bytes
+const uint8_t wordListData[] = {
+    0x4d, 0x54, 0x57, 0x32, 0xfc, 0x01, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+    0x22, 0x20, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x79, 0x00, 0x00,
+    0xbe, 0x5f, 0x01, 0x00, 0x48, 0x86, 0x02, 0x00, 0x2e, 0x9f, 0x03, 0x00,
+    0x94, 0xd5, 0x04, 0x00, 0x77, 0x86, 0x05, 0x00, 0x0d, 0x7d, 0x06, 0x00,
+    0x92, 0x3c, 0x07, 0x00, 0x48, 0x41, 0x08, 0x00, 0x67, 0x52, 0x09, 0x00,
+    0x40, 0x46, 0x0a, 0x00, 0x36, 0xd0, 0x0b, 0x00, 0xc8, 0x32, 0x0c, 0x00,
+    0xe0, 0xd4, 0x0d, 0x00, 0x7d, 0x2c, 0x0e, 0x00, 0x2c, 0xaa, 0x0f, 0x00,
+    0x1b, 0x9b, 0x10, 0x00, 0xfe, 0xcb, 0x11, 0x00, 0x39, 0x60, 0x12, 0x00,
+    0xda, 0xfd, 0x13, 0x00, 0xbf, 0xf3, 0x14, 0x00, 0xf5, 0x3c, 0x15, 0x00,
+    0x49, 0x83, 0x16, 0x00, 0x02, 0xed, 0x17, 0x00, 0xca, 0x9f, 0x18, 0x00,
+    0x50, 0x70, 0x19, 0x00, 0x61, 0x5c, 0x1a, 0x00, 0x10, 0x62, 0x1b, 0x00,
+    0x99, 0x7f, 0x1c, 0x00, 0x69, 0xb3, 0x1d, 0x00, 0x19, 0xfc, 0x1e, 0x00,
+    0xbb, 0x7f, 0x1f, 0x00, 0x41, 0xee, 0x20, 0x00, 0x43, 0x95, 0x21, 0x00,
+    0x64, 0x4c, 0x22, 0x00, 0xd1, 0xeb, 0x23, 0x00, 0xb0, 0xc0, 0x24, 0x00,
+    0x3b, 0xa3, 0x25, 0x00, 0xba, 0x92, 0x26, 0x00, 0x8b, 0x8e, 0x27, 0x00,
+    0x16, 0x96, 0x28, 0x00, 0xce, 0xa8, 0x29, 0x00, 0x2e, 0xc6, 0x2a, 0x00,
+    0xb8, 0xed, 0x2b, 0x00, 0x42, 0x45, 0x2c, 0x00, 0xbe, 0x7f, 0x2d, 0x00,
+    0x26, 0xc3, 0x2e, 0x00, 0x38, 0x35, 0x2f, 0x00, 0x48, 0x89, 0x30, 0x00,
+    0x37, 0xe5, 0x31, 0x00, 0xb4, 0x6e, 0x32, 0x00, 0x6b, 0xd9, 0x33, 0x00,
+    0x0a, 0x71, 0x34, 0x00, 0x6f, 0xe9, 0x35, 0x00, 0x28, 0x8e, 0x36, 0x00,
+    0x13, 0x39, 0x37, 0x00, 0x2a, 0xc4, 0x38, 0x00, 0xd8, 0x7a, 0x39, 0x00,
+    0x1a, 0x37, 0x3a, 0x00, 0x06, 0xd3, 0x3b, 0x00, 0xe7, 0x99, 0x3c, 0x00,
+    0xd2, 0x65, 0x3d, 0x00, 0xa2, 0x36, 0x3e, 0x00, 0x83, 0xe6, 0x3f, 0x00,
+    0xaa, 0xc0, 0x40, 0x00, 0x44, 0x9f, 0x41, 0x00, 0x2f, 0x82, 0x42, 0x00,
+    0x4e, 0x69, 0x43, 0x00, 0x7e, 0x54, 0x44, 0x00, 0xa3, 0x43, 0x45, 0x00,
+    0x9e, 0x36, 0x46, 0x00, 0x58, 0x2d, 0x47, 0x00, 0xb3, 0x27, 0x48, 0x00,
+    0xac, 0xfe, 0x00, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0x10, 0xf8, 0x00, 0x00,
+    0xdf, 0xf4, 0x00, 0x00, 0xc7, 0xf1, 0x00, 0x00, 0xc3, 0xee, 0x00, 0x00,
+    0xcd, 0xeb, 0x00, 0x00, 0xef, 0xe8, 0x00, 0x00, 0x20, 0xe6, 0x00, 0x00,
+    0x60, 0xe3, 0x00, 0x00, 0xb4, 0xe0, 0x00, 0x00, 0x16, 0xde, 0x00, 0x00,
+    0x8b, 0xdb, 0x00, 0x00, 0x0b, 0xd9, 0x00, 0x00, 0x99, 0xd6, 0x00, 0x00,
+    0x3b, 0xd4, 0x00, 0x00, 0xe6, 0xd1, 0x00, 0x00, 0x9b, 0xcf, 0x00, 0x00,
+    0x5f, 0xcd, 0x00, 0x00, 0x32, 0xcb, 0x00, 0x00, 0x0e, 0xc9, 0x00, 0x00,
+    0xf4, 0xc6, 0x00, 0x00, 0xe9, 0xc4, 0x00, 0x00, 0xe7, 0xc2, 0x00, 0x00,
+    0xf0, 0xc0, 0x00, 0x00, 0x02, 0xbf, 0x00, 0x00, 0x19, 0xbd, 0x00, 0x00,
+    0x3f, 0xbb, 0x00, 0x00, 0x6e, 0xb9, 0x00, 0x00, 0xa7, 0xb7, 0x00, 0x00,
+    0xe5, 0xb5, 0x00, 0x00, 0x2d, 0xb4, 0x00, 0x00, 0x7f, 0xb2, 0x00, 0x00,
+    0xdb, 0xb0, 0x00, 0x00, 0x3b, 0xaf, 0x00, 0x00, 0xa0, 0xad, 0x00, 0x00,
+    0x14, 0xac, 0x00, 0x00, 0x88, 0xaa, 0x00, 0x00, 0x06, 0xa9, 0x00, 0x00,
+    0x88, 0xa7, 0x00, 0x00, 0x15, 0xa6, 0x00, 0x00, 0xa6, 0xa4, 0x00, 0x00,
+    0x41, 0xa3, 0x00, 0x00, 0xdc, 0xa1, 0x00, 0x00, 0x81, 0xa0, 0x00, 0x00,
+    0x2b, 0x9f, 0x00, 0x00, 0xd9, 0x9d, 0x00, 0x00, 0x8d, 0x9c, 0x00, 0x00,
+    0x4a, 0x9b, 0x00, 0x00, 0x07, 0x9a, 0x00, 0x00, 0xce, 0x98, 0x00, 0x00,
+    0x95, 0x97, 0x00, 0x00, 0x66, 0x96, 0x00, 0x00, 0x37, 0x95, 0x00, 0x00,
+    0x0d, 0x94, 0x00, 0x00, 0xec, 0x92, 0x00, 0x00, 0xcc, 0x91, 0x00, 0x00,
+    0xb0, 0x90, 0x00, 0x00, 0x99, 0x8f, 0x00, 0x00, 0x88, 0x8e, 0x00, 0x00,
+    0x7b, 0x8d, 0x00, 0x00, 0x6e, 0x8c, 0x00, 0x00, 0x6a, 0x8b, 0x00, 0x00,
+    0x67, 0x8a, 0x00, 0x00, 0x69, 0x89, 0x00, 0x00, 0x6b, 0x88, 0x00, 0x00,
+    0x76, 0x87, 0x00, 0x00, 0x82, 0x86, 0x00, 0x00, 0x92, 0x85, 0x00, 0x00,
+    0xa3, 0x84, 0x00, 0x00, 0xb8, 0x83, 0x00, 0x00, 0xd2, 0x82, 0x00, 0x00,
+    0xec, 0x81, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x00,
+    0x53, 0x7f, 0x00, 0x00, 0x7c, 0x7e, 0x00, 0x00, 0xa5, 0x7d, 0x00, 0x00,
+    0xd3, 0x7c, 0x00, 0x00, 0x05, 0x7c, 0x00, 0x00, 0x38, 0x7b, 0x00, 0x00,
+    0x6f, 0x7a, 0x00, 0x00, 0xa7, 0x79, 0x00, 0x00, 0xe3, 0x78, 0x00, 0x00,
+    0x20, 0x78, 0x00, 0x00, 0x61, 0x77, 0x00, 0x00, 0xa2, 0x76, 0x00, 0x00,
+    0xe4, 0x75, 0x00, 0x00, 0x2a, 0x75, 0x00, 0x00, 0x75, 0x74, 0x00, 0x00,
+    0xc0, 0x73, 0x00, 0x00, 0x10, 0x73, 0x00, 0x00, 0x60, 0x72, 0x00, 0x00,
+    0xb0, 0x71, 0x00, 0x00, 0x05, 0x71, 0x00, 0x00, 0x5a, 0x70, 0x00, 0x00,
+    0xae, 0x6f, 0x00, 0x00, 0x08, 0x6f, 0x00, 0x00, 0x67, 0x6e, 0x00, 0x00,
+    0xc5, 0x6d, 0x00, 0x00, 0x24, 0x6d, 0x00, 0x00, 0x83, 0x6c, 0x00, 0x00,
+    0xe6, 0x6b, 0x00, 0x00, 0x4a, 0x6b, 0x00, 0x00, 0xb2, 0x6a, 0x00, 0x00,
+    0x1b, 0x6a, 0x00, 0x00, 0x83, 0x69, 0x00, 0x00, 0xf0, 0x68, 0x00, 0x00,
+    0x5e, 0x68, 0x00, 0x00, 0xcb, 0x67, 0x00, 0x00, 0x3d, 0x67, 0x00, 0x00,
+    0xaf, 0x66, 0x00, 0x00, 0x21, 0x66, 0x00, 0x00, 0x99, 0x65, 0x00, 0x00,
+    0x10, 0x65, 0x00, 0x00, 0x87, 0x64, 0x00, 0x00, 0xfe, 0x63, 0x00, 0x00,
+    0x7a, 0x63, 0x00, 0x00, 0xf6, 0x62, 0x00, 0x00, 0x72, 0x62, 0x00, 0x00,
+    0xf3, 0x61, 0x00, 0x00, 0x73, 0x61, 0x00, 0x00, 0xf4, 0x60, 0x00, 0x00,
+    0x75, 0x60, 0x00, 0x00, 0xfb, 0x5f, 0x00, 0x00, 0x81, 0x5f, 0x00, 0x00,
+    0x06, 0x5f, 0x00, 0x00, 0x8c, 0x5e, 0x00, 0x00, 0x17, 0x5e, 0x00, 0x00,
+    0x9d, 0x5d, 0x00, 0x00, 0x2c, 0x5d, 0x00, 0x00, 0xb7, 0x5c, 0x00, 0x00,
+    0x41, 0x5c, 0x00, 0x00, 0xd1, 0x5b, 0x00, 0x00, 0x61, 0x5b, 0x00, 0x00,
+    0xf0, 0x5a, 0x00, 0x00, 0x84, 0x5a, 0x00, 0x00, 0x14, 0x5a, 0x00, 0x00,
+    0xa8, 0x59, 0x00, 0x00, 0x3d, 0x59, 0x00, 0x00, 0xd6, 0x58, 0x00, 0x00,
+    0x6b, 0x58, 0x00, 0x00, 0x04, 0x58, 0x00, 0x00, 0x9d, 0x57, 0x00, 0x00,
+    0x37, 0x57, 0x00, 0x00, 0xd0, 0x56, 0x00, 0x00, 0x69, 0x56, 0x00, 0x00,
+    0x07, 0x56, 0x00, 0x00, 0xa6, 0x55, 0x00, 0x00, 0x44, 0x55, 0x00, 0x00,
+    0xe2, 0x54, 0x00, 0x00, 0x80, 0x54, 0x00, 0x00, 0x23, 0x54, 0x00, 0x00,
+    0xc1, 0x53, 0x00, 0x00, 0x65, 0x53, 0x00, 0x00, 0x08, 0x53, 0x00, 0x00,
+    0xb0, 0x52, 0x00, 0x00, 0x53, 0x52, 0x00, 0x00, 0xf6, 0x51, 0x01, 0x00,
+    0x9e, 0x51, 0x01, 0x00, 0x46, 0x51, 0x01, 0x00, 0xee, 0x50, 0x01, 0x00,
+    0x96, 0x50, 0x01, 0x00, 0x3e, 0x50, 0x01, 0x00, 0xeb, 0x4f, 0x01, 0x00,
+    0x93, 0x4f, 0x01, 0x00, 0x3f, 0x4f, 0x01, 0x00, 0xec, 0x4e, 0x01, 0x00,
+    0x99, 0x4e, 0x01, 0x00, 0x46, 0x4e, 0x01, 0x00, 0xf3, 0x4d, 0x01, 0x00,
+    0xa5, 0x4d, 0x01, 0x00, 0x52, 0x4d, 0x01, 0x00, 0x03, 0x4d, 0x01, 0x00,
+    0xb5, 0x4c, 0x01, 0x00, 0x67, 0x4c, 0x01, 0x00, 0x19, 0x4c, 0x01, 0x00,
+    0xca, 0x4b, 0x01, 0x00, 0x7c, 0x4b, 0x01, 0x00, 0x33, 0x4b, 0x01, 0x00,
+    0xe5, 0x4a, 0x01, 0x00, 0x9b, 0x4a, 0x01, 0x00, 0x52, 0x4a, 0x01, 0x00,
+    0x04, 0x4a, 0x01, 0x00, 0xbf, 0x49, 0x01, 0x00, 0x76, 0x49, 0x01, 0x00,
+    0x2c, 0x49, 0x01, 0x00, 0xe3, 0x48, 0x01, 0x00, 0x9f, 0x48, 0x01, 0x00,
+    0x55, 0x48, 0x01, 0x00, 0x11, 0x48, 0x01, 0x00, 0xcc, 0x47, 0x01, 0x00,
+    0x88, 0x47, 0x01, 0x00, 0x44, 0x47, 0x01, 0x00, 0xff, 0x46, 0x01, 0x00,
+    0xbb, 0x46, 0x01, 0x00, 0x7b, 0x46, 0x01, 0x00, 0x37, 0x46, 0x01, 0x00,
+    0xf7, 0x45, 0x01, 0x00, 0xb3, 0x45, 0x01, 0x00, 0x73, 0x45, 0x01, 0x00,
+    0x33, 0x45, 0x01, 0x00, 0xf4, 0x44, 0x01, 0x00, 0xb4, 0x44, 0x01, 0x00,
+    0x75, 0x44, 0x01, 0x00, 0x35, 0x44, 0x01, 0x00, 0xf6, 0x43, 0x01, 0x00,
+    0xbb, 0x43, 0x01, 0x00, 0x7b, 0x43, 0x01, 0x00, 0x41, 0x43, 0x02, 0x00,
+    0x01, 0x43, 0x02, 0x00, 0xc6, 0x42, 0x02, 0x00, 0x8c, 0x42, 0x02, 0x00,
+    0x51, 0x42, 0x02, 0x00, 0x16, 0x42, 0x02, 0x00, 0xdc, 0x41, 0x02, 0x00,
+    0xa1, 0x41, 0x02, 0x00, 0x66, 0x41, 0x02, 0x00, 0x2c, 0x41, 0x02, 0x00,
+    0xf6, 0x40, 0x02, 0x00, 0xbb, 0x40, 0x02, 0x00, 0x85, 0x40, 0x02, 0x00,
+    0x50, 0x40, 0x02, 0x00, 0x15, 0x40, 0x02, 0x00, 0xdf, 0x3f, 0x02, 0x00,
+    0xa9, 0x3f, 0x02, 0x00, 0x74, 0x3f, 0x02, 0x00, 0x3e, 0x3f, 0x02, 0x00,
+    0x08, 0x3f, 0x02, 0x00, 0xd2, 0x3e, 0x02, 0x00, 0x9c, 0x3e, 0x02, 0x00,
+    0x67, 0x3e, 0x02, 0x00, 0x36, 0x3e, 0x02, 0x00, 0x00, 0x3e, 0x02, 0x00,
+    0xcf, 0x3d, 0x02, 0x00, 0x99, 0x3d, 0x02, 0x00, 0x68, 0x3d, 0x02, 0x00,
+    0x37, 0x3d, 0x02, 0x00, 0x02, 0x3d, 0x02, 0x00, 0xd1, 0x3c, 0x02, 0x00,
+    0xa0, 0x3c, 0x02, 0x00, 0x6f, 0x3c, 0x03, 0x00, 0x3e, 0x3c, 0x03, 0x00,
+    0x0d, 0x3c, 0x03, 0x00, 0xdc, 0x3b, 0x03, 0x00, 0xb0, 0x3b, 0x03, 0x00,
+    0x7f, 0x3b, 0x03, 0x00, 0x4e, 0x3b, 0x03, 0x00, 0x1e, 0x3b, 0x03, 0x00,
+    0xf2, 0x3a, 0x03, 0x00, 0xc1, 0x3a, 0x03, 0x00, 0x95, 0x3a, 0x03, 0x00,
+    0x69, 0x3a, 0x03, 0x00, 0x38, 0x3a, 0x03, 0x00, 0x0c, 0x3a, 0x03, 0x00,
+    0xe0, 0x39, 0x03, 0x00, 0xb4, 0x39, 0x03, 0x00, 0x88, 0x39, 0x03, 0x00,
+    0x5c, 0x39, 0x03, 0x00, 0x30, 0x39, 0x03, 0x00, 0x04, 0x39, 0x03, 0x00,
+    0xd8, 0x38, 0x03, 0x00, 0xac, 0x38, 0x03, 0x00, 0x80, 0x38, 0x03, 0x00,
+    0x54, 0x38, 0x04, 0x00, 0x2d, 0x38, 0x04, 0x00, 0x01, 0x38, 0x04, 0x00,
+    0xd5, 0x37, 0x04, 0x00, 0xad, 0x37, 0x04, 0x00, 0x81, 0x37, 0x04, 0x00,
+    0x5a, 0x37, 0x04, 0x00, 0x33, 0x37, 0x04, 0x00, 0x07, 0x37, 0x04, 0x00,
+    0xe0, 0x36, 0x04, 0x00, 0xb9, 0x36, 0x04, 0x00, 0x92, 0x36, 0x04, 0x00,
+    0x6b, 0x36, 0x04, 0x00, 0x3f, 0x36, 0x04, 0x00, 0x18, 0x36, 0x04, 0x00,
+    0xf0, 0x35, 0x04, 0x00, 0xc9, 0x35, 0x04, 0x00, 0xa2, 0x35, 0x04, 0x00,
+    0x80, 0x35, 0x05, 0x00, 0x59, 0x35, 0x05, 0x00, 0x32, 0x35, 0x05, 0x00,
+    0x0b, 0x35, 0x05, 0x00, 0xe8, 0x34, 0x05, 0x00, 0xc1, 0x34, 0x05, 0x00,
+    0x9a, 0x34, 0x05, 0x00, 0x78, 0x34, 0x05, 0x00, 0x51, 0x34, 0x05, 0x00,
+    0x2f, 0x34, 0x05, 0x00, 0x07, 0x34, 0x05, 0x00, 0xe5, 0x33, 0x05, 0x00,
+    0xc3, 0x33, 0x05, 0x00, 0x9c, 0x33, 0x05, 0x00, 0x7a, 0x33, 0x06, 0x00,
+    0x57, 0x33, 0x06, 0x00, 0x30, 0x33, 0x06, 0x00, 0x0e, 0x33, 0x06, 0x00,
+    0xec, 0x32, 0x06, 0x00, 0xca, 0x32, 0x06, 0x00, 0xa7, 0x32, 0x06, 0x00,
+    0x85, 0x32, 0x06, 0x00, 0x63, 0x32, 0x06, 0x00, 0x41, 0x32, 0x06, 0x00,
+    0x1e, 0x32, 0x06, 0x00, 0xfc, 0x31, 0x06, 0x00, 0xda, 0x31, 0x07, 0x00,
+    0xbd, 0x31, 0x07, 0x00, 0x9a, 0x31, 0x07, 0x00, 0x78, 0x31, 0x07, 0x00,
+    0x56, 0x31, 0x07, 0x00, 0x39, 0x31, 0x07, 0x00, 0x16, 0x31, 0x07, 0x00,
+    0xf9, 0x30, 0x07, 0x00, 0xd7, 0x30, 0x07, 0x00, 0xb9, 0x30, 0x07, 0x00,
+    0x97, 0x30, 0x08, 0x00, 0x7a, 0x30, 0x08, 0x00, 0x58, 0x30, 0x08, 0x00,
+    0x3a, 0x30, 0x08, 0x00, 0x18, 0x30, 0x08, 0x00, 0xfb, 0x2f, 0x08, 0x00,
+    0xdd, 0x2f, 0x08, 0x00, 0xc0, 0x2f, 0x08, 0x00, 0x9e, 0x2f, 0x08, 0x00,
+    0x81, 0x2f, 0x09, 0x00, 0x63, 0x2f, 0x09, 0x00, 0x46, 0x2f, 0x09, 0x00,
+    0x29, 0x2f, 0x09, 0x00, 0x0b, 0x2f, 0x09, 0x00, 0xee, 0x2e, 0x09, 0x00,
+    0xcc, 0x2e, 0x09, 0x00, 0xae, 0x2e, 0x09, 0x00, 0x96, 0x2e, 0x0a, 0x00,
+    0x78, 0x2e, 0x0a, 0x00, 0x5b, 0x2e, 0x0a, 0x00, 0x3e, 0x2e, 0x0a, 0x00,
+    0x20, 0x2e, 0x0a, 0x00, 0x03, 0x2e, 0x0a, 0x00, 0xe6, 0x2d, 0x0a, 0x00,
+    0xcd, 0x2d, 0x0b, 0x00, 0xb0, 0x2d, 0x0b, 0x00, 0x93, 0x2d, 0x0b, 0x00,
+    0x75, 0x2d, 0x0b, 0x00, 0x5d, 0x2d, 0x0b, 0x00, 0x40, 0x2d, 0x0b, 0x00,
+    0x27, 0x2d, 0x0b, 0x00, 0x0a, 0x2d, 0x0c, 0x00, 0xec, 0x2c, 0x0c, 0x00,
+    0xd4, 0x2c, 0x0c, 0x00, 0xb7, 0x2c, 0x0c, 0x00, 0x9e, 0x2c, 0x0c, 0x00,
+    0x86, 0x2c, 0x0d, 0x00, 0x68, 0x2c, 0x0d, 0x00, 0x50, 0x2c, 0x0d, 0x00,
+    0x33, 0x2c, 0x0d, 0x00, 0x1a, 0x2c, 0x0d, 0x00, 0x02, 0x2c, 0x0d, 0x00,
+    0xe4, 0x2b, 0x0e, 0x00, 0xcc, 0x2b, 0x0e, 0x00, 0xb3, 0x2b, 0x0e, 0x00,
+    0x9b, 0x2b, 0x0e, 0x00, 0x7e, 0x2b, 0x0f, 0x00, 0x65, 0x2b, 0x0f, 0x00,
+    0x4d, 0x2b, 0x0f, 0x00, 0x34, 0x2b, 0x0f, 0x00, 0x1c, 0x2b, 0x0f, 0x00,
+    0x03, 0x2b, 0x10, 0x00, 0xeb, 0x2a, 0x10, 0x00, 0xd3, 0x2a, 0x10, 0x00,
+    0xba, 0x2a, 0x10, 0x00, 0xa2, 0x2a, 0x11, 0x00, 0x89, 0x2a, 0x11, 0x00,
+    0x71, 0x2a, 0x11, 0x00, 0x58, 0x2a, 0x11, 0x00, 0x40, 0x2a, 0x12, 0x00,
+    0x27, 0x2a, 0x12, 0x00, 0x0f, 0x2a, 0x12, 0x00, 0xf6, 0x29, 0x13, 0x00,
+    0xde, 0x29, 0x13, 0x00, 0xca, 0x29, 0x13, 0x00, 0xb2, 0x29, 0x13, 0x00,
+    0x9a, 0x29, 0x14, 0x00, 0x81, 0x29, 0x14, 0x00, 0x6e, 0x29, 0x14, 0x00,
+    0x55, 0x29, 0x15, 0x00, 0x3d, 0x29, 0x15, 0x00, 0x29, 0x29, 0x16, 0x00,
+    0x11, 0x29, 0x16, 0x00, 0xf8, 0x28, 0x16, 0x00, 0xe5, 0x28, 0x17, 0x00,
+    0xcc, 0x28, 0x17, 0x00, 0xb9, 0x28, 0x17, 0x00, 0xa0, 0x28, 0x18, 0x00,
+    0x8d, 0x28, 0x18, 0x00, 0x74, 0x28, 0x19, 0x00, 0x61, 0x28, 0x19, 0x00,
+    0x48, 0x28, 0x1a, 0x00, 0x35, 0x28, 0x1a, 0x00, 0x1c, 0x28, 0x1b, 0x00,
+    0x09, 0x28, 0x1b, 0x00, 0xf5, 0x27, 0x1c, 0x00, 0xdd, 0x27, 0x1c, 0x00,
+    0xc9, 0x27, 0x1d, 0x00, 0xb5, 0x27, 0x1d, 0x00, 0x9d, 0x27, 0x1e, 0x00,
+    0x89, 0x27, 0x1e, 0x00, 0x76, 0x27, 0x1f, 0x00, 0x5d, 0x27, 0x20, 0x00,
+    0x4a, 0x27, 0x20, 0x00, 0x36, 0x27, 0x21, 0x00, 0x23, 0x27, 0x22, 0x00,
+    0x0a, 0x27, 0x23, 0x00, 0xf7, 0x26, 0x23, 0x00, 0xe3, 0x26, 0x24, 0x00,
+    0xd0, 0x26, 0x25, 0x00, 0xbc, 0x26, 0x26, 0x00, 0xa9, 0x26, 0x27, 0x00,
+    0x95, 0x26, 0x28, 0x00, 0x81, 0x26, 0x29, 0x00, 0x6e, 0x26, 0x2a, 0x00,
+    0x5a, 0x26, 0x2b, 0x00, 0x47, 0x26, 0x2d, 0x00, 0x33, 0x26, 0x2e, 0x00,
+    0x20, 0x26, 0x30, 0x00, 0x0c, 0x26, 0x31, 0x00, 0xf9, 0x25, 0x33, 0x00,
+    0xe5, 0x25, 0x35, 0x00, 0xd1, 0x25, 0x38, 0x00, 0xbe, 0x25, 0x3b, 0x00,
+    0xaa, 0x25, 0x3f, 0x00, 0x97, 0x25, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+    0x22, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+    0x2e, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+    0x4c, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x65, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+    0x73, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0x8c, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+    0x9e, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00,
+    0xaa, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00,
+    0xb7, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00,
+    0xc4, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00,
+    0xce, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
+    0xdb, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00,
+    0xea, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00,
+    0x08, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00,
+    0x17, 0x01, 0x00, 0x00, 0x1d, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00,
+    0x25, 0x01, 0x00, 0x00, 0x2b, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00,
+    0x33, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00,
+    0x3f, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00,
+    0x4d, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00,
+    0x58, 0x01, 0x00, 0x00, 0x5d, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00,
+    0x67, 0x01, 0x00, 0x00, 0x6d, 0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00,
+    0x76, 0x01, 0x00, 0x00, 0x7b, 0x01, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00,
+    0x86, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00,
+    0x95, 0x01, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00, 0xa3, 0x01, 0x00, 0x00,
+    0xa8, 0x01, 0x00, 0x00, 0xae, 0x01, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00,
+    0xb7, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x00,
+    0xcb, 0x01, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x00,
+    0xdb, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00,
+    0xea, 0x01, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x00, 0xf7, 0x01, 0x00, 0x00,
+    0xfc, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00,
+    0x0c, 0x02, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00,
+    0x1a, 0x02, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00,
+    0x28, 0x02, 0x00, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x31, 0x02, 0x00, 0x00,
+    0x36, 0x02, 0x00, 0x00, 0x3e, 0x02, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00,
+    0x49, 0x02, 0x00, 0x00, 0x4f, 0x02, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00,
+    0x59, 0x02, 0x00, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00,
+    0x6b, 0x02, 0x00, 0x00, 0x71, 0x02, 0x00, 0x00, 0x76, 0x02, 0x00, 0x00,
+    0x7c, 0x02, 0x00, 0x00, 0x7f, 0x02, 0x00, 0x00, 0x85, 0x02, 0x00, 0x00,
+    0x89, 0x02, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
+    0x99, 0x02, 0x00, 0x00, 0xa1, 0x02, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00,
+    0xa9, 0x02, 0x00, 0x00, 0xaf, 0x02, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00,
+    0xb9, 0x02, 0x00, 0x00, 0xbf, 0x02, 0x00, 0x00, 0xc6, 0x02, 0x00, 0x00,
+    0xce, 0x02, 0x00, 0x00, 0xd2, 0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00,
+    0xdc, 0x02, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00, 0xeb, 0x02, 0x00, 0x00,
+    0xf1, 0x02, 0x00, 0x00, 0xf7, 0x02, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00,
+    0x06, 0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x11, 0x03, 0x00, 0x00,
+    0x17, 0x03, 0x00, 0x00, 0x1f, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
+    0x28, 0x03, 0x00, 0x00, 0x2d, 0x03, 0x00, 0x00, 0x32, 0x03, 0x00, 0x00,
+    0x3a, 0x03, 0x00, 0x00, 0x3f, 0x03, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00,
+    0x4b, 0x03, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00,
+    0x5a, 0x03, 0x00, 0x00, 0x61, 0x03, 0x00, 0x00, 0x66, 0x03, 0x00, 0x00,
+    0x6d, 0x03, 0x00, 0x00, 0x74, 0x03, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00,
+    0x7e, 0x03, 0x00, 0x00, 0x85, 0x03, 0x00, 0x00, 0x8a, 0x03, 0x00, 0x00,
+    0x94, 0x03, 0x00, 0x00, 0x99, 0x03, 0x00, 0x00, 0x9f, 0x03, 0x00, 0x00,
+    0xa6, 0x03, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0xb2, 0x03, 0x00, 0x00,
+    0xb6, 0x03, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0xc3, 0x03, 0x00, 0x00,
+    0xc8, 0x03, 0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0xd3, 0x03, 0x00, 0x00,
+    0xd8, 0x03, 0x00, 0x00, 0xdd, 0x03, 0x00, 0x00, 0xe1, 0x03, 0x00, 0x00,
+    0xec, 0x03, 0x00, 0x00, 0xf3, 0x03, 0x00, 0x00, 0xf7, 0x03, 0x00, 0x00,
+    0xfe, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00,
+    0x11, 0x04, 0x00, 0x00, 0x15, 0x04, 0x00, 0x00, 0x19, 0x04, 0x00, 0x00,
+    0x20, 0x04, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00,
+    0x2f, 0x04, 0x00, 0x00, 0x35, 0x04, 0x00, 0x00, 0x3b, 0x04, 0x00, 0x00,
+    0x41, 0x04, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00, 0x4b, 0x04, 0x00, 0x00,
+    0x50, 0x04, 0x00, 0x00, 0x58, 0x04, 0x00, 0x00, 0x61, 0x04, 0x00, 0x00,
+    0x66, 0x04, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0x73, 0x04, 0x00, 0x00,
+    0x79, 0x04, 0x00, 0x00, 0x7e, 0x04, 0x00, 0x00, 0x82, 0x04, 0x00, 0x00,
+    0x87, 0x04, 0x00, 0x00, 0x91, 0x04, 0x00, 0x00, 0x96, 0x04, 0x00, 0x00,
+    0x9d, 0x04, 0x00, 0x00, 0xa3, 0x04, 0x00, 0x00, 0xab, 0x04, 0x00, 0x00,
+    0xb3, 0x04, 0x00, 0x00, 0xb9, 0x04, 0x00, 0x00, 0xc2, 0x04, 0x00, 0x00,
+    0xcb, 0x04, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0xd9, 0x04, 0x00, 0x00,
+    0xde, 0x04, 0x00, 0x00, 0xe2, 0x04, 0x00, 0x00, 0xe8, 0x04, 0x00, 0x00,
+    0xed, 0x04, 0x00, 0x00, 0xf7, 0x04, 0x00, 0x00, 0xfd, 0x04, 0x00, 0x00,
+    0x04, 0x05, 0x00, 0x00, 0x0b, 0x05, 0x00, 0x00, 0x11, 0x05, 0x00, 0x00,
+    0x17, 0x05, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x00, 0x21, 0x05, 0x00, 0x00,
+    0x28, 0x05, 0x00, 0x00, 0x2e, 0x05, 0x00, 0x00, 0x33, 0x05, 0x00, 0x00,
+    0x37, 0x05, 0x00, 0x00, 0x3c, 0x05, 0x00, 0x00, 0x43, 0x05, 0x00, 0x00,
+    0x48, 0x05, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0x57, 0x05, 0x00, 0x00,
+    0x5b, 0x05, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00,
+    0x6c, 0x05, 0x00, 0x00, 0x72, 0x05, 0x00, 0x00, 0x78, 0x05, 0x00, 0x00,
+    0x84, 0x05, 0x00, 0x00, 0x8a, 0x05, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00,
+    0x97, 0x05, 0x00, 0x00, 0x9e, 0x05, 0x00, 0x00, 0xa7, 0x05, 0x00, 0x00,
+    0xac, 0x05, 0x00, 0x00, 0xb4, 0x05, 0x00, 0x00, 0xb9, 0x05, 0x00, 0x00,
+    0xc1, 0x05, 0x00, 0x00, 0xc6, 0x05, 0x00, 0x00, 0xcd, 0x05, 0x00, 0x00,
+    0xd2, 0x05, 0x00, 0x00, 0xd9, 0x05, 0x00, 0x00, 0xe2, 0x05, 0x00, 0x00,
+    0xe7, 0x05, 0x00, 0x00, 0xeb, 0x05, 0x00, 0x00, 0xf3, 0x05, 0x00, 0x00,
+    0xfb, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00,
+    0x0e, 0x06, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x1d, 0x06, 0x00, 0x00,
+    0x22, 0x06, 0x00, 0x00, 0x27, 0x06, 0x00, 0x00, 0x2d, 0x06, 0x00, 0x00,
+    0x33, 0x06, 0x00, 0x00, 0x39, 0x06, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00,
+    0x48, 0x06, 0x00, 0x00, 0x4f, 0x06, 0x00, 0x00, 0x54, 0x06, 0x00, 0x00,
+    0x5a, 0x06, 0x00, 0x00, 0x5e, 0x06, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00,
+    0x69, 0x06, 0x00, 0x00, 0x6f, 0x06, 0x00, 0x00, 0x74, 0x06, 0x00, 0x00,
+    0x7c, 0x06, 0x00, 0x00, 0x83, 0x06, 0x00, 0x00, 0x8b, 0x06, 0x00, 0x00,
+    0x91, 0x06, 0x00, 0x00, 0x97, 0x06, 0x00, 0x00, 0x9c, 0x06, 0x00, 0x00,
+    0xa4, 0x06, 0x00, 0x00, 0xa9, 0x06, 0x00, 0x00, 0xb1, 0x06, 0x00, 0x00,
+    0xb6, 0x06, 0x00, 0x00, 0xbc, 0x06, 0x00, 0x00, 0xc3, 0x06, 0x00, 0x00,
+    0xc7, 0x06, 0x00, 0x00, 0xcc, 0x06, 0x00, 0x00, 0xd3, 0x06, 0x00, 0x00,
+    0xd9, 0x06, 0x00, 0x00, 0xde, 0x06, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00,
+    0xed, 0x06, 0x00, 0x00, 0xf2, 0x06, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x00,
+    0xff, 0x06, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x00,
+    0x14, 0x07, 0x00, 0x00, 0x19, 0x07, 0x00, 0x00, 0x1e, 0x07, 0x00, 0x00,
+    0x25, 0x07, 0x00, 0x00, 0x2b, 0x07, 0x00, 0x00, 0x2e, 0x07, 0x00, 0x00,
+    0x32, 0x07, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00,
+    0x4b, 0x07, 0x00, 0x00, 0x57, 0x07, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x00,
+    0x64, 0x07, 0x00, 0x00, 0x6a, 0x07, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00,
+    0x77, 0x07, 0x00, 0x00, 0x7c, 0x07, 0x00, 0x00, 0x81, 0x07, 0x00, 0x00,
+    0x86, 0x07, 0x00, 0x00, 0x8f, 0x07, 0x00, 0x00, 0x94, 0x07, 0x00, 0x00,
+    0x9a, 0x07, 0x00, 0x00, 0x9f, 0x07, 0x00, 0x00, 0xa6, 0x07, 0x00, 0x00,
+    0xad, 0x07, 0x00, 0x00, 0xb2, 0x07, 0x00, 0x00, 0xbc, 0x07, 0x00, 0x00,
+    0xc0, 0x07, 0x00, 0x00, 0xc9, 0x07, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00,
+    0xd7, 0x07, 0x00, 0x00, 0xdf, 0x07, 0x00, 0x00, 0xe5, 0x07, 0x00, 0x00,
+    0xed, 0x07, 0x00, 0x00, 0xf3, 0x07, 0x00, 0x00, 0xf9, 0x07, 0x00, 0x00,
+    0x02, 0x08, 0x00, 0x00, 0x06, 0x08, 0x00, 0x00, 0x0d, 0x08, 0x00, 0x00,
+    0x15, 0x08, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x00, 0x22, 0x08, 0x00, 0x00,
+    0x2c, 0x08, 0x00, 0x00, 0x32, 0x08, 0x00, 0x00, 0x39, 0x08, 0x00, 0x00,
+    0x40, 0x08, 0x00, 0x00, 0x49, 0x08, 0x00, 0x00, 0x4d, 0x08, 0x00, 0x00,
+    0x56, 0x08, 0x00, 0x00, 0x5d, 0x08, 0x00, 0x00, 0x64, 0x08, 0x00, 0x00,
+    0x6a, 0x08, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00, 0x7b, 0x08, 0x00, 0x00,
+    0x7f, 0x08, 0x00, 0x00, 0x87, 0x08, 0x00, 0x00, 0x8d, 0x08, 0x00, 0x00,
+    0x92, 0x08, 0x00, 0x00, 0x98, 0x08, 0x00, 0x00, 0x9d, 0x08, 0x00, 0x00,
+    0xa2, 0x08, 0x00, 0x00, 0xac, 0x08, 0x00, 0x00, 0xb1, 0x08, 0x00, 0x00,
+    0xb7, 0x08, 0x00, 0x00, 0xbd, 0x08, 0x00, 0x00, 0xc2, 0x08, 0x00, 0x00,
+    0xc7, 0x08, 0x00, 0x00, 0xcc, 0x08, 0x00, 0x00, 0xd0, 0x08, 0x00, 0x00,
+    0xd7, 0x08, 0x00, 0x00, 0xdd, 0x08, 0x00, 0x00, 0xe4, 0x08, 0x00, 0x00,
+    0xea, 0x08, 0x00, 0x00, 0xf2, 0x08, 0x00, 0x00, 0xf9, 0x08, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x14, 0x09, 0x00, 0x00,
+    0x1a, 0x09, 0x00, 0x00, 0x24, 0x09, 0x00, 0x00, 0x28, 0x09, 0x00, 0x00,
+    0x2d, 0x09, 0x00, 0x00, 0x33, 0x09, 0x00, 0x00, 0x3b, 0x09, 0x00, 0x00,
+    0x40, 0x09, 0x00, 0x00, 0x44, 0x09, 0x00, 0x00, 0x4d, 0x09, 0x00, 0x00,
+    0x55, 0x09, 0x00, 0x00, 0x5a, 0x09, 0x00, 0x00, 0x60, 0x09, 0x00, 0x00,
+    0x65, 0x09, 0x00, 0x00, 0x6c, 0x09, 0x00, 0x00, 0x72, 0x09, 0x00, 0x00,
+    0x7c, 0x09, 0x00, 0x00, 0x87, 0x09, 0x00, 0x00, 0x8d, 0x09, 0x00, 0x00,
+    0x94, 0x09, 0x00, 0x00, 0x9a, 0x09, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00,
+    0xa9, 0x09, 0x00, 0x00, 0xae, 0x09, 0x00, 0x00, 0xb4, 0x09, 0x00, 0x00,
+    0xbc, 0x09, 0x00, 0x00, 0xc2, 0x09, 0x00, 0x00, 0xca, 0x09, 0x00, 0x00,
+    0xcf, 0x09, 0x00, 0x00, 0xd6, 0x09, 0x00, 0x00, 0xdc, 0x09, 0x00, 0x00,
+    0xe0, 0x09, 0x00, 0x00, 0xe8, 0x09, 0x00, 0x00, 0xf3, 0x09, 0x00, 0x00,
+    0xf9, 0x09, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x00,
+    0x0c, 0x0a, 0x00, 0x00, 0x16, 0x0a, 0x00, 0x00, 0x1f, 0x0a, 0x00, 0x00,
+    0x23, 0x0a, 0x00, 0x00, 0x2b, 0x0a, 0x00, 0x00, 0x31, 0x0a, 0x00, 0x00,
+    0x37, 0x0a, 0x00, 0x00, 0x3e, 0x0a, 0x00, 0x00, 0x43, 0x0a, 0x00, 0x00,
+    0x4b, 0x0a, 0x00, 0x00, 0x50, 0x0a, 0x00, 0x00, 0x58, 0x0a, 0x00, 0x00,
+    0x5d, 0x0a, 0x00, 0x00, 0x63, 0x0a, 0x00, 0x00, 0x68, 0x0a, 0x00, 0x00,
+    0x70, 0x0a, 0x00, 0x00, 0x75, 0x0a, 0x00, 0x00, 0x7a, 0x0a, 0x00, 0x00,
+    0x7f, 0x0a, 0x00, 0x00, 0x85, 0x0a, 0x00, 0x00, 0x8b, 0x0a, 0x00, 0x00,
+    0x91, 0x0a, 0x00, 0x00, 0x98, 0x0a, 0x00, 0x00, 0x9c, 0x0a, 0x00, 0x00,
+    0xa1, 0x0a, 0x00, 0x00, 0xa5, 0x0a, 0x00, 0x00, 0xaa, 0x0a, 0x00, 0x00,
+    0xb3, 0x0a, 0x00, 0x00, 0xbb, 0x0a, 0x00, 0x00, 0xc5, 0x0a, 0x00, 0x00,
+    0xcd, 0x0a, 0x00, 0x00, 0xd6, 0x0a, 0x00, 0x00, 0xdb, 0x0a, 0x00, 0x00,
+    0xe3, 0x0a, 0x00, 0x00, 0xe9, 0x0a, 0x00, 0x00, 0xef, 0x0a, 0x00, 0x00,
+    0xf4, 0x0a, 0x00, 0x00, 0xf8, 0x0a, 0x00, 0x00, 0xff, 0x0a, 0x00, 0x00,
+    0x07, 0x0b, 0x00, 0x00, 0x0f, 0x0b, 0x00, 0x00, 0x16, 0x0b, 0x00, 0x00,
+    0x1b, 0x0b, 0x00, 0x00, 0x1f, 0x0b, 0x00, 0x00, 0x27, 0x0b, 0x00, 0x00,
+    0x2d, 0x0b, 0x00, 0x00, 0x34, 0x0b, 0x00, 0x00, 0x3c, 0x0b, 0x00, 0x00,
+    0x46, 0x0b, 0x00, 0x00, 0x4e, 0x0b, 0x00, 0x00, 0x53, 0x0b, 0x00, 0x00,
+    0x58, 0x0b, 0x00, 0x00, 0x5d, 0x0b, 0x00, 0x00, 0x64, 0x0b, 0x00, 0x00,
+    0x69, 0x0b, 0x00, 0x00, 0x6e, 0x0b, 0x00, 0x00, 0x77, 0x0b, 0x00, 0x00,
+    0x82, 0x0b, 0x00, 0x00, 0x88, 0x0b, 0x00, 0x00, 0x8e, 0x0b, 0x00, 0x00,
+    0x93, 0x0b, 0x00, 0x00, 0x9a, 0x0b, 0x00, 0x00, 0xa1, 0x0b, 0x00, 0x00,
+    0xa7, 0x0b, 0x00, 0x00, 0xae, 0x0b, 0x00, 0x00, 0xb7, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x04, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x22, 0x00,
+    0x2b, 0x00, 0x2b, 0x00, 0x47, 0x00, 0x49, 0x00, 0x90, 0x00, 0xa9, 0x00,
+    0xa9, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xf1, 0x00, 0xf1, 0x00,
+    0xf1, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0x43, 0x01, 0x43, 0x01,
+    0x43, 0x01, 0x61, 0x01, 0x61, 0x01, 0x61, 0x01, 0x61, 0x01, 0x61, 0x01,
+    0xa4, 0x01, 0xa4, 0x01, 0xf6, 0x01, 0xf6, 0x01, 0xfc, 0x01, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x22, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4c, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x9a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa6, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x00, 0xe8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb3, 0x01, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0xa8, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xa1, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x14, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x53, 0x00, 0x28, 0x03, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x80, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xbf, 0x00, 0x81, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xe1, 0x00, 0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xae, 0x01, 0xc0, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x05, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0xb3, 0x00, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x20, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x01, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
+    0x2e, 0x00, 0x88, 0x08, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x88, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x01, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x62, 0x01, 0xcc, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0xf7, 0x01, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x80, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x80, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x4c, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x26,
+    0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x01, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x00, 0x50, 0x22, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x90, 0x29,
+    0x00, 0x00, 0x00, 0x00, 0xb4, 0x00, 0xc0, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0xd5, 0x00, 0xa0, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0xe6, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, 0xa0, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x01, 0x01, 0x26, 0x00, 0x00, 0x00, 0x00, 0x72, 0x01, 0xc8, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x94, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x82, 0x01, 0x22, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x01, 0x14, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x9c, 0x01, 0x80, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0xab, 0x01, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x02, 0x2b,
+    0x00, 0x00, 0x00, 0x00, 0xbd, 0x01, 0x08, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0xc9, 0x01, 0xb8, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x01, 0x04, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0xde, 0x01, 0x10, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x01, 0x98, 0x40, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x26, 0x42,
+    0x00, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x04, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x82, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x0a, 0x82, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x01, 0x89,
+    0x00, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x51, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x40, 0x83,
+    0x00, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x80, 0x89, 0x00, 0x00, 0x00, 0x00,
+    0x6d, 0x00, 0xa8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x23, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x74, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x2a, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0xa1, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x93, 0x00, 0xa8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x18, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00,
+    0xa4, 0x00, 0xa4, 0x84, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x08, 0x81,
+    0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0x00, 0xa4, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x01, 0xa4,
+    0x00, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x00, 0xcc, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x44, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0xa8, 0x81, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x01, 0x44, 0x86, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x8c, 0xa8,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x01, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x01, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x08, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x2a, 0xa0, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x01, 0xa6, 0x80, 0x00, 0x00, 0x00, 0x00, 0x25, 0x01, 0x8a, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x29, 0x01, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00,
+    0x2c, 0x01, 0x22, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x01, 0xa1, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x3e, 0x01, 0x08, 0xa0, 0x00, 0x00, 0x00, 0x00,
+    0x42, 0x01, 0x01, 0x84, 0x00, 0x00, 0x00, 0x00, 0x45, 0x01, 0x80, 0x81,
+    0x00, 0x00, 0x00, 0x00, 0x52, 0x01, 0x41, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x58, 0x01, 0x1c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x59, 0x01, 0x0a, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x5c, 0x01, 0x24, 0x81, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x01, 0x82, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x01, 0x9c, 0x81,
+    0x00, 0x00, 0x00, 0x00, 0x73, 0x01, 0x8c, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x74, 0x01, 0x2c, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x78, 0x01, 0x2c, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x01, 0x94, 0x80, 0x00, 0x00, 0x00, 0x00, 0x85, 0x01, 0x0a, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x89, 0x01, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00,
+    0x96, 0x01, 0xa4, 0x80, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x22, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0xca, 0x01, 0x24, 0xa0, 0x00, 0x00, 0x00, 0x00,
+    0xcb, 0x01, 0x08, 0xa9, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x6c, 0xa3,
+    0x00, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x9a, 0xa8, 0x00, 0x00, 0x00, 0x00,
+    0xd7, 0x01, 0x20, 0xa3, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x01, 0x02, 0xa6,
+    0x00, 0x00, 0x00, 0x00, 0xdc, 0x01, 0xb4, 0xa0, 0x00, 0x00, 0x00, 0x00,
+    0xe7, 0x01, 0xc1, 0x80, 0x00, 0x00, 0x00, 0x00, 0xed, 0x01, 0x5c, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xf1, 0x01, 0xa8, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xf5, 0x01, 0x84, 0x86, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x02,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x06, 0x02, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x08,
+    0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x8c, 0x08, 0x01, 0x00, 0x00, 0x00,
+    0x46, 0x00, 0xa4, 0x80, 0x01, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x02,
+    0x01, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0x00,
+    0x7d, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x00, 0x97, 0x00, 0x80, 0x81,
+    0x01, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xc2, 0x00, 0x06, 0x02, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x80, 0xa2,
+    0x01, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x14, 0x02, 0x01, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x80, 0x81, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x88, 0x89,
+    0x01, 0x00, 0x00, 0x00, 0x27, 0x01, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0x3c, 0x01, 0xa6, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x51, 0x01, 0x04, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0x5b, 0x01, 0x10, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x88, 0x01, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x01, 0x94, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x84, 0x22, 0x01, 0x00, 0x00, 0x00,
+    0x95, 0x01, 0x00, 0x81, 0x01, 0x00, 0x00, 0x00, 0x9f, 0x01, 0x04, 0x88,
+    0x01, 0x00, 0x00, 0x00, 0xec, 0x01, 0x10, 0x02, 0x04, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x22, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x45, 0x00, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+    0x49, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x22, 0x20,
+    0x04, 0x00, 0x00, 0x00, 0x58, 0x00, 0x2c, 0x80, 0x04, 0x00, 0x00, 0x00,
+    0x5f, 0x00, 0x14, 0x02, 0x04, 0x00, 0x00, 0x00, 0x62, 0x00, 0x20, 0x04,
+    0x04, 0x00, 0x00, 0x00, 0x63, 0x00, 0x24, 0x80, 0x04, 0x00, 0x00, 0x00,
+    0x8b, 0x00, 0x28, 0x00, 0x04, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x28, 0x05,
+    0x04, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x20, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0xb6, 0x00, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x8a, 0x80,
+    0x04, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x24, 0x81, 0x04, 0x00, 0x00, 0x00,
+    0xf5, 0x00, 0x22, 0x09, 0x05, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x05, 0x02,
+    0x04, 0x00, 0x00, 0x00, 0x28, 0x01, 0x24, 0x81, 0x04, 0x00, 0x00, 0x00,
+    0x4a, 0x01, 0x02, 0xa2, 0x04, 0x00, 0x00, 0x00, 0x55, 0x01, 0xe4, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xa0, 0x01, 0xa6, 0x09, 0x04, 0x00, 0x00, 0x00,
+    0xaa, 0x01, 0x38, 0x01, 0x04, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x28, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xc3, 0x01, 0xc0, 0x80, 0x04, 0x00, 0x00, 0x00,
+    0xc5, 0x01, 0x60, 0x01, 0x04, 0x00, 0x00, 0x00, 0xc7, 0x01, 0x20, 0x29,
+    0x05, 0x00, 0x00, 0x00, 0xe5, 0x01, 0x04, 0x82, 0x10, 0x00, 0x00, 0x00,
+    0x4d, 0x00, 0x00, 0xa0, 0x10, 0x00, 0x00, 0x00, 0x52, 0x00, 0x04, 0x80,
+    0x14, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0xa0, 0x10, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x04, 0x80, 0x14, 0x00, 0x00, 0x00, 0xac, 0x00, 0x2c, 0x81,
+    0x10, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x04, 0x80, 0x10, 0x00, 0x00, 0x00,
+    0x05, 0x01, 0x00, 0x88, 0x11, 0x00, 0x00, 0x00, 0x36, 0x01, 0x00, 0x83,
+    0x10, 0x00, 0x00, 0x00, 0x83, 0x01, 0x9c, 0xa8, 0x14, 0x00, 0x00, 0x00,
+    0xa5, 0x01, 0x00, 0x81, 0x10, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x20, 0x81,
+    0x10, 0x00, 0x00, 0x00, 0xb9, 0x01, 0x3c, 0x0a, 0x10, 0x00, 0x00, 0x00,
+    0xc2, 0x01, 0x30, 0x81, 0x10, 0x00, 0x00, 0x00, 0xc6, 0x01, 0xe4, 0x88,
+    0x10, 0x00, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x8c, 0x10, 0x00, 0x00, 0x00,
+    0xef, 0x01, 0x00, 0x23, 0x20, 0x00, 0x00, 0x00, 0x78, 0x00, 0x80, 0x80,
+    0x20, 0x00, 0x00, 0x00, 0x7a, 0x00, 0xa4, 0x80, 0x20, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0xa8, 0x28, 0x20, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x02,
+    0x20, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x20, 0x28, 0x20, 0x00, 0x00, 0x00,
+    0x9c, 0x00, 0x24, 0xa1, 0x20, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x80, 0x02,
+    0x20, 0x00, 0x00, 0x00, 0xae, 0x00, 0x86, 0xa2, 0x30, 0x00, 0x00, 0x00,
+    0xc6, 0x00, 0x66, 0x02, 0x20, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x88,
+    0x30, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x54, 0x02, 0x20, 0x00, 0x00, 0x00,
+    0xdc, 0x00, 0x10, 0x22, 0x24, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0xa8,
+    0x30, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00,
+    0xef, 0x00, 0x24, 0x81, 0x20, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x20, 0x23,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x80, 0x30, 0x00, 0x00, 0x00,
+    0x38, 0x01, 0x23, 0x28, 0x20, 0x00, 0x00, 0x00, 0x64, 0x01, 0x20, 0x02,
+    0x20, 0x00, 0x00, 0x00, 0x6c, 0x01, 0x20, 0x80, 0x20, 0x00, 0x00, 0x00,
+    0x8b, 0x01, 0x00, 0x2f, 0x21, 0x00, 0x00, 0x00, 0x94, 0x01, 0x04, 0x09,
+    0x20, 0x00, 0x00, 0x00, 0x98, 0x01, 0x06, 0x2a, 0x20, 0x00, 0x00, 0x00,
+    0xad, 0x01, 0x14, 0x88, 0x21, 0x00, 0x00, 0x00, 0xb1, 0x01, 0x8c, 0x22,
+    0x20, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0xa2, 0x20, 0x00, 0x00, 0x00,
+    0xdd, 0x01, 0x00, 0x29, 0x30, 0x00, 0x00, 0x00, 0xdf, 0x01, 0x04, 0xa3,
+    0x20, 0x00, 0x00, 0x00, 0xe2, 0x01, 0x90, 0x88, 0x00, 0x01, 0x00, 0x00,
+    0x40, 0x01, 0x98, 0xaa, 0x00, 0x01, 0x00, 0x00, 0x63, 0x01, 0x80, 0x80,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x09, 0x00, 0x80, 0x0c,
+    0x00, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00,
+    0x0e, 0x00, 0x88, 0x08, 0x00, 0x08, 0x00, 0x00, 0x14, 0x00, 0x20, 0x80,
+    0x10, 0x08, 0x00, 0x00, 0x1b, 0x00, 0x80, 0x80, 0x04, 0x08, 0x00, 0x00,
+    0x1d, 0x00, 0x04, 0x80, 0x00, 0x08, 0x00, 0x00, 0x23, 0x00, 0x08, 0x80,
+    0x00, 0x08, 0x00, 0x00, 0x24, 0x00, 0x84, 0x80, 0x00, 0x08, 0x00, 0x00,
+    0x25, 0x00, 0x84, 0x88, 0x00, 0x08, 0x00, 0x00, 0x27, 0x00, 0x02, 0x08,
+    0x00, 0x08, 0x00, 0x00, 0x29, 0x00, 0x28, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x2b, 0x00, 0x00, 0xa4, 0x00, 0x08, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x06,
+    0x00, 0x08, 0x00, 0x00, 0x2d, 0x00, 0xa0, 0x04, 0x00, 0x08, 0x00, 0x00,
+    0x36, 0x00, 0xa0, 0x20, 0x00, 0x08, 0x00, 0x00, 0x39, 0x00, 0x82, 0x80,
+    0x00, 0x08, 0x00, 0x00, 0x3b, 0x00, 0x84, 0x82, 0x00, 0x08, 0x00, 0x00,
+    0x3e, 0x00, 0x88, 0x80, 0x00, 0x08, 0x00, 0x00, 0x43, 0x00, 0x80, 0xa0,
+    0x00, 0x08, 0x00, 0x00, 0x47, 0x00, 0x94, 0x02, 0x20, 0x08, 0x00, 0x00,
+    0x5e, 0x00, 0x04, 0x84, 0x00, 0x08, 0x00, 0x00, 0x61, 0x00, 0x88, 0x82,
+    0x00, 0x08, 0x00, 0x00, 0x69, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00,
+    0x6b, 0x00, 0x04, 0x80, 0x00, 0x08, 0x00, 0x00, 0x79, 0x00, 0xa4, 0xa2,
+    0x00, 0x08, 0x00, 0x00, 0x83, 0x00, 0x00, 0x8d, 0x00, 0x08, 0x00, 0x00,
+    0x85, 0x00, 0x82, 0x08, 0x20, 0x08, 0x00, 0x00, 0x87, 0x00, 0x84, 0x08,
+    0x20, 0x08, 0x00, 0x00, 0x91, 0x00, 0x84, 0x80, 0x00, 0x08, 0x00, 0x00,
+    0x94, 0x00, 0x0a, 0x89, 0x01, 0x08, 0x00, 0x00, 0x96, 0x00, 0x18, 0x82,
+    0x00, 0x08, 0x00, 0x00, 0x98, 0x00, 0x90, 0x0e, 0x00, 0x08, 0x00, 0x00,
+    0x9b, 0x00, 0x04, 0x86, 0x10, 0x08, 0x00, 0x00, 0x9f, 0x00, 0x02, 0x82,
+    0x00, 0x08, 0x00, 0x00, 0xa0, 0x00, 0x90, 0x02, 0x20, 0x08, 0x00, 0x00,
+    0xa3, 0x00, 0x00, 0x08, 0x20, 0x08, 0x00, 0x00, 0xa9, 0x00, 0x8a, 0xaa,
+    0x20, 0x08, 0x00, 0x00, 0xb7, 0x00, 0x90, 0x02, 0x20, 0x08, 0x00, 0x00,
+    0xba, 0x00, 0x81, 0x28, 0x00, 0x08, 0x00, 0x00, 0xbe, 0x00, 0x10, 0xa2,
+    0x20, 0x08, 0x00, 0x00, 0xc1, 0x00, 0x80, 0x2a, 0x20, 0x08, 0x00, 0x00,
+    0xcb, 0x00, 0x80, 0x28, 0x20, 0x08, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x04,
+    0x04, 0x08, 0x00, 0x00, 0xce, 0x00, 0xa4, 0x80, 0x00, 0x08, 0x00, 0x00,
+    0xeb, 0x00, 0x88, 0x28, 0x20, 0x08, 0x00, 0x00, 0xf3, 0x00, 0x80, 0x8c,
+    0x00, 0x08, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x62, 0x00, 0x08, 0x00, 0x00,
+    0xf7, 0x00, 0x80, 0x2c, 0x00, 0x08, 0x00, 0x00, 0xfe, 0x00, 0x80, 0x09,
+    0x20, 0x08, 0x00, 0x00, 0x09, 0x01, 0x80, 0x28, 0x20, 0x08, 0x00, 0x00,
+    0x0a, 0x01, 0x8c, 0x82, 0x00, 0x08, 0x00, 0x00, 0x13, 0x01, 0xb0, 0x03,
+    0x20, 0x08, 0x00, 0x00, 0x16, 0x01, 0x98, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x20, 0x01, 0x40, 0x81, 0x00, 0x08, 0x00, 0x00, 0x21, 0x01, 0x00, 0x87,
+    0x00, 0x08, 0x00, 0x00, 0x24, 0x01, 0x6c, 0x80, 0x00, 0x08, 0x00, 0x00,
+    0x26, 0x01, 0x32, 0x20, 0x00, 0x08, 0x00, 0x00, 0x2b, 0x01, 0x08, 0x06,
+    0x00, 0x08, 0x00, 0x00, 0x34, 0x01, 0x84, 0x84, 0x00, 0x08, 0x00, 0x00,
+    0x35, 0x01, 0x8c, 0x0a, 0x04, 0x08, 0x00, 0x00, 0x37, 0x01, 0x84, 0x88,
+    0x00, 0x08, 0x00, 0x00, 0x3a, 0x01, 0xa0, 0x28, 0x24, 0x08, 0x00, 0x00,
+    0x41, 0x01, 0x20, 0x28, 0x30, 0x08, 0x00, 0x00, 0x43, 0x01, 0x20, 0x01,
+    0x01, 0x08, 0x00, 0x00, 0x49, 0x01, 0x8a, 0x81, 0x10, 0x08, 0x00, 0x00,
+    0x50, 0x01, 0x28, 0x01, 0x00, 0x08, 0x00, 0x00, 0x54, 0x01, 0x08, 0x86,
+    0x00, 0x08, 0x00, 0x00, 0x67, 0x01, 0x98, 0x02, 0x00, 0x08, 0x00, 0x00,
+    0x7a, 0x01, 0x94, 0x80, 0x01, 0x08, 0x00, 0x00, 0x9a, 0x01, 0x86, 0x82,
+    0x00, 0x08, 0x00, 0x00, 0xa2, 0x01, 0x8c, 0x02, 0x00, 0x08, 0x00, 0x00,
+    0xac, 0x01, 0xa8, 0x2e, 0x20, 0x08, 0x00, 0x00, 0xb5, 0x01, 0x84, 0x22,
+    0x00, 0x08, 0x00, 0x00, 0xb6, 0x01, 0x84, 0x82, 0x01, 0x08, 0x00, 0x00,
+    0xba, 0x01, 0x08, 0xa9, 0x20, 0x08, 0x00, 0x00, 0xda, 0x01, 0x84, 0xa8,
+    0x34, 0x08, 0x00, 0x00, 0xf2, 0x01, 0xa4, 0x80, 0x01, 0x08, 0x00, 0x00,
+    0xf6, 0x01, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x04, 0x40, 0x00, 0x00, 0x12, 0x00, 0x90, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0xa0, 0x00, 0x40, 0x00, 0x00, 0x2a, 0x00, 0xb0, 0x02,
+    0x00, 0x40, 0x00, 0x00, 0x38, 0x00, 0x04, 0x82, 0x01, 0x40, 0x00, 0x00,
+    0x5a, 0x00, 0x80, 0x02, 0x00, 0x48, 0x00, 0x00, 0x7b, 0x00, 0x80, 0xa4,
+    0x00, 0x40, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xa8, 0x20, 0x40, 0x00, 0x00,
+    0x7e, 0x00, 0x16, 0xa0, 0x00, 0x40, 0x00, 0x00, 0xb1, 0x00, 0x84, 0x80,
+    0x00, 0x40, 0x00, 0x00, 0xc9, 0x00, 0x18, 0xa8, 0x00, 0x40, 0x00, 0x00,
+    0xda, 0x00, 0x48, 0x8b, 0x00, 0x40, 0x00, 0x00, 0xea, 0x00, 0x00, 0x08,
+    0x20, 0x40, 0x00, 0x00, 0xfc, 0x00, 0x88, 0x80, 0x00, 0x40, 0x00, 0x00,
+    0x03, 0x01, 0x0e, 0x80, 0x00, 0x40, 0x00, 0x00, 0x0f, 0x01, 0x46, 0x83,
+    0x00, 0x40, 0x00, 0x00, 0x1c, 0x01, 0x20, 0xa0, 0x20, 0x40, 0x00, 0x00,
+    0x1d, 0x01, 0x20, 0x82, 0x10, 0x40, 0x00, 0x00, 0x2d, 0x01, 0x64, 0x03,
+    0x04, 0x40, 0x00, 0x00, 0x5a, 0x01, 0x94, 0x02, 0x20, 0x48, 0x00, 0x00,
+    0x66, 0x01, 0x4e, 0x83, 0x00, 0x40, 0x00, 0x00, 0x6b, 0x01, 0x20, 0x89,
+    0x10, 0x40, 0x00, 0x00, 0x71, 0x01, 0x00, 0x02, 0x04, 0x40, 0x00, 0x00,
+    0x76, 0x01, 0x00, 0x42, 0x00, 0x40, 0x00, 0x00, 0x7d, 0x01, 0x20, 0x81,
+    0x00, 0x40, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x89, 0x10, 0x40, 0x00, 0x00,
+    0xc4, 0x01, 0xa0, 0x81, 0x00, 0x40, 0x00, 0x00, 0xcd, 0x01, 0x01, 0x02,
+    0x00, 0x40, 0x00, 0x00, 0xd3, 0x01, 0x28, 0x08, 0x00, 0x40, 0x00, 0x00,
+    0xf3, 0x01, 0x00, 0x0c, 0x00, 0x08, 0x08, 0x00, 0x1e, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x08, 0x00, 0x3c, 0x00, 0x18, 0x00, 0x00, 0x08, 0x08, 0x00,
+    0x4e, 0x00, 0x21, 0x00, 0x00, 0x40, 0x08, 0x00, 0x5d, 0x00, 0x12, 0x00,
+    0x00, 0x08, 0x08, 0x00, 0x60, 0x00, 0x38, 0x80, 0x00, 0x40, 0x08, 0x00,
+    0x66, 0x00, 0x20, 0x80, 0x00, 0x08, 0x08, 0x00, 0x67, 0x00, 0x02, 0x82,
+    0x00, 0x00, 0x08, 0x00, 0x8c, 0x00, 0x08, 0xa8, 0x00, 0x00, 0x08, 0x00,
+    0x8d, 0x00, 0x22, 0x80, 0x00, 0x00, 0x08, 0x00, 0x90, 0x00, 0x60, 0x81,
+    0x00, 0x00, 0x08, 0x00, 0x9d, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x08, 0x00,
+    0xa7, 0x00, 0x08, 0x03, 0x00, 0x08, 0x08, 0x00, 0xab, 0x00, 0x1c, 0x82,
+    0x00, 0x00, 0x08, 0x00, 0xb2, 0x00, 0xa0, 0x00, 0x01, 0x00, 0x08, 0x00,
+    0xb8, 0x00, 0x50, 0x09, 0x00, 0x40, 0x08, 0x00, 0xbc, 0x00, 0x80, 0x08,
+    0x04, 0x00, 0x08, 0x00, 0xd7, 0x00, 0x28, 0x0b, 0x00, 0x00, 0x08, 0x00,
+    0xe4, 0x00, 0x20, 0x80, 0x01, 0x00, 0x08, 0x00, 0xed, 0x00, 0x28, 0x80,
+    0x00, 0x00, 0x08, 0x00, 0xf8, 0x00, 0x02, 0x82, 0x00, 0x40, 0x08, 0x00,
+    0xf9, 0x00, 0x14, 0x00, 0x00, 0x08, 0x08, 0x00, 0x04, 0x01, 0x94, 0x22,
+    0x04, 0x00, 0x08, 0x00, 0x11, 0x01, 0x0c, 0x88, 0x10, 0x00, 0x08, 0x00,
+    0x19, 0x01, 0xa4, 0xa8, 0x00, 0x00, 0x08, 0x00, 0x1a, 0x01, 0xa0, 0x2a,
+    0x00, 0x00, 0x08, 0x00, 0x30, 0x01, 0x62, 0x22, 0x04, 0x00, 0x08, 0x00,
+    0x31, 0x01, 0x20, 0x03, 0x00, 0x00, 0x08, 0x00, 0x33, 0x01, 0xa0, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x3b, 0x01, 0x2c, 0x02, 0x00, 0x00, 0x08, 0x00,
+    0x3d, 0x01, 0x24, 0x00, 0x00, 0x00, 0x08, 0x00, 0x4d, 0x01, 0x00, 0x83,
+    0x20, 0x00, 0x08, 0x00, 0x53, 0x01, 0xa0, 0x22, 0x00, 0x00, 0x08, 0x00,
+    0x5f, 0x01, 0xe0, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x61, 0x01, 0x00, 0x8a,
+    0x01, 0x00, 0x08, 0x00, 0x65, 0x01, 0x68, 0x89, 0x00, 0x00, 0x08, 0x00,
+    0x68, 0x01, 0x22, 0x80, 0x00, 0x40, 0x08, 0x00, 0x6d, 0x01, 0x02, 0xaa,
+    0x00, 0x00, 0x08, 0x00, 0x75, 0x01, 0x20, 0xa0, 0x20, 0x08, 0x08, 0x00,
+    0x79, 0x01, 0x88, 0x8a, 0x04, 0x00, 0x08, 0x00, 0x7e, 0x01, 0x08, 0x83,
+    0x00, 0x00, 0x08, 0x00, 0x81, 0x01, 0x92, 0x2a, 0x04, 0x00, 0x08, 0x00,
+    0x84, 0x01, 0x94, 0x02, 0x00, 0x00, 0x08, 0x00, 0x86, 0x01, 0x04, 0x82,
+    0x01, 0x00, 0x08, 0x00, 0x87, 0x01, 0x00, 0x8a, 0x10, 0x00, 0x08, 0x00,
+    0x8d, 0x01, 0x84, 0xa0, 0x00, 0x00, 0x08, 0x00, 0x8e, 0x01, 0x84, 0x23,
+    0x00, 0x00, 0x08, 0x00, 0x90, 0x01, 0x02, 0x22, 0x00, 0x00, 0x08, 0x00,
+    0x91, 0x01, 0x40, 0x0b, 0x04, 0x00, 0x08, 0x00, 0x92, 0x01, 0x2c, 0xa0,
+    0x04, 0x00, 0x08, 0x00, 0x93, 0x01, 0x24, 0x81, 0x00, 0x00, 0x08, 0x00,
+    0x99, 0x01, 0x1a, 0x08, 0x00, 0x00, 0x08, 0x00, 0xa3, 0x01, 0x80, 0x80,
+    0x01, 0x00, 0x08, 0x00, 0xa7, 0x01, 0x28, 0x01, 0x00, 0x00, 0x08, 0x00,
+    0xb2, 0x01, 0x94, 0xa0, 0x04, 0x00, 0x08, 0x00, 0xb4, 0x01, 0x21, 0x01,
+    0x00, 0x40, 0x08, 0x00, 0xbf, 0x01, 0x3c, 0x80, 0x01, 0x00, 0x08, 0x00,
+    0xc8, 0x01, 0x60, 0x80, 0x00, 0x00, 0x08, 0x00, 0xce, 0x01, 0x4c, 0x82,
+    0x00, 0x00, 0x08, 0x00, 0xd5, 0x01, 0x2c, 0xa8, 0x00, 0x00, 0x08, 0x00,
+    0xd8, 0x01, 0x26, 0x88, 0x00, 0x00, 0x08, 0x00, 0xe0, 0x01, 0x90, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0xe4, 0x01, 0xac, 0x80, 0x04, 0x00, 0x08, 0x00,
+    0xe9, 0x01, 0x88, 0xaa, 0x00, 0x00, 0x08, 0x00, 0xea, 0x01, 0x20, 0x01,
+    0x00, 0x00, 0x08, 0x00, 0xeb, 0x01, 0x68, 0x80, 0x00, 0x00, 0x08, 0x00,
+    0xf4, 0x01, 0xc2, 0x83, 0x00, 0x00, 0x08, 0x00, 0xfa, 0x01, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00,
+    0x15, 0x00, 0x10, 0x07, 0x00, 0x00, 0x20, 0x00, 0x26, 0x00, 0x28, 0x08,
+    0x00, 0x00, 0x20, 0x00, 0x35, 0x00, 0x10, 0x03, 0x00, 0x00, 0x28, 0x00,
+    0x42, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x48, 0x00, 0x22, 0x80,
+    0x00, 0x00, 0x20, 0x00, 0x54, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x00,
+    0x57, 0x00, 0x00, 0x26, 0x00, 0x00, 0x20, 0x00, 0x64, 0x00, 0x18, 0x03,
+    0x00, 0x08, 0x20, 0x00, 0x65, 0x00, 0x00, 0x02, 0x20, 0x00, 0x20, 0x00,
+    0x6f, 0x00, 0x04, 0x07, 0x00, 0x00, 0x20, 0x00, 0x72, 0x00, 0x14, 0xa0,
+    0x00, 0x00, 0x20, 0x00, 0x7f, 0x00, 0x20, 0x00, 0x04, 0x00, 0x20, 0x00,
+    0x81, 0x00, 0x00, 0x03, 0x00, 0x00, 0x20, 0x00, 0x8a, 0x00, 0x18, 0x80,
+    0x00, 0x00, 0x20, 0x00, 0x92, 0x00, 0x14, 0x28, 0x20, 0x00, 0x20, 0x00,
+    0x9a, 0x00, 0x34, 0x22, 0x00, 0x00, 0x20, 0x00, 0x9e, 0x00, 0x10, 0x22,
+    0x01, 0x00, 0x20, 0x00, 0xa2, 0x00, 0x08, 0x82, 0x00, 0x00, 0x20, 0x00,
+    0xad, 0x00, 0x90, 0xa8, 0x00, 0x00, 0x20, 0x00, 0xaf, 0x00, 0x20, 0x20,
+    0x00, 0x08, 0x20, 0x00, 0xc0, 0x00, 0x20, 0x80, 0x00, 0x08, 0x20, 0x00,
+    0xc4, 0x00, 0x80, 0x03, 0x00, 0x00, 0x20, 0x00, 0xca, 0x00, 0x00, 0xa0,
+    0x00, 0x00, 0x20, 0x00, 0xcd, 0x00, 0x20, 0x81, 0x00, 0x00, 0x28, 0x00,
+    0xcf, 0x00, 0x00, 0x28, 0x00, 0x00, 0x20, 0x00, 0xd0, 0x00, 0x00, 0x28,
+    0x01, 0x00, 0x20, 0x00, 0xd1, 0x00, 0x29, 0x80, 0x00, 0x00, 0x20, 0x00,
+    0xd3, 0x00, 0xa4, 0x06, 0x00, 0x00, 0x20, 0x00, 0xdd, 0x00, 0x28, 0x00,
+    0x04, 0x00, 0x20, 0x00, 0xdf, 0x00, 0xcc, 0xa8, 0x00, 0x00, 0x20, 0x00,
+    0xe2, 0x00, 0x08, 0x88, 0x00, 0x00, 0x20, 0x00, 0xe3, 0x00, 0x04, 0x82,
+    0x00, 0x00, 0x20, 0x00, 0xe8, 0x00, 0x08, 0xa2, 0x00, 0x00, 0x28, 0x00,
+    0xec, 0x00, 0x01, 0x83, 0x00, 0x00, 0x20, 0x00, 0xf4, 0x00, 0x00, 0xa0,
+    0x00, 0x00, 0x20, 0x00, 0xfb, 0x00, 0x04, 0xa9, 0x00, 0x08, 0x28, 0x00,
+    0x01, 0x01, 0xc2, 0xa3, 0x10, 0x00, 0x20, 0x00, 0x08, 0x01, 0x0a, 0x80,
+    0x00, 0x00, 0x20, 0x00, 0x0b, 0x01, 0x02, 0x28, 0x00, 0x00, 0x20, 0x00,
+    0x10, 0x01, 0x00, 0xa2, 0x00, 0x00, 0x20, 0x00, 0x14, 0x01, 0x94, 0xa0,
+    0x00, 0x00, 0x20, 0x00, 0x15, 0x01, 0x00, 0x02, 0x20, 0x00, 0x20, 0x00,
+    0x18, 0x01, 0x01, 0x28, 0x00, 0x00, 0x20, 0x00, 0x1b, 0x01, 0x84, 0xa8,
+    0x01, 0x00, 0x20, 0x00, 0x1e, 0x01, 0x04, 0x02, 0x00, 0x00, 0x20, 0x00,
+    0x1f, 0x01, 0x28, 0x20, 0x00, 0x08, 0x20, 0x00, 0x32, 0x01, 0xa0, 0x02,
+    0x04, 0x00, 0x20, 0x00, 0x39, 0x01, 0xa0, 0x80, 0x00, 0x08, 0x20, 0x00,
+    0x44, 0x01, 0x00, 0x02, 0x04, 0x40, 0x20, 0x00, 0x47, 0x01, 0x04, 0x06,
+    0x00, 0x00, 0x20, 0x00, 0x48, 0x01, 0x00, 0x89, 0x01, 0x00, 0x20, 0x00,
+    0x4b, 0x01, 0x0c, 0x06, 0x00, 0x00, 0x20, 0x00, 0x4e, 0x01, 0x24, 0x81,
+    0x04, 0x00, 0x20, 0x00, 0x4f, 0x01, 0x44, 0x8a, 0x00, 0x00, 0x20, 0x00,
+    0x56, 0x01, 0x00, 0x81, 0x00, 0x08, 0x20, 0x00, 0x57, 0x01, 0x00, 0xa8,
+    0x00, 0x48, 0x20, 0x00, 0x5e, 0x01, 0x24, 0x80, 0x00, 0x08, 0x20, 0x00,
+    0x69, 0x01, 0x24, 0x81, 0x01, 0x00, 0x20, 0x00, 0x6e, 0x01, 0x98, 0x00,
+    0x04, 0x00, 0x20, 0x00, 0x70, 0x01, 0x24, 0x02, 0x00, 0x40, 0x20, 0x00,
+    0x7b, 0x01, 0x30, 0x29, 0x10, 0x00, 0x20, 0x00, 0x7c, 0x01, 0x20, 0x21,
+    0x00, 0x00, 0x20, 0x00, 0x9b, 0x01, 0x98, 0xa0, 0x00, 0x00, 0x20, 0x00,
+    0x9d, 0x01, 0x44, 0x8a, 0x10, 0x00, 0x20, 0x00, 0x9e, 0x01, 0xb0, 0xaa,
+    0x00, 0x00, 0x28, 0x00, 0xa4, 0x01, 0x00, 0x09, 0x00, 0x08, 0x28, 0x00,
+    0xa6, 0x01, 0x88, 0x02, 0x00, 0x00, 0x20, 0x00, 0xa9, 0x01, 0x98, 0x8a,
+    0x00, 0x00, 0x20, 0x00, 0xaf, 0x01, 0x00, 0xa8, 0x10, 0x00, 0x28, 0x00,
+    0xbb, 0x01, 0x18, 0x22, 0x00, 0x00, 0x20, 0x00, 0xbe, 0x01, 0x24, 0x00,
+    0x00, 0x08, 0x20, 0x00, 0xc1, 0x01, 0x06, 0xa2, 0x00, 0x00, 0x20, 0x00,
+    0xcf, 0x01, 0x24, 0x02, 0x00, 0x00, 0x20, 0x00, 0xd1, 0x01, 0x04, 0x80,
+    0x00, 0x00, 0x20, 0x00, 0xd2, 0x01, 0x20, 0x88, 0x00, 0x00, 0x20, 0x00,
+    0xd9, 0x01, 0xac, 0x80, 0x00, 0x00, 0x20, 0x00, 0xe1, 0x01, 0x25, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0xe3, 0x01, 0x84, 0x08, 0x00, 0x08, 0x20, 0x00,
+    0xe6, 0x01, 0x14, 0x22, 0x20, 0x00, 0x20, 0x00, 0xee, 0x01, 0x20, 0x80,
+    0x00, 0x00, 0x20, 0x00, 0xf0, 0x01, 0x80, 0xa0, 0x00, 0x00, 0x80, 0x00,
+    0xd8, 0x00, 0x62, 0x81, 0x00, 0x00, 0x80, 0x00, 0x2f, 0x01, 0x44, 0xa8,
+    0x00, 0x00, 0x88, 0x00, 0x46, 0x01, 0x08, 0x08, 0x00, 0x00, 0x80, 0x00,
+    0x97, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x80, 0x00, 0xd0, 0x01, 0xc0, 0x80,
+    0x00, 0x00, 0x88, 0x00, 0xf9, 0x01, 0x54, 0x48, 0x45, 0x00, 0x4f, 0x46,
+    0x00, 0x41, 0x4e, 0x44, 0x00, 0x54, 0x4f, 0x00, 0x41, 0x00, 0x49, 0x4e,
+    0x00, 0x54, 0x48, 0x41, 0x54, 0x00, 0x49, 0x53, 0x00, 0x57, 0x41, 0x53,
+    0x00, 0x48, 0x45, 0x00, 0x46, 0x4f, 0x52, 0x00, 0x49, 0x54, 0x00, 0x57,
+    0x49, 0x54, 0x48, 0x00, 0x41, 0x53, 0x00, 0x48, 0x49, 0x53, 0x00, 0x4f,
+    0x4e, 0x00, 0x42, 0x45, 0x00, 0x41, 0x54, 0x00, 0x42, 0x59, 0x00, 0x49,
+    0x00, 0x54, 0x48, 0x49, 0x53, 0x00, 0x48, 0x41, 0x44, 0x00, 0x4e, 0x4f,
+    0x54, 0x00, 0x41, 0x52, 0x45, 0x00, 0x42, 0x55, 0x54, 0x00, 0x46, 0x52,
+    0x4f, 0x4d, 0x00, 0x4f, 0x52, 0x00, 0x48, 0x41, 0x56, 0x45, 0x00, 0x41,
+    0x4e, 0x00, 0x54, 0x48, 0x45, 0x59, 0x00, 0x57, 0x48, 0x49, 0x43, 0x48,
+    0x00, 0x4f, 0x4e, 0x45, 0x00, 0x59, 0x4f, 0x55, 0x00, 0x57, 0x45, 0x52,
+    0x45, 0x00, 0x41, 0x4c, 0x4c, 0x00, 0x48, 0x45, 0x52, 0x00, 0x53, 0x48,
+    0x45, 0x00, 0x54, 0x48, 0x45, 0x52, 0x45, 0x00, 0x57, 0x4f, 0x55, 0x4c,
+    0x44, 0x00, 0x54, 0x48, 0x45, 0x49, 0x52, 0x00, 0x57, 0x45, 0x00, 0x48,
+    0x49, 0x4d, 0x00, 0x42, 0x45, 0x45, 0x4e, 0x00, 0x48, 0x41, 0x53, 0x00,
+    0x57, 0x48, 0x45, 0x4e, 0x00, 0x57, 0x48, 0x4f, 0x00, 0x57, 0x49, 0x4c,
+    0x4c, 0x00, 0x4e, 0x4f, 0x00, 0x4d, 0x4f, 0x52, 0x45, 0x00, 0x49, 0x46,
+    0x00, 0x4f, 0x55, 0x54, 0x00, 0x53, 0x4f, 0x00, 0x55, 0x50, 0x00, 0x53,
+    0x41, 0x49, 0x44, 0x00, 0x57, 0x48, 0x41, 0x54, 0x00, 0x49, 0x54, 0x53,
+    0x00, 0x41, 0x42, 0x4f, 0x55, 0x54, 0x00, 0x54, 0x48, 0x41, 0x4e, 0x00,
+    0x49, 0x4e, 0x54, 0x4f, 0x00, 0x54, 0x48, 0x45, 0x4d, 0x00, 0x43, 0x41,
+    0x4e, 0x00, 0x4f, 0x4e, 0x4c, 0x59, 0x00, 0x4f, 0x54, 0x48, 0x45, 0x52,
+    0x00, 0x54, 0x49, 0x4d, 0x45, 0x00, 0x4e, 0x45, 0x57, 0x00, 0x53, 0x4f,
+    0x4d, 0x45, 0x00, 0x43, 0x4f, 0x55, 0x4c, 0x44, 0x00, 0x54, 0x48, 0x45,
+    0x53, 0x45, 0x00, 0x54, 0x57, 0x4f, 0x00, 0x4d, 0x41, 0x59, 0x00, 0x46,
+    0x49, 0x52, 0x53, 0x54, 0x00, 0x54, 0x48, 0x45, 0x4e, 0x00, 0x44, 0x4f,
+    0x00, 0x41, 0x4e, 0x59, 0x00, 0x4c, 0x49, 0x4b, 0x45, 0x00, 0x4d, 0x59,
+    0x00, 0x4e, 0x4f, 0x57, 0x00, 0x4f, 0x56, 0x45, 0x52, 0x00, 0x53, 0x55,
+    0x43, 0x48, 0x00, 0x4f, 0x55, 0x52, 0x00, 0x4d, 0x41, 0x4e, 0x00, 0x4d,
+    0x45, 0x00, 0x45, 0x56, 0x45, 0x4e, 0x00, 0x4d, 0x4f, 0x53, 0x54, 0x00,
+    0x4d, 0x41, 0x44, 0x45, 0x00, 0x41, 0x46, 0x54, 0x45, 0x52, 0x00, 0x41,
+    0x4c, 0x53, 0x4f, 0x00, 0x44, 0x49, 0x44, 0x00, 0x4d, 0x41, 0x4e, 0x59,
+    0x00, 0x4f, 0x46, 0x46, 0x00, 0x42, 0x45, 0x46, 0x4f, 0x52, 0x45, 0x00,
+    0x4d, 0x55, 0x53, 0x54, 0x00, 0x57, 0x45, 0x4c, 0x4c, 0x00, 0x42, 0x41,
+    0x43, 0x4b, 0x00, 0x54, 0x48, 0x52, 0x4f, 0x55, 0x47, 0x48, 0x00, 0x59,
+    0x45, 0x41, 0x52, 0x53, 0x00, 0x4d, 0x55, 0x43, 0x48, 0x00, 0x57, 0x48,
+    0x45, 0x52, 0x45, 0x00, 0x59, 0x4f, 0x55, 0x52, 0x00, 0x57, 0x41, 0x59,
+    0x00, 0x44, 0x4f, 0x57, 0x4e, 0x00, 0x53, 0x48, 0x4f, 0x55, 0x4c, 0x44,
+    0x00, 0x42, 0x45, 0x43, 0x41, 0x55, 0x53, 0x45, 0x00, 0x45, 0x41, 0x43,
+    0x48, 0x00, 0x4a, 0x55, 0x53, 0x54, 0x00, 0x54, 0x48, 0x4f, 0x53, 0x45,
+    0x00, 0x50, 0x45, 0x4f, 0x50, 0x4c, 0x45, 0x00, 0x48, 0x4f, 0x57, 0x00,
+    0x54, 0x4f, 0x4f, 0x00, 0x4c, 0x49, 0x54, 0x54, 0x4c, 0x45, 0x00, 0x53,
+    0x54, 0x41, 0x54, 0x45, 0x00, 0x47, 0x4f, 0x4f, 0x44, 0x00, 0x56, 0x45,
+    0x52, 0x59, 0x00, 0x4d, 0x41, 0x4b, 0x45, 0x00, 0x57, 0x4f, 0x52, 0x4c,
+    0x44, 0x00, 0x53, 0x54, 0x49, 0x4c, 0x4c, 0x00, 0x53, 0x45, 0x45, 0x00,
+    0x4f, 0x57, 0x4e, 0x00, 0x4d, 0x45, 0x4e, 0x00, 0x57, 0x4f, 0x52, 0x4b,
+    0x00, 0x4c, 0x4f, 0x4e, 0x47, 0x00, 0x48, 0x45, 0x52, 0x45, 0x00, 0x47,
+    0x45, 0x54, 0x00, 0x42, 0x4f, 0x54, 0x48, 0x00, 0x42, 0x45, 0x54, 0x57,
+    0x45, 0x45, 0x4e, 0x00, 0x4c, 0x49, 0x46, 0x45, 0x00, 0x42, 0x45, 0x49,
+    0x4e, 0x47, 0x00, 0x55, 0x4e, 0x44, 0x45, 0x52, 0x00, 0x4e, 0x45, 0x56,
+    0x45, 0x52, 0x00, 0x44, 0x41, 0x59, 0x00, 0x53, 0x41, 0x4d, 0x45, 0x00,
+    0x41, 0x4e, 0x4f, 0x54, 0x48, 0x45, 0x52, 0x00, 0x4b, 0x4e, 0x4f, 0x57,
+    0x00, 0x57, 0x48, 0x49, 0x4c, 0x45, 0x00, 0x4c, 0x41, 0x53, 0x54, 0x00,
+    0x4d, 0x49, 0x47, 0x48, 0x54, 0x00, 0x55, 0x53, 0x00, 0x47, 0x52, 0x45,
+    0x41, 0x54, 0x00, 0x4f, 0x4c, 0x44, 0x00, 0x59, 0x45, 0x41, 0x52, 0x00,
+    0x43, 0x4f, 0x4d, 0x45, 0x00, 0x53, 0x49, 0x4e, 0x43, 0x45, 0x00, 0x41,
+    0x47, 0x41, 0x49, 0x4e, 0x53, 0x54, 0x00, 0x47, 0x4f, 0x00, 0x43, 0x41,
+    0x4d, 0x45, 0x00, 0x52, 0x49, 0x47, 0x48, 0x54, 0x00, 0x55, 0x53, 0x45,
+    0x44, 0x00, 0x54, 0x41, 0x4b, 0x45, 0x00, 0x54, 0x48, 0x52, 0x45, 0x45,
+    0x00, 0x53, 0x54, 0x41, 0x54, 0x45, 0x53, 0x00, 0x48, 0x49, 0x4d, 0x53,
+    0x45, 0x4c, 0x46, 0x00, 0x46, 0x45, 0x57, 0x00, 0x48, 0x4f, 0x55, 0x53,
+    0x45, 0x00, 0x55, 0x53, 0x45, 0x00, 0x44, 0x55, 0x52, 0x49, 0x4e, 0x47,
+    0x00, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x00, 0x41, 0x47, 0x41,
+    0x49, 0x4e, 0x00, 0x50, 0x4c, 0x41, 0x43, 0x45, 0x00, 0x41, 0x52, 0x4f,
+    0x55, 0x4e, 0x44, 0x00, 0x48, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x52, 0x00,
+    0x48, 0x4f, 0x4d, 0x45, 0x00, 0x53, 0x4d, 0x41, 0x4c, 0x4c, 0x00, 0x46,
+    0x4f, 0x55, 0x4e, 0x44, 0x00, 0x54, 0x48, 0x4f, 0x55, 0x47, 0x48, 0x54,
+    0x00, 0x57, 0x45, 0x4e, 0x54, 0x00, 0x53, 0x41, 0x59, 0x00, 0x50, 0x41,
+    0x52, 0x54, 0x00, 0x4f, 0x4e, 0x43, 0x45, 0x00, 0x47, 0x45, 0x4e, 0x45,
+    0x52, 0x41, 0x4c, 0x00, 0x48, 0x49, 0x47, 0x48, 0x00, 0x55, 0x50, 0x4f,
+    0x4e, 0x00, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x00, 0x45, 0x56, 0x45,
+    0x52, 0x59, 0x00, 0x44, 0x4f, 0x45, 0x53, 0x00, 0x47, 0x4f, 0x54, 0x00,
+    0x55, 0x4e, 0x49, 0x54, 0x45, 0x44, 0x00, 0x4c, 0x45, 0x46, 0x54, 0x00,
+    0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52, 0x00, 0x43, 0x4f, 0x55, 0x52, 0x53,
+    0x45, 0x00, 0x57, 0x41, 0x52, 0x00, 0x55, 0x4e, 0x54, 0x49, 0x4c, 0x00,
+    0x41, 0x4c, 0x57, 0x41, 0x59, 0x53, 0x00, 0x41, 0x57, 0x41, 0x59, 0x00,
+    0x53, 0x4f, 0x4d, 0x45, 0x54, 0x48, 0x49, 0x4e, 0x47, 0x00, 0x46, 0x41,
+    0x43, 0x54, 0x00, 0x57, 0x41, 0x54, 0x45, 0x52, 0x00, 0x54, 0x48, 0x4f,
+    0x55, 0x47, 0x48, 0x00, 0x4c, 0x45, 0x53, 0x53, 0x00, 0x50, 0x55, 0x42,
+    0x4c, 0x49, 0x43, 0x00, 0x50, 0x55, 0x54, 0x00, 0x54, 0x48, 0x49, 0x4e,
+    0x4b, 0x00, 0x41, 0x4c, 0x4d, 0x4f, 0x53, 0x54, 0x00, 0x48, 0x41, 0x4e,
+    0x44, 0x00, 0x45, 0x4e, 0x4f, 0x55, 0x47, 0x48, 0x00, 0x46, 0x41, 0x52,
+    0x00, 0x54, 0x4f, 0x4f, 0x4b, 0x00, 0x48, 0x45, 0x41, 0x44, 0x00, 0x59,
+    0x45, 0x54, 0x00, 0x47, 0x4f, 0x56, 0x45, 0x52, 0x4e, 0x4d, 0x45, 0x4e,
+    0x54, 0x00, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4d, 0x00, 0x53, 0x45, 0x54,
+    0x00, 0x42, 0x45, 0x54, 0x54, 0x45, 0x52, 0x00, 0x54, 0x4f, 0x4c, 0x44,
+    0x00, 0x4e, 0x4f, 0x54, 0x48, 0x49, 0x4e, 0x47, 0x00, 0x4e, 0x49, 0x47,
+    0x48, 0x54, 0x00, 0x45, 0x4e, 0x44, 0x00, 0x57, 0x48, 0x59, 0x00, 0x43,
+    0x41, 0x4c, 0x4c, 0x45, 0x44, 0x00, 0x44, 0x49, 0x44, 0x4e, 0x00, 0x46,
+    0x49, 0x4e, 0x44, 0x00, 0x4c, 0x4f, 0x4f, 0x4b, 0x00, 0x41, 0x53, 0x4b,
+    0x45, 0x44, 0x00, 0x4c, 0x41, 0x54, 0x45, 0x52, 0x00, 0x50, 0x4f, 0x49,
+    0x4e, 0x54, 0x00, 0x4b, 0x4e, 0x45, 0x57, 0x00, 0x43, 0x49, 0x54, 0x59,
+    0x00, 0x4e, 0x45, 0x58, 0x54, 0x00, 0x50, 0x52, 0x4f, 0x47, 0x52, 0x41,
+    0x4d, 0x00, 0x42, 0x55, 0x53, 0x49, 0x4e, 0x45, 0x53, 0x53, 0x00, 0x47,
+    0x49, 0x56, 0x45, 0x00, 0x47, 0x52, 0x4f, 0x55, 0x50, 0x00, 0x54, 0x4f,
+    0x57, 0x41, 0x52, 0x44, 0x00, 0x59, 0x4f, 0x55, 0x4e, 0x47, 0x00, 0x44,
+    0x41, 0x59, 0x53, 0x00, 0x4c, 0x45, 0x54, 0x00, 0x52, 0x4f, 0x4f, 0x4d,
+    0x00, 0x50, 0x52, 0x45, 0x53, 0x49, 0x44, 0x45, 0x4e, 0x54, 0x00, 0x53,
+    0x49, 0x44, 0x45, 0x00, 0x53, 0x4f, 0x43, 0x49, 0x41, 0x4c, 0x00, 0x47,
+    0x49, 0x56, 0x45, 0x4e, 0x00, 0x50, 0x52, 0x45, 0x53, 0x45, 0x4e, 0x54,
+    0x00, 0x53, 0x45, 0x56, 0x45, 0x52, 0x41, 0x4c, 0x00, 0x4f, 0x52, 0x44,
+    0x45, 0x52, 0x00, 0x4e, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x41, 0x4c, 0x00,
+    0x50, 0x4f, 0x53, 0x53, 0x49, 0x42, 0x4c, 0x45, 0x00, 0x52, 0x41, 0x54,
+    0x48, 0x45, 0x52, 0x00, 0x53, 0x45, 0x43, 0x4f, 0x4e, 0x44, 0x00, 0x46,
+    0x41, 0x43, 0x45, 0x00, 0x50, 0x45, 0x52, 0x00, 0x41, 0x4d, 0x4f, 0x4e,
+    0x47, 0x00, 0x46, 0x4f, 0x52, 0x4d, 0x00, 0x49, 0x4d, 0x50, 0x4f, 0x52,
+    0x54, 0x41, 0x4e, 0x54, 0x00, 0x4f, 0x46, 0x54, 0x45, 0x4e, 0x00, 0x54,
+    0x48, 0x49, 0x4e, 0x47, 0x53, 0x00, 0x4c, 0x4f, 0x4f, 0x4b, 0x45, 0x44,
+    0x00, 0x45, 0x41, 0x52, 0x4c, 0x59, 0x00, 0x57, 0x48, 0x49, 0x54, 0x45,
+    0x00, 0x4a, 0x4f, 0x48, 0x4e, 0x00, 0x43, 0x41, 0x53, 0x45, 0x00, 0x42,
+    0x45, 0x43, 0x4f, 0x4d, 0x45, 0x00, 0x4c, 0x41, 0x52, 0x47, 0x45, 0x00,
+    0x4e, 0x45, 0x45, 0x44, 0x00, 0x42, 0x49, 0x47, 0x00, 0x46, 0x4f, 0x55,
+    0x52, 0x00, 0x57, 0x49, 0x54, 0x48, 0x49, 0x4e, 0x00, 0x46, 0x45, 0x4c,
+    0x54, 0x00, 0x41, 0x4c, 0x4f, 0x4e, 0x47, 0x00, 0x43, 0x48, 0x49, 0x4c,
+    0x44, 0x52, 0x45, 0x4e, 0x00, 0x53, 0x41, 0x57, 0x00, 0x42, 0x45, 0x53,
+    0x54, 0x00, 0x43, 0x48, 0x55, 0x52, 0x43, 0x48, 0x00, 0x45, 0x56, 0x45,
+    0x52, 0x00, 0x4c, 0x45, 0x41, 0x53, 0x54, 0x00, 0x50, 0x4f, 0x57, 0x45,
+    0x52, 0x00, 0x44, 0x45, 0x56, 0x45, 0x4c, 0x4f, 0x50, 0x4d, 0x45, 0x4e,
+    0x54, 0x00, 0x4c, 0x49, 0x47, 0x48, 0x54, 0x00, 0x54, 0x48, 0x49, 0x4e,
+    0x47, 0x00, 0x53, 0x45, 0x45, 0x4d, 0x45, 0x44, 0x00, 0x46, 0x41, 0x4d,
+    0x49, 0x4c, 0x59, 0x00, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x45, 0x53, 0x54,
+    0x00, 0x57, 0x41, 0x4e, 0x54, 0x00, 0x4d, 0x45, 0x4d, 0x42, 0x45, 0x52,
+    0x53, 0x00, 0x4d, 0x49, 0x4e, 0x44, 0x00, 0x43, 0x4f, 0x55, 0x4e, 0x54,
+    0x52, 0x59, 0x00, 0x41, 0x52, 0x45, 0x41, 0x00, 0x4f, 0x54, 0x48, 0x45,
+    0x52, 0x53, 0x00, 0x44, 0x4f, 0x4e, 0x45, 0x00, 0x54, 0x55, 0x52, 0x4e,
+    0x45, 0x44, 0x00, 0x41, 0x4c, 0x54, 0x48, 0x4f, 0x55, 0x47, 0x48, 0x00,
+    0x4f, 0x50, 0x45, 0x4e, 0x00, 0x47, 0x4f, 0x44, 0x00, 0x53, 0x45, 0x52,
+    0x56, 0x49, 0x43, 0x45, 0x00, 0x43, 0x45, 0x52, 0x54, 0x41, 0x49, 0x4e,
+    0x00, 0x4b, 0x49, 0x4e, 0x44, 0x00, 0x50, 0x52, 0x4f, 0x42, 0x4c, 0x45,
+    0x4d, 0x00, 0x42, 0x45, 0x47, 0x41, 0x4e, 0x00, 0x44, 0x49, 0x46, 0x46,
+    0x45, 0x52, 0x45, 0x4e, 0x54, 0x00, 0x44, 0x4f, 0x4f, 0x52, 0x00, 0x54,
+    0x48, 0x55, 0x53, 0x00, 0x48, 0x45, 0x4c, 0x50, 0x00, 0x53, 0x45, 0x4e,
+    0x53, 0x45, 0x00, 0x4d, 0x45, 0x41, 0x4e, 0x53, 0x00, 0x57, 0x48, 0x4f,
+    0x4c, 0x45, 0x00, 0x4d, 0x41, 0x54, 0x54, 0x45, 0x52, 0x00, 0x50, 0x45,
+    0x52, 0x48, 0x41, 0x50, 0x53, 0x00, 0x49, 0x54, 0x53, 0x45, 0x4c, 0x46,
+    0x00, 0x59, 0x4f, 0x52, 0x4b, 0x00, 0x54, 0x49, 0x4d, 0x45, 0x53, 0x00,
+    0x4c, 0x41, 0x57, 0x00, 0x48, 0x55, 0x4d, 0x41, 0x4e, 0x00, 0x4c, 0x49,
+    0x4e, 0x45, 0x00, 0x41, 0x42, 0x4f, 0x56, 0x45, 0x00, 0x4e, 0x41, 0x4d,
+    0x45, 0x00, 0x45, 0x58, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x00, 0x41, 0x43,
+    0x54, 0x49, 0x4f, 0x4e, 0x00, 0x43, 0x4f, 0x4d, 0x50, 0x41, 0x4e, 0x59,
+    0x00, 0x48, 0x41, 0x4e, 0x44, 0x53, 0x00, 0x4c, 0x4f, 0x43, 0x41, 0x4c,
+    0x00, 0x53, 0x48, 0x4f, 0x57, 0x00, 0x57, 0x48, 0x45, 0x54, 0x48, 0x45,
+    0x52, 0x00, 0x46, 0x49, 0x56, 0x45, 0x00, 0x48, 0x49, 0x53, 0x54, 0x4f,
+    0x52, 0x59, 0x00, 0x47, 0x41, 0x56, 0x45, 0x00, 0x54, 0x4f, 0x44, 0x41,
+    0x59, 0x00, 0x45, 0x49, 0x54, 0x48, 0x45, 0x52, 0x00, 0x41, 0x43, 0x54,
+    0x00, 0x46, 0x45, 0x45, 0x54, 0x00, 0x41, 0x43, 0x52, 0x4f, 0x53, 0x53,
+    0x00, 0x54, 0x41, 0x4b, 0x45, 0x4e, 0x00, 0x50, 0x41, 0x53, 0x54, 0x00,
+    0x51, 0x55, 0x49, 0x54, 0x45, 0x00, 0x41, 0x4e, 0x59, 0x54, 0x48, 0x49,
+    0x4e, 0x47, 0x00, 0x53, 0x45, 0x45, 0x4e, 0x00, 0x48, 0x41, 0x56, 0x49,
+    0x4e, 0x47, 0x00, 0x44, 0x45, 0x41, 0x54, 0x48, 0x00, 0x57, 0x45, 0x45,
+    0x4b, 0x00, 0x45, 0x58, 0x50, 0x45, 0x52, 0x49, 0x45, 0x4e, 0x43, 0x45,
+    0x00, 0x42, 0x4f, 0x44, 0x59, 0x00, 0x57, 0x4f, 0x52, 0x44, 0x00, 0x48,
+    0x41, 0x4c, 0x46, 0x00, 0x52, 0x45, 0x41, 0x4c, 0x4c, 0x59, 0x00, 0x46,
+    0x49, 0x45, 0x4c, 0x44, 0x00, 0x41, 0x4d, 0x00, 0x43, 0x41, 0x52, 0x00,
+    0x57, 0x4f, 0x52, 0x44, 0x53, 0x00, 0x41, 0x4c, 0x52, 0x45, 0x41, 0x44,
+    0x59, 0x00, 0x54, 0x48, 0x45, 0x4d, 0x53, 0x45, 0x4c, 0x56, 0x45, 0x53,
+    0x00, 0x49, 0x4e, 0x46, 0x4f, 0x52, 0x4d, 0x41, 0x54, 0x49, 0x4f, 0x4e,
+    0x00, 0x54, 0x45, 0x4c, 0x4c, 0x00, 0x43, 0x4f, 0x4c, 0x4c, 0x45, 0x47,
+    0x45, 0x00, 0x53, 0x48, 0x41, 0x4c, 0x4c, 0x00, 0x4d, 0x4f, 0x4e, 0x45,
+    0x59, 0x00, 0x50, 0x45, 0x52, 0x49, 0x4f, 0x44, 0x00, 0x48, 0x45, 0x4c,
+    0x44, 0x00, 0x4b, 0x45, 0x45, 0x50, 0x00, 0x53, 0x55, 0x52, 0x45, 0x00,
+    0x50, 0x52, 0x4f, 0x42, 0x41, 0x42, 0x4c, 0x59, 0x00, 0x46, 0x52, 0x45,
+    0x45, 0x00, 0x53, 0x45, 0x45, 0x4d, 0x53, 0x00, 0x52, 0x45, 0x41, 0x4c,
+    0x00, 0x42, 0x45, 0x48, 0x49, 0x4e, 0x44, 0x00, 0x43, 0x41, 0x4e, 0x4e,
+    0x4f, 0x54, 0x00, 0x4d, 0x49, 0x53, 0x53, 0x00, 0x50, 0x4f, 0x4c, 0x49,
+    0x54, 0x49, 0x43, 0x41, 0x4c, 0x00, 0x41, 0x49, 0x52, 0x00, 0x51, 0x55,
+    0x45, 0x53, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x4d, 0x41, 0x4b, 0x49, 0x4e,
+    0x47, 0x00, 0x4f, 0x46, 0x46, 0x49, 0x43, 0x45, 0x00, 0x42, 0x52, 0x4f,
+    0x55, 0x47, 0x48, 0x54, 0x00, 0x57, 0x48, 0x4f, 0x53, 0x45, 0x00, 0x53,
+    0x50, 0x45, 0x43, 0x49, 0x41, 0x4c, 0x00, 0x48, 0x45, 0x41, 0x52, 0x44,
+    0x00, 0x4d, 0x41, 0x4a, 0x4f, 0x52, 0x00, 0x50, 0x52, 0x4f, 0x42, 0x4c,
+    0x45, 0x4d, 0x53, 0x00, 0x41, 0x47, 0x4f, 0x00, 0x42, 0x45, 0x43, 0x41,
+    0x4d, 0x45, 0x00, 0x46, 0x45, 0x44, 0x45, 0x52, 0x41, 0x4c, 0x00, 0x4d,
+    0x4f, 0x4d, 0x45, 0x4e, 0x54, 0x00, 0x53, 0x54, 0x55, 0x44, 0x59, 0x00,
+    0x41, 0x56, 0x41, 0x49, 0x4c, 0x41, 0x42, 0x4c, 0x45, 0x00, 0x4b, 0x4e,
+    0x4f, 0x57, 0x4e, 0x00, 0x52, 0x45, 0x53, 0x55, 0x4c, 0x54, 0x00, 0x53,
+    0x54, 0x52, 0x45, 0x45, 0x54, 0x00, 0x45, 0x43, 0x4f, 0x4e, 0x4f, 0x4d,
+    0x49, 0x43, 0x00, 0x42, 0x4f, 0x59, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54,
+    0x49, 0x4f, 0x4e, 0x00, 0x52, 0x45, 0x41, 0x53, 0x4f, 0x4e, 0x00, 0x43,
+    0x48, 0x41, 0x4e, 0x47, 0x45, 0x00, 0x53, 0x4f, 0x55, 0x54, 0x48, 0x00,
+    0x42, 0x4f, 0x41, 0x52, 0x44, 0x00, 0x49, 0x4e, 0x44, 0x49, 0x56, 0x49,
+    0x44, 0x55, 0x41, 0x4c, 0x00, 0x4a, 0x4f, 0x42, 0x00, 0x53, 0x4f, 0x43,
+    0x49, 0x45, 0x54, 0x59, 0x00, 0x41, 0x52, 0x45, 0x41, 0x53, 0x00, 0x57,
+    0x45, 0x53, 0x54, 0x00, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0x00, 0x54, 0x55,
+    0x52, 0x4e, 0x00, 0x4c, 0x4f, 0x56, 0x45, 0x00, 0x43, 0x4f, 0x4d, 0x4d,
+    0x55, 0x4e, 0x49, 0x54, 0x59, 0x00, 0x54, 0x52, 0x55, 0x45, 0x00, 0x43,
+    0x4f, 0x55, 0x52, 0x54, 0x00, 0x46, 0x4f, 0x52, 0x43, 0x45, 0x00, 0x46,
+    0x55, 0x4c, 0x4c, 0x00, 0x53, 0x45, 0x45, 0x4d, 0x00, 0x57, 0x49, 0x46,
+    0x45, 0x00, 0x41, 0x47, 0x45, 0x00, 0x46, 0x55, 0x54, 0x55, 0x52, 0x45,
+    0x00, 0x56, 0x4f, 0x49, 0x43, 0x45, 0x00, 0x43, 0x45, 0x4e, 0x54, 0x45,
+    0x52, 0x00, 0x57, 0x4f, 0x4d, 0x41, 0x4e, 0x00, 0x43, 0x4f, 0x4e, 0x54,
+    0x52, 0x4f, 0x4c, 0x00, 0x43, 0x4f, 0x4d, 0x4d, 0x4f, 0x4e, 0x00, 0x50,
+    0x4f, 0x4c, 0x49, 0x43, 0x59, 0x00, 0x4e, 0x45, 0x43, 0x45, 0x53, 0x53,
+    0x41, 0x52, 0x59, 0x00, 0x46, 0x4f, 0x4c, 0x4c, 0x4f, 0x57, 0x49, 0x4e,
+    0x47, 0x00, 0x46, 0x52, 0x4f, 0x4e, 0x54, 0x00, 0x53, 0x4f, 0x4d, 0x45,
+    0x54, 0x49, 0x4d, 0x45, 0x53, 0x00, 0x53, 0x49, 0x58, 0x00, 0x47, 0x49,
+    0x52, 0x4c, 0x00, 0x43, 0x4c, 0x45, 0x41, 0x52, 0x00, 0x46, 0x55, 0x52,
+    0x54, 0x48, 0x45, 0x52, 0x00, 0x4c, 0x41, 0x4e, 0x44, 0x00, 0x52, 0x55,
+    0x4e, 0x00, 0x53, 0x54, 0x55, 0x44, 0x45, 0x4e, 0x54, 0x53, 0x00, 0x50,
+    0x52, 0x4f, 0x56, 0x49, 0x44, 0x45, 0x00, 0x46, 0x45, 0x45, 0x4c, 0x00,
+    0x50, 0x41, 0x52, 0x54, 0x59, 0x00, 0x41, 0x42, 0x4c, 0x45, 0x00, 0x4d,
+    0x4f, 0x54, 0x48, 0x45, 0x52, 0x00, 0x4d, 0x55, 0x53, 0x49, 0x43, 0x00,
+    0x45, 0x44, 0x55, 0x43, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x55, 0x4e,
+    0x49, 0x56, 0x45, 0x52, 0x53, 0x49, 0x54, 0x59, 0x00, 0x43, 0x48, 0x49,
+    0x4c, 0x44, 0x00, 0x45, 0x46, 0x46, 0x45, 0x43, 0x54, 0x00, 0x4c, 0x45,
+    0x56, 0x45, 0x4c, 0x00, 0x53, 0x54, 0x4f, 0x4f, 0x44, 0x00, 0x4d, 0x49,
+    0x4c, 0x49, 0x54, 0x41, 0x52, 0x59, 0x00, 0x54, 0x4f, 0x57, 0x4e, 0x00,
+    0x53, 0x48, 0x4f, 0x52, 0x54, 0x00, 0x4d, 0x4f, 0x52, 0x4e, 0x49, 0x4e,
+    0x47, 0x00, 0x54, 0x4f, 0x54, 0x41, 0x4c, 0x00, 0x4f, 0x55, 0x54, 0x53,
+    0x49, 0x44, 0x45, 0x00, 0x52, 0x41, 0x54, 0x45, 0x00, 0x46, 0x49, 0x47,
+    0x55, 0x52, 0x45, 0x00, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x00, 0x41, 0x52,
+    0x54, 0x00, 0x43, 0x45, 0x4e, 0x54, 0x55, 0x52, 0x59, 0x00, 0x57, 0x41,
+    0x53, 0x48, 0x49, 0x4e, 0x47, 0x54, 0x4f, 0x4e, 0x00, 0x4e, 0x4f, 0x52,
+    0x54, 0x48, 0x00, 0x55, 0x53, 0x55, 0x41, 0x4c, 0x4c, 0x59, 0x00, 0x50,
+    0x4c, 0x41, 0x4e, 0x00, 0x4c, 0x45, 0x41, 0x56, 0x45, 0x00, 0x54, 0x48,
+    0x45, 0x52, 0x45, 0x46, 0x4f, 0x52, 0x45, 0x00, 0x45, 0x56, 0x49, 0x44,
+    0x45, 0x4e, 0x43, 0x45, 0x00, 0x54, 0x4f, 0x50, 0x00, 0x4d, 0x49, 0x4c,
+    0x4c, 0x49, 0x4f, 0x4e, 0x00, 0x53, 0x4f, 0x55, 0x4e, 0x44, 0x00, 0x42,
+    0x4c, 0x41, 0x43, 0x4b, 0x00, 0x53, 0x54, 0x52, 0x4f, 0x4e, 0x47, 0x00,
+    0x48, 0x41, 0x52, 0x44, 0x00, 0x56, 0x41, 0x52, 0x49, 0x4f, 0x55, 0x53,
+    0x00, 0x53, 0x41, 0x59, 0x53, 0x00, 0x42, 0x45, 0x4c, 0x49, 0x45, 0x56,
+    0x45, 0x00, 0x54, 0x59, 0x50, 0x45, 0x00, 0x56, 0x41, 0x4c, 0x55, 0x45,
+    0x00, 0x50, 0x4c, 0x41, 0x59, 0x00, 0x53, 0x55, 0x52, 0x46, 0x41, 0x43,
+    0x45, 0x00, 0x53, 0x4f, 0x4f, 0x4e, 0x00, 0x4d, 0x45, 0x41, 0x4e, 0x00,
+    0x4e, 0x45, 0x41, 0x52, 0x00, 0x4c, 0x49, 0x4e, 0x45, 0x53, 0x00, 0x54,
+    0x41, 0x42, 0x4c, 0x45, 0x00, 0x50, 0x45, 0x41, 0x43, 0x45, 0x00, 0x4d,
+    0x4f, 0x44, 0x45, 0x52, 0x4e, 0x00, 0x54, 0x41, 0x58, 0x00, 0x52, 0x4f,
+    0x41, 0x44, 0x00, 0x52, 0x45, 0x44, 0x00, 0x42, 0x4f, 0x4f, 0x4b, 0x00,
+    0x50, 0x45, 0x52, 0x53, 0x4f, 0x4e, 0x41, 0x4c, 0x00, 0x50, 0x52, 0x4f,
+    0x43, 0x45, 0x53, 0x53, 0x00, 0x53, 0x49, 0x54, 0x55, 0x41, 0x54, 0x49,
+    0x4f, 0x4e, 0x00, 0x4d, 0x49, 0x4e, 0x55, 0x54, 0x45, 0x53, 0x00, 0x49,
+    0x4e, 0x43, 0x52, 0x45, 0x41, 0x53, 0x45, 0x00, 0x49, 0x44, 0x45, 0x41,
+    0x00, 0x45, 0x4e, 0x47, 0x4c, 0x49, 0x53, 0x48, 0x00, 0x41, 0x4c, 0x4f,
+    0x4e, 0x45, 0x00, 0x57, 0x4f, 0x4d, 0x45, 0x4e, 0x00, 0x47, 0x4f, 0x4e,
+    0x45, 0x00, 0x4e, 0x4f, 0x52, 0x00, 0x4c, 0x49, 0x56, 0x49, 0x4e, 0x47,
+    0x00, 0x41, 0x4d, 0x45, 0x52, 0x49, 0x43, 0x41, 0x00, 0x53, 0x54, 0x41,
+    0x52, 0x54, 0x45, 0x44, 0x00, 0x4c, 0x4f, 0x4e, 0x47, 0x45, 0x52, 0x00,
+    0x44, 0x41, 0x52, 0x4b, 0x00, 0x43, 0x55, 0x54, 0x00, 0x46, 0x49, 0x4e,
+    0x41, 0x4c, 0x4c, 0x59, 0x00, 0x54, 0x48, 0x49, 0x52, 0x44, 0x00, 0x4e,
+    0x41, 0x54, 0x55, 0x52, 0x45, 0x00, 0x50, 0x52, 0x49, 0x56, 0x41, 0x54,
+    0x45, 0x00, 0x53, 0x45, 0x43, 0x52, 0x45, 0x54, 0x41, 0x52, 0x59, 0x00,
+    0x53, 0x45, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x43, 0x41, 0x4c, 0x4c,
+    0x00, 0x46, 0x49, 0x52, 0x45, 0x00, 0x4b, 0x45, 0x50, 0x54, 0x00, 0x47,
+    0x52, 0x4f, 0x55, 0x4e, 0x44, 0x00, 0x56, 0x49, 0x45, 0x57, 0x00, 0x44,
+    0x45, 0x41, 0x44, 0x00, 0x50, 0x52, 0x45, 0x53, 0x53, 0x55, 0x52, 0x45,
+    0x00, 0x45, 0x56, 0x45, 0x52, 0x59, 0x54, 0x48, 0x49, 0x4e, 0x47, 0x00,
+    0x42, 0x41, 0x53, 0x49, 0x53, 0x00, 0x53, 0x50, 0x41, 0x43, 0x45, 0x00,
+    0x45, 0x41, 0x53, 0x54, 0x00, 0x46, 0x41, 0x54, 0x48, 0x45, 0x52, 0x00,
+    0x53, 0x50, 0x49, 0x52, 0x49, 0x54, 0x00, 0x55, 0x4e, 0x49, 0x4f, 0x4e,
+    0x00, 0x45, 0x58, 0x43, 0x45, 0x50, 0x54, 0x00, 0x43, 0x4f, 0x4d, 0x50,
+    0x4c, 0x45, 0x54, 0x45, 0x00, 0x57, 0x52, 0x4f, 0x54, 0x45, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+};
@@ -0,0 +1,127 @@
+/*
+
+  Frequency-weighted practice words (see wordlist.h).
+
+  The same reads serve a list in the content store and the one built into
+  flash: readAt() copies from whichever is in use.  A list in the store is
+  only open while a word is drawn, so it does not hold one of the store's
+  file handles between words.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "main.h"
+#include "storage.h"
+#include "wordlist.h"
+
+static const uint8_t *listData = NULL;  // built-in list, or NULL
+static File listFile;                   // list in the store, while drawing
+static bool inStore = false;            // list is WORDLIST_FILE
+static WORDLIST_HEADER listHeader;
+static uint16_t kochStart[WORDLIST_LEVELS + 1];  // first tag of each level
+
+static bool readAt(uint32_t pos, void *buf, int len) {
+  if (listData) {
+    memcpy(buf, listData + pos, len);
+    return true;
+  }
+  if (!listFile && inStore) listFile = store().open(WORDLIST_FILE);
+  return listFile && listFile.seek(pos) &&
+         listFile.read((uint8_t *)buf, len) == len;
+}
+
+static bool drawn(bool ok)  // end of a draw: let the file go
+{
+  if (listFile) listFile.close();
+  return ok;
+}
+
+// Use the store's list if it has one, otherwise the built-in list
+bool wordListOpen(void) {
+  wordListClose();
+  if (store().exists(WORDLIST_FILE)) {
+    inStore = true;
+    if (readAt(0, &listHeader, sizeof(listHeader)) &&
+        listHeader.magic == WORDLIST_MAGIC && listHeader.count &&
+        readAt(listHeader.koch, kochStart, sizeof(kochStart)))
+      return drawn(true);
+    Serial.println("Words: " WORDLIST_FILE " is not a word list");
+    wordListClose();
+  }
+  memcpy(&listHeader, wordListData, sizeof(listHeader));
+  if (listHeader.magic != WORDLIST_MAGIC) {
+    listHeader.count = 0;
+    return false;
+  }
+  listData = wordListData;
+  readAt(listHeader.koch, kochStart, sizeof(kochStart));
+  return listHeader.count > 0;
+}
+
+long wordListCount(void) { return listHeader.count; }
+
+// Copy word number i, cut to fit size
+static bool readWord(uint32_t i, char *word, int size) {
+  uint32_t offset;
+  if (!readAt(sizeof(listHeader) + listHeader.count * sizeof(WORDLIST_ALIAS) +
+                  i * 4,
+              &offset, 4))
+    return false;
+  if (size > WORDLIST_LEN) size = WORDLIST_LEN;
+  if (!readAt(listHeader.text + offset, word, size - 1)) {
+    word[0] = 0;  // file cut short
+    return false;
+  }
+  word[size - 1] = 0;  // longer words are cut to fit
+  return word[0] != 0;
+}
+
+// A word, drawn by frequency.  False if there is no list or it cannot be
+// read.
+bool wordListPick(char *word, int size) {
+  WORDLIST_ALIAS a;
+  if (!listHeader.count || size < 2) return false;
+  uint32_t i = random(0, listHeader.count);
+  if (!readAt(sizeof(listHeader) + i * sizeof(a), &a, sizeof(a)))
+    return drawn(false);
+  if (random(0, WORDLIST_ONE) >= a.cut) i = a.alias;
+  return drawn(readWord(i, word, size));
+}
+
+// Number of words made only of koch[0..lesson]
+long wordListKochCount(int lesson) {
+  if (!listHeader.count || lesson < 0) return 0;
+  if (lesson >= WORDLIST_LEVELS) lesson = WORDLIST_LEVELS - 1;
+  return kochStart[lesson + 1];
+}
+
+// A word made only of koch[0..lesson], drawn evenly.  If "want" has bits
+// set (as in WORDLIST_KOCH), a few draws are made to find a word with one
+// of those characters; the last is taken if none has.  False if no word
+// fits the lesson.
+bool wordListKochPick(int lesson, uint64_t want, char *word, int size) {
+  WORDLIST_KOCH k;
+  long n = wordListKochCount(lesson);
+  if (!n || size < 2) return false;
+  for (int tries = 0; tries < WORDLIST_TRIES; tries++) {
+    uint32_t i = random(0, n);
+    if (!readAt(listHeader.koch + sizeof(kochStart) + i * sizeof(k), &k,
+                sizeof(k)))
+      return drawn(false);
+    uint64_t used = ((uint64_t)k.high << 32) | k.low;
+    if (!want || (used & want)) break;
+  }
+  return drawn(readWord(k.word, word, size));
+}
+
+void wordListClose(void) {
+  if (listFile) listFile.close();
+  inStore = false;
+  listData = NULL;
+  listHeader.count = 0;
+}
@@ -0,0 +1,72 @@
+#ifndef _WORDLIST_H_
+#define _WORDLIST_H_
+
+// Portable layout: lists are made by tools/words on a computer.
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+
+//===================================  Word List Constants
+//===============================
+// Practice words are drawn from a list of up to WORDLIST_MAX words, each in
+// proportion to its weight: how often it is used, or for a list without
+// counts (such as the built-in one) an estimate from its rank.  The list
+// carries a precomputed alias table, so a draw is two random numbers and
+// three small reads whatever the size of the list, with no floating point:
+// pick entry i at random, keep i if the second number is below its cut,
+// otherwise take its alias.  A
+// WORDLIST_FILE in the content store (see storage.h) is used if there is
+// one, otherwise the list built into flash.
+//
+// Each word that uses only Koch characters is also tagged with the set of
+// them it uses, one bit per character in KOCH_ORDER, and the tags are
+// sorted by the word's Koch level: the place in KOCH_ORDER of its latest
+// character.  start[n] is the first tag of level n or above, so the words
+// playable at lesson n (koch[0..n]) are the first start[n + 1] tags, and
+// those that bring in koch[n] run from start[n].  Only the starts are kept
+// in RAM.
+//
+// Layout: a WORDLIST_HEADER, a WORDLIST_ALIAS per word, a 32-bit offset per
+// word into the text, the Koch index (WORDLIST_LEVELS + 1 16-bit starts,
+// then a WORDLIST_KOCH per tagged word), and the text: each word ending in
+// a 0, then WORDLIST_LEN more 0s so a word can always be read whole.
+#define WORDLIST_FILE "/WORDS.MTW"
+#define WORDLIST_MAGIC 0x3257544DUL  // "MTW2"
+#define WORDLIST_MAX 65535           // most words in a list
+#define WORDLIST_LEN 16              // longest word + 1
+#define WORDLIST_ONE 65536L          // a cut of n keeps an entry n times in this
+#define KOCH_ORDER "KMRSUAPTLOWI.NJEF0Y,VG5/Q9ZH38B?427C1D6X"
+#define WORDLIST_LEVELS 40           // characters in KOCH_ORDER
+#define WORDLIST_TRIES 8             // draws to find a word with a wanted char
+
+typedef struct {
+  uint32_t magic;  // WORDLIST_MAGIC
+  uint32_t count;  // words
+  uint32_t koch;   // file offset of the Koch index
+  uint32_t text;   // file offset of the first word
+} WORDLIST_HEADER;
+
+typedef struct {
+  uint16_t cut;    // keep this word if a draw below WORDLIST_ONE is < cut
+  uint16_t alias;  // word taken otherwise (itself if it is always kept)
+} WORDLIST_ALIAS;
+
+typedef struct {
+  uint32_t low;    // Koch characters used: bit i is KOCH_ORDER[i]
+  uint16_t high;   //   and bit 32 + i is KOCH_ORDER[32 + i]
+  uint16_t word;   // the word's number
+} WORDLIST_KOCH;
+
+extern const uint8_t wordListData[];  // made by tools/words (worddata.cpp)
+
+// Function Prototypes
+bool wordListOpen(void);
+long wordListCount(void);
+bool wordListPick(char *word, int size);
+long wordListKochCount(int lesson);
+bool wordListKochPick(int lesson, uint64_t want, char *word, int size);
+void wordListClose(void);
+
+#endif  // _WORDLIST_H_
@@ -24,6 +24,7 @@ char commands[MAX_COMMAND_ENTRIES];
 unsigned char command_entries;
 unsigned long numbers[MAX_COMMAND_ENTRIES];
 unsigned char ctr;
+extern Print *cliOut;  // Defined in main.cpp
 
 char prompt[6] = {0xa, 0xd, ':', '>', ' ', 0x0};
 char ovflmsg[9] = {'O', 'v', 'e', 'r', 'f', 'l', 'o', 'w', 0x0};
@@ -67,7 +68,7 @@ void processSerial(void)
   // none are left. This routine is faster that a user's typing and it needs to
   // check for CR/LF
   while (Serial.available() > 0) {
-    if (ctr < sizeof(rbuff)) {
+    if (ctr < sizeof(rbuff) - 1) {  // keep rbuff null terminated
       temp = Serial.read();        // Read a character
       Serial.write(temp);          // Echo the character back to the user
       if (isPrintable(temp)) {  // If the character is alphabetic than store
@@ -88,7 +89,7 @@ void processSerial(void)
     // This checks to see if the users has entered too much data which would
     // overflew the serial buffer the UART.h file details the MAX number of
     // characters
-    if (ctr > sizeof(rbuff)) {
+    if (ctr >= sizeof(rbuff) - 1) {
       Serial.println("Overflow");
       resetSerial();
       Serial.write(prompt);
@@ -112,15 +113,16 @@ unsigned char parseSerial(char* str)
        i++) {  // Step through the serial buffer - str is a pointer to the
                // serial buffer
     if (isalpha(str[i])) {  // Its alphabetic so store it in commands[]
-      commands[j++] = toupper(str[i]);
+      if (j < MAX_COMMAND_ENTRIES) commands[j++] = toupper(str[i]);
     } else if (isdigit(str[i])) {
-      numbers[k++] = strtol((char*)&str[i], NULL, 10);
+      if (k < MAX_COMMAND_ENTRIES)
+        numbers[k++] = strtol((char*)&str[i], NULL, 10);
       while (isdigit(str[i + 1])) {
         if (i >= strlen(str)) break;
         i++;
       }
     } else if (isgraph(str[i])) {
-      commands[j++] = str[i];
+      if (j < MAX_COMMAND_ENTRIES) commands[j++] = str[i];
     }
   }
   return j;
@@ -130,7 +132,7 @@ void errorOut(void)
 // This routine is used to print out an error message.
 // An argument could be passed with an error code which is decoded here.
 {
-  Serial.println(errmsg);
+  cliOut->println(errmsg);
 }
 
 #endif  // REMOVE_CLI
@@ -0,0 +1,137 @@
+/*
+
+  Resume positions for SD card texts.
+
+  BOOKMARK_FILE is BOOKMARK_SLOTS fixed-size records, each updated in place,
+  so saving a position writes one record however many files are known.  A
+  record is keyed by a hash of the file's path and remembers its size too:
+  a file that has been replaced by another of a different size starts over.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "main.h"
+#include "storage.h"
+#include "bookmark.h"
+
+typedef struct {
+  uint32_t hash;    // of the full path, 0 = unused slot
+  uint32_t offset;  // byte to resume from
+  uint32_t size;    // file size when saved
+  uint32_t stamp;   // higher = used more recently
+} BOOKMARK;
+
+BOOKMARK mark;                 // the file being played
+int markSlot = -1;             // its record, -1 = none open
+uint32_t markSaved;            // offset last written to the card
+unsigned long markTime;        // millis() of that write
+
+static uint32_t pathHash(const char *path) {  // FNV-1a, never 0
+  uint32_t hash = 2166136261UL;
+  for (; *path; path++) hash = (hash ^ (uint8_t)*path) * 16777619UL;
+  return hash ? hash : 1;
+}
+
+static void putMark(int slot, BOOKMARK *m) {
+  File f = store().open(BOOKMARK_FILE, "r+");  // update in place
+  if (!f) {
+    Serial.println("Bookmark: cannot write " BOOKMARK_FILE);
+    return;
+  }
+  f.seek(slot * sizeof(BOOKMARK));
+  f.write((uint8_t *)m, sizeof(BOOKMARK));
+  f.close();
+}
+
+static void writeMark(void) {
+  putMark(markSlot, &mark);
+  markSaved = mark.offset;
+  markTime = millis();
+}
+
+// Find the record for a path, or the least recently used one to replace
+// (never the open file's).  Fills in "m" ready to write back: offset is 0 for
+// a new, changed or finished file.  Returns the slot, -1 if no table.
+static int findMark(const char *path, long size, BOOKMARK *m) {
+  BOOKMARK b;
+  uint32_t newest = 0, oldest = 0xFFFFFFFF;
+  int found = -1, slot = -1;
+
+  if (!store().exists(BOOKMARK_FILE)) {  // first use: empty table
+    File f = store().open(BOOKMARK_FILE, FILE_WRITE);
+    memset(&b, 0, sizeof(b));
+    for (int i = 0; f && i < BOOKMARK_SLOTS; i++)
+      f.write((uint8_t *)&b, sizeof(b));
+    if (f) f.close();
+  }
+  File f = store().open(BOOKMARK_FILE);
+  if (!f) return -1;
+  uint32_t hash = pathHash(path);
+  for (int i = 0; i < BOOKMARK_SLOTS; i++) {
+    if (f.read((uint8_t *)&b, sizeof(b)) != sizeof(b)) break;
+    if (b.stamp > newest) newest = b.stamp;
+    if (b.hash == hash && found < 0) {
+      found = i;
+      *m = b;
+    } else if (found < 0 && i != markSlot && b.stamp < oldest) {
+      oldest = b.stamp;  // candidate to reuse
+      slot = i;
+    }
+  }
+  f.close();
+  if (found >= 0) slot = found;
+  if (found < 0 || m->size != (uint32_t)size || m->offset >= m->size)
+    m->offset = 0;  // new, changed or finished
+  m->hash = hash;
+  m->size = size;
+  m->stamp = newest + 1;
+  return slot;
+}
+
+// Start keeping the position of a file.  Returns where it was left, or 0 if
+// it has not been played (or was finished).
+long bookmarkOpen(const char *path, long size) {
+  markSlot = -1;
+  int slot = findMark(path, size, &mark);
+  if (slot < 0) return 0;
+  markSlot = slot;
+  markSaved = mark.offset;
+  markTime = millis();
+  return mark.offset;
+}
+
+// Playlists keep their place here too: "offset" is then the item number and
+// "size" the number of items.
+long bookmarkGet(const char *path, long size) {
+  BOOKMARK m;
+  return findMark(path, size, &m) < 0 ? 0 : m.offset;
+}
+
+void bookmarkPut(const char *path, long size, long offset) {
+  BOOKMARK m;
+  int slot = findMark(path, size, &m);
+  if (slot < 0) return;
+  m.offset = offset;
+  putMark(slot, &m);
+}
+
+void bookmarkUpdate(long offset)  // note the position, written now and then
+{
+  if (markSlot < 0) return;
+  mark.offset = offset;
+  if (mark.offset != markSaved && millis() - markTime >= BOOKMARK_MS)
+    writeMark();
+}
+
+void bookmarkClose(long offset)  // playback stopped here (0 when finished)
+{
+  if (markSlot < 0) return;
+  mark.offset = offset;
+  writeMark();  // also records that the file was used
+  markSlot = -1;
+}
@@ -0,0 +1,181 @@
+/*
+
+  Practice text shared by the tutor and the practice-partner bot
+  (tools/qsobot): word lists, random callsigns and signal reports, and the
+  parts of a typical ragchew QSO.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdio.h>
+#include <string.h>
+
+#include "content.h"
+
+//===================================  Word Lists
+//=====================================
+
+// The following is a list of the 100 most-common English words, in frequency
+// order. See: https://www.dictionary.com/e/common-words/ from The Brown Corpus
+// Standard Sample of Present-Day American English (Providence, RI: Brown
+// University Press, 1979)
+
+// Modified by VE3OOI to address converstion from *char *const
+char *words[] = {
+    (char *)"THE",   (char *)"OF",    (char *)"AND",     (char *)"TO",
+    (char *)"A",     (char *)"IN",    (char *)"THAT",    (char *)"IS",
+    (char *)"WAS",   (char *)"HE",    (char *)"FOR",     (char *)"IT",
+    (char *)"WITH",  (char *)"AS",    (char *)"HIS",     (char *)"ON",
+    (char *)"BE",    (char *)"AT",    (char *)"BY",      (char *)"I",
+    (char *)"THIS",  (char *)"HAD",   (char *)"NOT",     (char *)"ARE",
+    (char *)"BUT",   (char *)"FROM",  (char *)"OR",      (char *)"HAVE",
+    (char *)"AN",    (char *)"THEY",  (char *)"WHICH",   (char *)"ONE",
+    (char *)"YOU",   (char *)"WERE",  (char *)"ALL",     (char *)"HER",
+    (char *)"SHE",   (char *)"THERE", (char *)"WOULD",   (char *)"THEIR",
+    (char *)"WE",    (char *)"HIM",   (char *)"BEEN",    (char *)"HAS",
+    (char *)"WHEN",  (char *)"WHO",   (char *)"WILL",    (char *)"NO",
+    (char *)"MORE",  (char *)"IF",    (char *)"OUT",     (char *)"SO",
+    (char *)"UP",    (char *)"SAID",  (char *)"WHAT",    (char *)"ITS",
+    (char *)"ABOUT", (char *)"THAN",  (char *)"INTO",    (char *)"THEM",
+    (char *)"CAN",   (char *)"ONLY",  (char *)"OTHER",   (char *)"TIME",
+    (char *)"NEW",   (char *)"SOME",  (char *)"COULD",   (char *)"THESE",
+    (char *)"TWO",   (char *)"MAY",   (char *)"FIRST",   (char *)"THEN",
+    (char *)"DO",    (char *)"ANY",   (char *)"LIKE",    (char *)"MY",
+    (char *)"NOW",   (char *)"OVER",  (char *)"SUCH",    (char *)"OUR",
+    (char *)"MAN",   (char *)"ME",    (char *)"EVEN",    (char *)"MOST",
+    (char *)"MADE",  (char *)"AFTER", (char *)"ALSO",    (char *)"DID",
+    (char *)"MANY",  (char *)"OFF",   (char *)"BEFORE",  (char *)"MUST",
+    (char *)"WELL",  (char *)"BACK",  (char *)"THROUGH", (char *)"YEARS",
+    (char *)"MUCH",  (char *)"WHERE", (char *)"YOUR",    (char *)"WAY"};
+char *antenna[] = {(char *)"YAGI", (char *)"DIPOLE", (char *)"VERTICAL",
+                   (char *)"HEXBEAM", (char *)"MAGLOOP"};
+char *weather[] = {(char *)"HOT",    (char *)"SUNNY",  (char *)"WARM",
+                   (char *)"CLOUDY", (char *)"RAINY",  (char *)"COLD",
+                   (char *)"SNOWY",  (char *)"CHILLY", (char *)"WINDY",
+                   (char *)"FOGGY"};
+char *names[] = {
+    (char *)"WAYNE", (char *)"TYE",  (char *)"DARREN",   (char *)"MICHAEL",
+    (char *)"SARAH", (char *)"DOUG", (char *)"FERNANDO", (char *)"CHARLIE",
+    (char *)"HOLLY", (char *)"KEN",  (char *)"SCOTT",    (char *)"DAN",
+    (char *)"ERVIN", (char *)"GENE", (char *)"PAUL",     (char *)"VINCENT"};
+char *cities[] = {(char *)"DAYTON, OH",      (char *)"HADDONFIELD, NJ",
+                  (char *)"MURRYSVILLE, PA", (char *)"BALTIMORE, MD",
+                  (char *)"ANN ARBOR, MI",   (char *)"BOULDER, CO",
+                  (char *)"BILLINGS, MT",    (char *)"SANIBEL, FL",
+                  (char *)"CIMMARON, NM",    (char *)"TYLER, TX",
+                  (char *)"OLYMPIA, WA"};
+char *rigs[] = {(char *)"YAESU FT101", (char *)"KENWOOD 780",
+                (char *)"ELECRAFT K3", (char *)"HOMEBREW",
+                (char *)"QRPLABS QCX", (char *)"ICOM 7410",
+                (char *)"FLEX 6400"};
+char punctuation[] = "!@$&()-+=,.:;'/";
+char prefix[] = {'A', 'W', 'K', 'N'};
+
+// Practice QSOs for the tutor (see grammar.h for the notation)
+const char qsoGrammar[] =
+    "# The first rule is a whole QSO\n"
+    "QSO = <RAGCHEW> | <RAGCHEW> | <CONTEST> | <PILEUP> | <NET>\n"
+    "\n"
+    "RAGCHEW = <$ME> DE <$THEM> K <GREETING> UR RST <$RST> <$RST>=\n"
+    "  NAME HERE IS <$NAME> ? <$NAME>= QTH IS <$QTH>=\n"
+    "  RIG HR IS <$RIG> ES ANT IS <$ANT>== WX HERE IS <WEATHER>=\n"
+    "  <CLOSING> <$ME> DE <$THEM> KN\n"
+    "GREETING = TNX FER CALL= | GM ES TNX FER CALL= | GA OM TNX FER CALL= |\n"
+    "  GE ES TNX FER THE CALL=\n"
+    "WEATHER = <$WX> | <$WX> | <$WX> ES TEMP <$DIGIT><$DIGIT>F |\n"
+    "  <$WX> ES <$DIGIT><$DIGIT>C\n"
+    "CLOSING = SO HW CPY? | HW? | SO BK TO U ES HW CPY?\n"
+    "\n"
+    "CONTEST = CQ TEST <$THEM> <$THEM> TEST = <$ME> = <$ME> <EXCHANGE> =\n"
+    "  TU <$THEM> TEST\n"
+    "EXCHANGE = 5NN <$NR> | 5NN <$NR> | 5NN <ZONE> | 599 <$NR> <$NR> |\n"
+    "  5NN <$NAME> | 5NN TU\n"
+    "ZONE = <$DIGIT> | <$DIGIT><$DIGIT>\n"
+    "\n"
+    "PILEUP = CQ DX DE <$THEM> <$THEM> UP = <CALLERS> <$ME> = <$ME> 5NN =\n"
+    "  TU <$THEM> UP\n"
+    "CALLERS = <$CALL> | <$CALL> <CALLERS> | <$CALL> <$CALL> <CALLERS>\n"
+    "\n"
+    "NET = QNI QNI DE <$THEM> NCS <NETNAME> NET = <CHECKINS> QNI <$ME> =\n"
+    "  R <$ME> QRU? = <CHECKINS> QRU NET DE <$THEM> K\n"
+    "NETNAME = <$NAME>S | EVENING | TRAFFIC | SLOW SPEED | RAGCHEW\n"
+    "CHECKINS = <$CALL> = | <$CALL> = <CHECKINS>\n";
+
+void addChar(char *str, char ch)  // adds 1 character to end of string
+{
+  char c[2] = " ";  // happy hacking: char into string
+  c[0] = ch;        // change char 'A' to string "A"
+  strcat(str, c);   // and add it to end of string
+}
+
+char randomLetter()  // returns a random uppercase letter
+{
+  return 'A' + random(0, 26);
+}
+
+char randomNumber()  // returns a random single-digit # 0-9
+{
+  return '0' + random(0, 10);
+}
+
+void randomCallsign(char *call)  // returns with random US callsign in "call"
+{
+  strcpy(call, "");            // start with empty callsign
+  int i = random(0, 4);        // 4 possible start letters for US
+  char c = prefix[i];          // Get first letter of prefix
+  addChar(call, c);            // and add it to callsign
+  i = random(0, 3);            // single or double-letter prefix?
+  if ((i == 2) or (c == 'A'))  // do a double-letter prefix
+  {                            // allowed combinations are:
+    if (c == 'A')
+      i = random(0, 12);  // AA-AL, or
+    else
+      i = random(0, 26);     // KA-KZ, NA-NZ, WA-WZ
+    addChar(call, 'A' + i);  // add second char to prefix
+  }
+  addChar(call, randomNumber());          // add zone number to callsign
+  for (int i = 0; i < random(1, 4); i++)  // Suffix contains 1-3 letters
+    addChar(call, randomLetter());        // add suffix letter(s) to call
+}
+
+void randomRST(char *rst) {
+  strcpy(rst, "");                    // start with empty string
+  addChar(rst, '0' + random(3, 6));   // readability 3-5
+  addChar(rst, '0' + random(5, 10));  // strength: 6-9
+  addChar(rst, '9');                  // tone usually 9
+}
+
+void qsoCQ(char *text, int size, const char *from)  // calling CQ
+{
+  snprintf(text, size, "CQ CQ CQ DE %s %s K ", from, from);
+}
+
+void qsoAnswer(char *text, int size, const char *to, const char *from) {
+  snprintf(text, size, "%s DE %s %s K ", to, from, from);  // answering a CQ
+}
+
+// "from" tells "to" about the station: report, name, QTH, rig, antenna & WX
+void qsoExchange(char *text, int size, const char *to, const char *from) {
+  char rst[RST_LEN];
+  randomRST(rst);
+  const char *name = names[random(0, NAME_COUNT)];
+  const char *qth = cities[random(0, CITY_COUNT)];
+  const char *rig = rigs[random(0, RIG_COUNT)];
+  const char *ant = antenna[random(0, ANTENNA_COUNT)];
+  const char *wx = weather[random(0, WEATHER_COUNT)];
+  snprintf(text, size,
+           "%s de %s K  TNX FER CALL= UR RST %s %s= NAME HERE IS %s ? %s= "
+           "QTH IS %s= RIG HR IS %s ES ANT IS %s== WX HERE IS %s= SO HW "
+           "CPY? %s de %s KN",
+           to, from, rst, rst, name, name, qth, rig, ant, wx, to, from);
+}
+
+void qsoSignoff(char *text, int size, const char *to, const char *from) {
+  snprintf(text, size, "R R TNX FER QSO ES 73 %s DE %s SK ", to, from);
+}
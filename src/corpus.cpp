@@ -0,0 +1,165 @@
+/*
+
+  Streaming decoder for texts compressed into flash (see corpus.h).
+
+  The code is canonical: codes of the same length are consecutive numbers in
+  symbol order, so the image only stores each symbol's length and the decoder
+  rebuilds the rest in corpusOpen().  Bits are read most significant first,
+  three bytes at a time, so the image ends with three bytes of padding.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+#include <string.h>
+
+#include "corpus.h"
+
+static const uint8_t *image = NULL;  // open image, NULL = none
+static CORPUS_HEADER header;
+static const uint8_t *bits;          // start of the compressed text
+static uint16_t fast[1 << CORPUS_FAST_BITS];  // symbol << 4 | length, 0 = long
+static uint16_t firstCode[CORPUS_MAX_BITS + 2];  // first code of each length
+static uint8_t firstSorted[CORPUS_MAX_BITS + 2]; // its place in sorted[]
+static uint8_t lengthCount[CORPUS_MAX_BITS + 1];
+static uint8_t sorted[CORPUS_SYMBOLS];           // symbols in code order
+static uint32_t bitPos;                          // next bit to decode
+static long charsLeft = 0, charPos = 0;          // of the text being read
+
+int corpusSymbol(int c)  // normalizer output to symbol, -1 if none
+{
+  c &= 0xFF;
+  if (c >= ' ' && c < ' ' + 64) return c - ' ';
+  if (c >= 0x80 && c < 0x80 + CORPUS_SYMBOLS - 64) return c - 0x80 + 64;
+  return -1;
+}
+
+int corpusChar(int symbol)  // and back
+{
+  return symbol < 64 ? symbol + ' ' : symbol - 64 + 0x80;
+}
+
+static const uint8_t *lengths(void) { return image + sizeof(CORPUS_HEADER); }
+
+static void readText(int i, CORPUS_TEXT *t) {
+  memcpy(t, lengths() + CORPUS_SYMBOLS + i * sizeof(CORPUS_TEXT), sizeof(*t));
+}
+
+static uint32_t readSync(int i) {
+  uint32_t pos;
+  memcpy(&pos,
+         lengths() + CORPUS_SYMBOLS + header.texts * sizeof(CORPUS_TEXT) + i * 4,
+         4);
+  return pos;
+}
+
+// Check an image and build the decoding tables.  False if it is not one.
+bool corpusOpen(const uint8_t *data) {
+  image = NULL;
+  charsLeft = 0;
+  memcpy(&header, data, sizeof(header));
+  if (header.magic != CORPUS_MAGIC || !header.syncEvery) return false;
+  image = data;
+  bits = lengths() + CORPUS_SYMBOLS + header.texts * sizeof(CORPUS_TEXT) +
+         header.syncCount * 4;
+
+  const uint8_t *len = lengths();
+  memset(lengthCount, 0, sizeof(lengthCount));
+  for (int s = 0; s < CORPUS_SYMBOLS; s++) lengthCount[len[s]]++;
+  uint16_t code = 0;
+  int n = 0;
+  for (int l = 1; l <= CORPUS_MAX_BITS; l++) {  // canonical codes
+    firstCode[l] = code;
+    firstSorted[l] = n;
+    for (int s = 0; s < CORPUS_SYMBOLS; s++)
+      if (len[s] == l) sorted[n++] = s;
+    code = (code + lengthCount[l]) << 1;
+  }
+  memset(fast, 0, sizeof(fast));
+  for (int l = 1; l <= CORPUS_FAST_BITS; l++)  // every code that fits
+    for (int i = 0; i < lengthCount[l]; i++) {
+      int shift = CORPUS_FAST_BITS - l;
+      int first = (firstCode[l] + i) << shift;
+      for (int j = 0; j < (1 << shift); j++)
+        fast[first + j] = sorted[firstSorted[l] + i] << 4 | l;
+    }
+  return true;
+}
+
+int corpusCount(void) { return image ? header.texts : 0; }
+
+const char *corpusName(int text) {
+  if (text < 0 || text >= corpusCount()) return "";
+  return (const char *)lengths() + CORPUS_SYMBOLS + text * sizeof(CORPUS_TEXT);
+}
+
+int corpusFind(const char *name)  // text number, -1 if there is none
+{
+  for (int i = 0; i < corpusCount(); i++)
+    if (!strcmp(corpusName(i), name)) return i;
+  return -1;
+}
+
+long corpusSize(int text)  // characters
+{
+  CORPUS_TEXT t;
+  if (text < 0 || text >= corpusCount()) return 0;
+  readText(text, &t);
+  return t.chars;
+}
+
+static int decode(void) {
+  const uint8_t *p = bits + (bitPos >> 3);
+  uint32_t window = ((uint32_t)p[0] << 16 | p[1] << 8 | p[2]) << (bitPos & 7);
+  uint16_t next = window >> 8;  // next 16 bits, first on the left
+  uint16_t f = fast[next >> (16 - CORPUS_FAST_BITS)];
+  if (f) {
+    bitPos += f & 15;
+    return f >> 4;
+  }
+  for (int l = CORPUS_FAST_BITS + 1; l <= CORPUS_MAX_BITS; l++) {
+    uint16_t code = next >> (16 - l);
+    if ((uint16_t)(code - firstCode[l]) < lengthCount[l]) {
+      bitPos += l;
+      return sorted[firstSorted[l] + code - firstCode[l]];
+    }
+  }
+  return -1;  // not a code: damaged image
+}
+
+// Read a text from character "at" on
+bool corpusStart(int text, long at) {
+  CORPUS_TEXT t;
+  charsLeft = 0;
+  if (text < 0 || text >= corpusCount()) return false;
+  readText(text, &t);
+  if (at < 0) at = 0;
+  if (at > (long)t.chars) at = t.chars;
+  long sync = at / header.syncEvery;
+  charPos = sync * header.syncEvery;
+  charsLeft = t.chars - charPos;
+  bitPos = charsLeft ? readSync(t.sync + sync) : 0;
+  while (charPos < at) corpusGet();  // up to syncEvery - 1 characters
+  return true;
+}
+
+int corpusGet(void)  // next character of the text, -1 at the end
+{
+  if (charsLeft <= 0) return -1;
+  int s = decode();
+  if (s < 0) {
+    charsLeft = 0;
+    return -1;
+  }
+  charsLeft--;
+  charPos++;
+  return corpusChar(s);
+}
+
+long corpusPosition(void) { return charPos; }
@@ -0,0 +1,59 @@
+#ifndef _CORPUS_H_
+#define _CORPUS_H_
+
+// Portable: images are made by tools/corpus on a computer and read by the
+// tutor from flash.
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+
+//===================================  Flash Corpus Constants
+//============================
+// Word lists and books built into the firmware for units without an SD
+// card.  Texts are stored as normalizer output (see normalize.h), which
+// needs at most CORPUS_SYMBOLS different characters, compressed with one
+// canonical Huffman code for the whole image.  The image is a CORPUS_HEADER,
+// the code length of every symbol, a CORPUS_TEXT per text, a sync table
+// holding the bit position of every syncEvery'th character of each text, and
+// the bits.  Decoding needs no window: a table lookup on the next
+// CORPUS_FAST_BITS bits gives most characters, longer codes take a few more
+// steps.  Playing from any character decodes at most syncEvery - 1 others
+// first.
+#define CORPUS_MAGIC 0x3143544DUL  // "MTC1"
+#define CORPUS_SYMBOLS 96          // ' ' to '_', then prosign bytes
+#define CORPUS_MAX_BITS 15         // longest code
+#define CORPUS_FAST_BITS 8         // bits decoded by one table lookup
+#define CORPUS_NAME_LEN 12         // longest text name + 1
+#define CORPUS_TEXTS 16            // most texts in an image (menu rows)
+#define CORPUS_SYNC 256            // default characters per sync entry
+
+typedef struct {
+  uint32_t magic;      // CORPUS_MAGIC
+  uint32_t texts;      // CORPUS_TEXT entries
+  uint32_t syncEvery;  // characters per sync table entry
+  uint32_t syncCount;  // sync table entries, all texts
+} CORPUS_HEADER;
+
+typedef struct {
+  char name[CORPUS_NAME_LEN];  // shown in the menu
+  uint32_t chars;              // length of the text
+  uint32_t sync;               // its first sync table entry
+} CORPUS_TEXT;
+
+extern const uint8_t corpusData[];  // made by tools/corpus (corpusdata.cpp)
+
+// Function Prototypes
+bool corpusOpen(const uint8_t *image);
+int corpusCount(void);
+const char *corpusName(int text);
+int corpusFind(const char *name);
+long corpusSize(int text);
+bool corpusStart(int text, long at);
+int corpusGet(void);
+long corpusPosition(void);
+int corpusSymbol(int c);
+int corpusChar(int symbol);
+
+#endif  // _CORPUS_H_
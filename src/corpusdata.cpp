@@ -0,0 +1,103 @@
+/*
+
+  Texts built into the tutor for units without an SD card.
+
+  Made by tools/corpus/corpusgen from:
+    texts/gettysburg.txt (GETTYSBURG, 1508 characters)
+  Do not edit: change the texts and run it again.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+
+#include "corpus.h"
+
+// 1508 characters in 945 bytes
+const uint8_t corpusData[] = {
+    0x4d, 0x54, 0x43, 0x31, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x0b,
+    0x00, 0x00, 0x0c, 0x00, 0x0b, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x07, 0x06, 0x05, 0x03, 0x06, 0x06, 0x04, 0x05, 0x00, 0x0a,
+    0x05, 0x07, 0x05, 0x04, 0x07, 0x0c, 0x04, 0x05, 0x04, 0x06, 0x06, 0x06,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x47, 0x45, 0x54, 0x54, 0x59, 0x53, 0x42, 0x55,
+    0x52, 0x47, 0x00, 0x00, 0xe4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00,
+    0x78, 0x0c, 0x00, 0x00, 0x9e, 0x10, 0x00, 0x00, 0xa6, 0x14, 0x00, 0x00,
+    0xe2, 0x3a, 0x93, 0x5b, 0xc4, 0xa1, 0xb3, 0x63, 0x4b, 0xb5, 0x93, 0xf2,
+    0x69, 0xd0, 0xdc, 0xc1, 0x1d, 0x49, 0xc3, 0x53, 0xa9, 0xd1, 0xee, 0x63,
+    0xae, 0x5e, 0x8e, 0x22, 0x69, 0xc8, 0xc9, 0x4f, 0x7d, 0x1b, 0xc6, 0x6a,
+    0xf9, 0x59, 0xad, 0x86, 0x32, 0xbc, 0x32, 0xd5, 0x78, 0xce, 0xc6, 0xf1,
+    0x9d, 0xd5, 0xfb, 0x56, 0x2f, 0x93, 0x17, 0xf6, 0xa6, 0xbf, 0x6c, 0x36,
+    0x6c, 0x59, 0x5a, 0xfb, 0xb5, 0x2b, 0x15, 0x05, 0x3a, 0x3e, 0xcc, 0x7d,
+    0x8d, 0x5e, 0xaf, 0x19, 0x29, 0xda, 0x86, 0xc6, 0x0f, 0x8b, 0x23, 0x4a,
+    0x37, 0x94, 0xd4, 0xac, 0x2f, 0xff, 0xe9, 0xb1, 0xfc, 0x66, 0x3c, 0x3c,
+    0x43, 0x4a, 0x16, 0x79, 0x6e, 0x55, 0x8b, 0xe4, 0x63, 0x99, 0x4d, 0x46,
+    0xf7, 0xee, 0xf8, 0x3c, 0x69, 0xd8, 0xa5, 0xaa, 0xbe, 0x79, 0x3c, 0x75,
+    0x4e, 0xa4, 0xa7, 0x6a, 0x32, 0xd5, 0x78, 0xce, 0xc4, 0x48, 0xd9, 0xfc,
+    0x65, 0xaa, 0xf1, 0x93, 0x50, 0x6f, 0x19, 0xdd, 0x5f, 0xb5, 0x61, 0xb3,
+    0x63, 0x50, 0x59, 0x5a, 0xfb, 0xb5, 0x2b, 0x6c, 0x6e, 0xd9, 0x31, 0x19,
+    0xe4, 0x59, 0xb7, 0x52, 0xbf, 0x8f, 0x10, 0xd2, 0x8f, 0x8a, 0x88, 0xc8,
+    0xc7, 0x32, 0x9a, 0x8f, 0x6d, 0x55, 0x85, 0xeb, 0x8b, 0xac, 0x58, 0x8e,
+    0x0a, 0x76, 0xa3, 0xc6, 0x9f, 0xe3, 0xc4, 0x3b, 0x76, 0x8d, 0xe3, 0xe2,
+    0x2a, 0x0b, 0x2b, 0x5f, 0x76, 0xa4, 0x31, 0xf6, 0x26, 0xaf, 0x19, 0x23,
+    0x82, 0x9d, 0xa8, 0xe2, 0xeb, 0x16, 0xd8, 0x6d, 0x0c, 0x71, 0x7c, 0xb6,
+    0x09, 0x5a, 0xab, 0xe7, 0x93, 0xee, 0x1b, 0x74, 0x71, 0x12, 0x53, 0xc6,
+    0x91, 0xe3, 0xc0, 0xea, 0x51, 0xcb, 0x76, 0x8a, 0x75, 0x79, 0x31, 0x7e,
+    0xd6, 0x8a, 0x76, 0xa2, 0x9d, 0xa8, 0xcb, 0x55, 0xe3, 0x27, 0xcb, 0xf2,
+    0xf4, 0x62, 0xfd, 0xaf, 0xe2, 0xf4, 0x5f, 0x43, 0x62, 0xa3, 0x95, 0x4e,
+    0xa4, 0xe2, 0xf5, 0x57, 0xcf, 0x23, 0x66, 0xc7, 0xd9, 0x8f, 0xaa, 0x4a,
+    0x76, 0xa3, 0xc4, 0x69, 0xe3, 0xac, 0x58, 0xb4, 0x14, 0xf7, 0xd7, 0xf1,
+    0xef, 0xaa, 0xd8, 0xbe, 0x46, 0x30, 0xd3, 0xca, 0x93, 0x4b, 0x3a, 0x5b,
+    0x1e, 0x23, 0x76, 0xc9, 0x98, 0xa2, 0xca, 0xd7, 0xdd, 0xa9, 0x1e, 0xbd,
+    0x1e, 0x23, 0x76, 0xc9, 0x98, 0xa3, 0x78, 0xce, 0x96, 0xf2, 0xd4, 0x8f,
+    0x5e, 0x8f, 0x11, 0xbb, 0x64, 0xcc, 0x50, 0xed, 0x8c, 0x47, 0x87, 0xaf,
+    0x45, 0x3d, 0xf4, 0x73, 0x31, 0xd6, 0x6d, 0xfc, 0x53, 0xa3, 0xdc, 0xb7,
+    0x68, 0xf8, 0xb3, 0xb1, 0x8b, 0xf7, 0x7c, 0xf2, 0x36, 0x6c, 0x59, 0x35,
+    0xb6, 0x3c, 0x78, 0x35, 0x53, 0xd7, 0x3c, 0xe1, 0x58, 0x75, 0x2b, 0x61,
+    0xdb, 0xb4, 0x6f, 0x19, 0xd2, 0xde, 0x5a, 0x95, 0x8b, 0xd6, 0xc7, 0x0d,
+    0x23, 0x7b, 0x8e, 0xd1, 0x1d, 0x49, 0xf6, 0x22, 0x4f, 0xb1, 0xe2, 0x92,
+    0xa0, 0x6b, 0x58, 0x89, 0x2c, 0xaa, 0x5b, 0x7a, 0xfe, 0x29, 0xd1, 0xe4,
+    0x4e, 0x2c, 0x79, 0x7c, 0x60, 0xc5, 0xea, 0xb0, 0x8c, 0xc5, 0x2d, 0x8c,
+    0xc4, 0x98, 0x8c, 0xf2, 0x4a, 0xf8, 0xbe, 0x7b, 0x52, 0x78, 0xed, 0x47,
+    0x88, 0xd3, 0x7e, 0x1d, 0x4a, 0xd8, 0xf7, 0xd5, 0x17, 0xa3, 0x76, 0xc9,
+    0x95, 0xda, 0x93, 0x88, 0x9e, 0x55, 0x1e, 0x3b, 0x51, 0x4e, 0xbf, 0x16,
+    0xbd, 0x87, 0x52, 0xbf, 0x8b, 0xd1, 0x7d, 0x1c, 0x44, 0x9d, 0x68, 0xa7,
+    0x46, 0x2f, 0xdd, 0xf3, 0xce, 0xc4, 0xb5, 0x3a, 0x9d, 0x8a, 0x83, 0xda,
+    0x2c, 0xad, 0x7d, 0xda, 0x95, 0x87, 0x52, 0x8a, 0x82, 0x9d, 0x1d, 0x67,
+    0x8b, 0xe6, 0xfa, 0x75, 0x63, 0xc8, 0x9f, 0xf4, 0xf1, 0xef, 0xbb, 0x94,
+    0xeb, 0xf1, 0xe3, 0xc1, 0xc4, 0x75, 0xcb, 0xd0, 0xea, 0x50, 0xed, 0xda,
+    0x29, 0xfa, 0xd1, 0xc3, 0x49, 0xa8, 0x33, 0x1e, 0xf1, 0xf8, 0x6b, 0x76,
+    0xd9, 0xdd, 0x5b, 0xf8, 0xbd, 0x17, 0xd1, 0x2d, 0x4e, 0xa4, 0xe2, 0x24,
+    0xeb, 0x45, 0x41, 0xed, 0x0e, 0xa5, 0x16, 0x56, 0xbe, 0xed, 0x4a, 0xc5,
+    0x41, 0x4e, 0x8e, 0x65, 0x35, 0x14, 0xda, 0xff, 0x49, 0x5f, 0x1a, 0xf9,
+    0xbe, 0x79, 0x3d, 0xae, 0x22, 0x51, 0xd6, 0x8f, 0x5e, 0x8a, 0x76, 0xa3,
+    0x89, 0x8f, 0x85, 0x3a, 0xd2, 0x1e, 0x33, 0x12, 0xac, 0x59, 0x35, 0x8f,
+    0x11, 0x4d, 0xfe, 0xa2, 0xf9, 0xde, 0x53, 0x69, 0x58, 0xb2, 0xee, 0x2a,
+    0xf1, 0x92, 0xa0, 0xa7, 0x6a, 0x37, 0x6e, 0xb4, 0x8e, 0x22, 0x4f, 0x1e,
+    0xfb, 0xb9, 0x4e, 0xbf, 0x1c, 0xb7, 0x68, 0xa7, 0x46, 0x1b, 0x54, 0x71,
+    0xd6, 0x30, 0x7c, 0x4d, 0xae, 0xa5, 0x11, 0xc1, 0x65, 0xdc, 0x55, 0xe3,
+    0x27, 0xaf, 0x45, 0x3b, 0x51, 0xe2, 0x1d, 0x4a, 0x1e, 0xfc, 0xbe, 0x3f,
+    0x12, 0xb5, 0x18, 0xed, 0x14, 0xed, 0x45, 0x3a, 0xd2, 0x2c, 0x9a, 0xc6,
+    0x9d, 0xb1, 0x83, 0x31, 0x43, 0xb7, 0x68, 0xb5, 0xd5, 0x8b, 0xe4, 0xed,
+    0xaf, 0x93, 0xd7, 0xa2, 0x9d, 0xa8, 0xa7, 0xbe, 0x8c, 0xb5, 0x5e, 0x33,
+    0xb1, 0xd6, 0x6c, 0xa4, 0xe6, 0x2d, 0xb1, 0xa7, 0x6c, 0x60, 0x76, 0xed,
+    0x0c, 0x65, 0x78, 0x7b, 0xbc, 0xd3, 0x91, 0xc1, 0xc4, 0xa5, 0x68, 0xf8,
+    0x7a, 0xf4, 0x36, 0x6c, 0x53, 0xb5, 0x1c, 0xc7, 0x6a, 0x73, 0xf1, 0x66,
+    0x88, 0xe0, 0xa7, 0x47, 0xd5, 0x1f, 0x70, 0xb6, 0x3d, 0xfe, 0x29, 0xd1,
+    0xf5, 0x47, 0xdc, 0x2d, 0x8e, 0x22, 0x4a, 0x74, 0x7d, 0x51, 0xf7, 0x0b,
+    0x63, 0x4e, 0xd8, 0xc1, 0x98, 0xa3, 0xea, 0x9b, 0xe9, 0xce, 0x26, 0x3e,
+    0x14, 0xe8, 0x4d, 0x34, 0xff, 0xc3, 0x7b, 0x96, 0x76, 0xf8, 0x62, 0xf9,
+    0xde, 0x31, 0x9d, 0x8c, 0xc7, 0x6b, 0xe7, 0xb5, 0x27, 0xf9, 0xff, 0xb6,
+    0x3f, 0xcf, 0xfb, 0xff, 0xdf, 0xf0, 0x00, 0x00, 0x00,
+};
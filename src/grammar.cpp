@@ -0,0 +1,241 @@
+/*
+
+  Template grammar for practice QSOs (see grammar.h).
+
+  The grammar is never copied into RAM.  The built-in one is read where it
+  lies in flash; a file is read through a small cache, since expansion
+  mostly moves forward through an alternative, and is only open while a
+  QSO is being sent (until grammarEnd()).  Opening a grammar makes one
+  pass over it to note where each rule starts and how many alternatives it
+  has, so a reference is a lookup in that table rather than a search.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "main.h"
+#include "storage.h"
+#include "content.h"
+#include "grammar.h"
+
+typedef struct {
+  uint32_t hash;   // of the name
+  uint32_t start;  // first character after '='
+  uint16_t alts;   // alternatives
+} GRAMMAR_RULE;
+
+static const char *source = NULL;  // built-in grammar, or NULL
+static File sourceFile;            // grammar in the store, while in use
+static uint32_t sourceLen = 0;
+static uint8_t cache[GRAMMAR_CACHE];
+static uint32_t cacheAt = 0, cacheLen = 0;
+
+static GRAMMAR_RULE rules[GRAMMAR_RULES];
+static int ruleCount = 0;
+
+static uint32_t stack[GRAMMAR_DEPTH];  // place in each alternative expanding
+static int depth = 0;
+static const char *filling = NULL;     // rest of a <$...> being sent
+static bool spaceOwed = false;         // whitespace since the last character
+static bool started = false;           // a character has been sent
+static int held = -1;                  // character to send after the space
+
+// The QSO's other station, fixed by grammarStart()
+static const char *myCallsign = "";
+static char theirCall[CALL_LEN], rst[RST_LEN], serialNr[6], fresh[CALL_LEN];
+static int pickName, pickQth, pickRig, pickAnt, pickWx;
+
+static int at(uint32_t pos)  // grammar character, -1 past the end
+{
+  if (pos >= sourceLen) return -1;
+  if (source) return (uint8_t)source[pos];
+  if (pos < cacheAt || pos >= cacheAt + cacheLen) {
+    cacheAt = pos;
+    cacheLen = 0;
+    if (!sourceFile) sourceFile = store().open(GRAMMAR_FILE);
+    if (sourceFile && sourceFile.seek(pos)) cacheLen = sourceFile.read(cache, sizeof(cache));
+    if (!cacheLen) return -1;
+  }
+  return cache[pos - cacheAt];
+}
+
+static bool blank(int c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+static bool ruleEnds(uint32_t pos)  // a line break not followed by a blank
+{
+  int c = at(pos);
+  return c < 0 || (c == '\n' && !blank(at(pos + 1)));
+}
+
+static uint32_t nameHash(uint32_t hash, int c) {  // FNV-1a
+  return (hash ^ (uint8_t)toupper(c)) * 16777619UL;
+}
+
+// Read a name up to '>' starting at pos; returns the place after it
+static uint32_t readName(uint32_t pos, char *name, uint32_t *hash) {
+  int len = 0, c;
+  *hash = 2166136261UL;
+  while ((c = at(pos)) >= 0 && c != '>' && c != '\n') {
+    if (len < GRAMMAR_NAME - 1) name[len++] = toupper(c);
+    *hash = nameHash(*hash, c);
+    pos++;
+  }
+  name[len] = 0;
+  return (c == '>') ? pos + 1 : pos;
+}
+
+static const GRAMMAR_RULE *findRule(uint32_t hash) {
+  for (int i = 0; i < ruleCount; i++)
+    if (rules[i].hash == hash) return &rules[i];
+  return NULL;
+}
+
+// One pass over the grammar: where each rule starts, and its alternatives
+static void indexRules(void) {
+  uint32_t pos = 0;
+  ruleCount = 0;
+  while (at(pos) >= 0) {
+    int c = at(pos);
+    if (c != '#' && c != '\n' && !blank(c)) {  // a rule: NAME = ...
+      GRAMMAR_RULE r = {2166136261UL, 0, 1};
+      while ((c = at(pos)) >= 0 && c != '=' && c != '\n') {
+        if (!blank(c)) r.hash = nameHash(r.hash, c);
+        pos++;
+      }
+      if (c == '=') {
+        r.start = ++pos;
+        for (; !ruleEnds(pos); pos++)
+          if (at(pos) == '|') r.alts++;
+        if (ruleCount < GRAMMAR_RULES)
+          rules[ruleCount++] = r;
+        else
+          Serial.println("QSO: too many rules in grammar");
+      }
+    }
+    while ((c = at(pos)) >= 0 && c != '\n') pos++;  // to the next line
+    pos++;
+  }
+}
+
+static void expand(uint32_t hash)  // push a random alternative of a rule
+{
+  const GRAMMAR_RULE *r = findRule(hash);
+  if (!r || depth >= GRAMMAR_DEPTH) return;  // unknown, or too deep
+  uint32_t pos = r->start;
+  for (int skip = random(0, r->alts); skip > 0; pos++)
+    if (at(pos) == '|') skip--;
+  while ((blank(at(pos)) || at(pos) == '\n') && !ruleEnds(pos))
+    pos++;  // spaces before an alternative are not part of it
+  stack[depth++] = pos;
+}
+
+bool grammarOpen(void)  // the store's grammar if it has one, or built in
+{
+  if (sourceFile) sourceFile.close();
+  source = NULL;
+  cacheLen = 0;
+  if (store().exists(GRAMMAR_FILE)) {
+    sourceFile = store().open(GRAMMAR_FILE);
+    sourceLen = sourceFile ? sourceFile.size() : 0;
+    indexRules();
+    grammarEnd();
+    if (ruleCount) return true;
+    Serial.println("QSO: no rules in " GRAMMAR_FILE);
+  }
+  source = qsoGrammar;
+  sourceLen = strlen(qsoGrammar);
+  indexRules();
+  return ruleCount > 0;
+}
+
+void grammarStart(const char *me, const char *them)  // a new QSO
+{
+  myCallsign = me;
+  strncpy(theirCall, them, CALL_LEN - 1);
+  theirCall[CALL_LEN - 1] = 0;
+  randomRST(rst);
+  snprintf(serialNr, sizeof(serialNr), "%d", (int)random(1, 1000));
+  pickName = random(0, NAME_COUNT);
+  pickQth = random(0, CITY_COUNT);
+  pickRig = random(0, RIG_COUNT);
+  pickAnt = random(0, ANTENNA_COUNT);
+  pickWx = random(0, WEATHER_COUNT);
+  depth = 0;
+  filling = NULL;
+  spaceOwed = false;
+  started = false;
+  held = -1;
+  if (ruleCount) expand(rules[0].hash);  // the first rule is the QSO
+}
+
+static const char *fill(const char *name)  // value of a <$...>, or NULL
+{
+  if (!strcmp(name, "$ME")) return myCallsign;
+  if (!strcmp(name, "$THEM")) return theirCall;
+  if (!strcmp(name, "$NAME")) return names[pickName];
+  if (!strcmp(name, "$QTH")) return cities[pickQth];
+  if (!strcmp(name, "$RIG")) return rigs[pickRig];
+  if (!strcmp(name, "$ANT")) return antenna[pickAnt];
+  if (!strcmp(name, "$WX")) return weather[pickWx];
+  if (!strcmp(name, "$RST")) return rst;
+  if (!strcmp(name, "$NR")) return serialNr;
+  if (!strcmp(name, "$CALL")) randomCallsign(fresh);
+  else if (!strcmp(name, "$DIGIT")) snprintf(fresh, 2, "%c", randomNumber());
+  else if (!strcmp(name, "$LETTER")) snprintf(fresh, 2, "%c", randomLetter());
+  else return NULL;
+  return fresh;
+}
+
+static int emit(int c)  // a character, after one space for any whitespace
+{
+  if (!started) spaceOwed = false;  // none before the first
+  started = true;
+  if (!spaceOwed) return c;
+  spaceOwed = false;
+  held = c;
+  return ' ';
+}
+
+int grammarNext(void)  // next character of the QSO, -1 at the end
+{
+  char name[GRAMMAR_NAME];
+  uint32_t hash;
+  if (held >= 0) {
+    int c = held;
+    held = -1;
+    return c;
+  }
+  while (true) {
+    if (filling && *filling) return emit(*filling++);
+    filling = NULL;
+    if (!depth) return -1;
+    uint32_t pos = stack[depth - 1];
+    int c = at(pos);
+    if (c == '|' || ruleEnds(pos)) {  // end of this alternative
+      depth--;
+      spaceOwed = false;  // nor are spaces after it
+      continue;
+    }
+    stack[depth - 1] = pos + 1;
+    if (c == '\n' || blank(c)) {
+      spaceOwed = true;
+    } else if (c == '<') {
+      stack[depth - 1] = readName(pos + 1, name, &hash);
+      if (name[0] == '$')
+        filling = fill(name);
+      else
+        expand(hash);
+    } else {
+      return emit(c);
+    }
+  }
+}
+
+void grammarEnd(void)  // QSO over or abandoned: let the file go
+{
+  if (sourceFile) sourceFile.close();
+}
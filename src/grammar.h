@@ -0,0 +1,38 @@
+#ifndef _GRAMMAR_H_
+#define _GRAMMAR_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  QSO Grammar Constants
+//=============================
+// Practice QSOs are made from a grammar: GRAMMAR_FILE in the content store
+// if there is one, otherwise qsoGrammar[] built into flash (content.cpp).
+// Each rule is "NAME = alternative | alternative ...", continued on lines
+// that start with a space or tab; lines starting with '#' are comments.
+// The first rule makes a whole QSO.  In an alternative, <NAME> expands a
+// rule and <$...> is filled in by the tutor:
+//   $ME $THEM                your call, the other station's
+//   $NAME $QTH $RIG $ANT $WX  the other station's details (content.h)
+//   $RST $NR                 report and serial number
+//   $CALL $DIGIT $LETTER     a new random call, digit or letter each time
+// All but the last three are picked once per QSO, so repeating them repeats
+// the same value.  Runs of spaces and line breaks become one space.
+//
+// A QSO is expanded a character at a time as it is sent, from a stack of
+// places in the grammar GRAMMAR_DEPTH deep, so it takes the same memory
+// however long it runs.  References nested deeper are left out, which is
+// what ends a recursive rule such as a pileup of callers.
+#define GRAMMAR_FILE "/QSO.MTG"
+#define GRAMMAR_RULES 64      // most rules in a grammar
+#define GRAMMAR_DEPTH 8       // most references being expanded at once
+#define GRAMMAR_NAME 16       // longest rule or $ name + 1
+#define GRAMMAR_CACHE 64      // bytes of a grammar file read at a time
+
+// Function Prototypes
+bool grammarOpen(void);
+void grammarStart(const char *me, const char *them);
+int grammarNext(void);
+void grammarEnd(void);
+
+#endif  // _GRAMMAR_H_
@@ -0,0 +1,219 @@
+/*
+
+  Round trip latency and jitter measurement between units in a room.
+
+  Every unit answers probes from its peers, so a unit connected to a room with
+  N other units gets up to N round trip samples per probe.  Echoes go only to
+  the unit that sent the probe.  Samples include broker and network delay
+  plus the time each end takes to service the MQTT client, which is what a
+  student actually experiences as lag.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+
+#include "main.h"
+#include "network.h"
+#include "latency.h"
+
+extern PubSubClient client;  // Defined in network.cpp
+extern char localid[10];     // Defined in network.cpp
+extern TUTOR_STRUT cfg;      // Defined in main.cpp
+extern Print *cliOut;        // Defined in main.cpp
+
+// Upper limit (mS) of each histogram bin.  Last bin catches everything else.
+const unsigned int pingBinLimit[PING_BINS] = {25,  50,  100,  200,
+                                              400, 800, 1600, 0xFFFF};
+
+typedef struct {
+  unsigned char seq;
+  bool answered;
+  unsigned long sentAt;  // millis() when probe was published, 0 = slot free
+} PING_SLOT;
+
+PING_STATS ping;
+PING_SLOT pingSlot[PING_SLOTS];
+char pingTopic[MAX_CHAR_STRING + sizeof(PING_SUFFIX)];
+char echoTopic[MAX_TOPIC_LEN];  // "<room>/ping/<our id>": echoes to us
+unsigned char pingSeq = 0;
+unsigned long lastProbe = 0;
+unsigned long lastEcho = 0;
+unsigned long jitter16 = 0;  // jitter scaled by 16 (RFC 3550 fixed point)
+int pingColor = -1;          // color currently drawn by updatePingLED()
+bool pingPaused = false;     // probes stopped until next initLatency()
+
+void initLatency(void) {
+  memset(&ping, 0, sizeof(ping));
+  memset(pingSlot, 0, sizeof(pingSlot));
+  snprintf(pingTopic, sizeof(pingTopic), "%s%s", cfg.room, PING_SUFFIX);
+  jitter16 = 0;
+  lastProbe = lastEcho = millis();
+  pingColor = -1;
+  pingPaused = false;
+  snprintf(echoTopic, sizeof(echoTopic), "%s/%s", pingTopic, localid);
+  client.subscribe(pingTopic);  // every unit answers probes in the room
+  client.subscribe(echoTopic);  // and hears the echoes of its own
+}
+
+static void addSample(unsigned int rtt) {
+  if (ping.count) {  // RFC 3550: J += (|D| - J) / 16
+    long d = (long)rtt - (long)ping.last;
+    if (d < 0) d = -d;
+    jitter16 += d - (long)(jitter16 >> 4);
+    ping.jitter = jitter16 >> 4;
+  }
+  ping.last = rtt;
+  ping.window[ping.head] = rtt;
+  ping.head = (ping.head + 1) % PING_WINDOW;
+  if (ping.count < PING_WINDOW) ping.count++;
+  for (int i = 0; i < PING_BINS; i++) {
+    if (rtt < pingBinLimit[i] || i == PING_BINS - 1) {
+      ping.hist[i]++;
+      break;
+    }
+  }
+}
+
+// Called from netTask(). Sends a probe every PING_INTERVAL and retires
+// probes that nobody answered.
+void pingPoll(void) {
+  char msg[PING_MAX_MSG_LEN];
+  if (!(cfg.conflag & SRV_CONNECTED) || pingPaused) return;
+  unsigned long now = millis();
+  if (now - lastProbe < PING_INTERVAL) return;
+  lastProbe = now;
+
+  PING_SLOT *slot = &pingSlot[pingSeq % PING_SLOTS];
+  for (int i = 0; i < PING_SLOTS; i++) {  // retire old probes
+    if (pingSlot[i].sentAt && (now - pingSlot[i].sentAt > PING_TIMEOUT)) {
+      if (!pingSlot[i].answered) ping.lost++;
+      pingSlot[i].sentAt = 0;
+    }
+  }
+  if (slot->sentAt && !slot->answered) ping.lost++;  // slot reused early
+
+  slot->seq = pingSeq;
+  slot->answered = false;
+  slot->sentAt = now ? now : 1;
+  snprintf(msg, sizeof(msg), "P:%s:%u", localid, pingSeq++);
+  client.publish(pingTopic, (const uint8_t *)msg, strlen(msg));
+  ping.sent++;
+}
+
+// Called from MQTTcallback() for every message.  Returns true if the message
+// was a probe or echo and has been consumed.
+bool latencyMessage(char *topic, byte *data, unsigned int len) {
+  char msg[PING_MAX_MSG_LEN], *id, *seq;
+  char reply[MAX_TOPIC_LEN];
+  if (strcmp(topic, pingTopic) && strcmp(topic, echoTopic)) return false;
+  if (pingPaused) return true;  // still in flight when we unsubscribed
+  if (len >= sizeof(msg) || len < 5) return true;  // not ours to parse
+  memcpy(msg, data, len);
+  msg[len] = 0;
+
+  id = msg + 2;  // "<P|E>:<id>:<seq>"
+  seq = strchr(id, MQTT_DELIMETER);
+  if (msg[1] != MQTT_DELIMETER || seq == NULL) return true;
+  *seq++ = 0;
+
+  if (msg[0] == 'P') {  // someone else's probe: echo it straight back
+    if (!strcmp(id, localid)) return true;
+    snprintf(reply, sizeof(reply), "%s/%s", pingTopic, id);  // to it alone
+    msg[0] = 'E';
+    id[-1] = MQTT_DELIMETER;  // restore original delimiters
+    seq[-1] = MQTT_DELIMETER;
+    client.publish(reply, (const uint8_t *)msg, len);
+  } else if (msg[0] == 'E') {  // echo of one of our probes?
+    if (strcmp(id, localid)) return true;
+    unsigned char n = atoi(seq);
+    PING_SLOT *slot = &pingSlot[n % PING_SLOTS];
+    if (slot->sentAt && slot->seq == n) {
+      slot->answered = true;
+      ping.echoes++;
+      lastEcho = millis();
+      addSample(millis() - slot->sentAt);
+    }
+  }
+  return true;
+}
+
+// Average round trip over the window, 0 if no peer has answered recently
+unsigned int pingAverage(void) {
+  unsigned long sum = 0;
+  if (!ping.count || (millis() - lastEcho >= PING_TIMEOUT)) return 0;
+  for (int i = 0; i < ping.count; i++) sum += ping.window[i];
+  return sum / ping.count;
+}
+
+// Small indicator beside the status square: green/yellow/red by window
+// average, gray when no peer has answered recently.
+void updatePingLED(void) {
+  int color = GRAY;
+  unsigned int avg = pingAverage();
+  if (avg) {
+    if (avg < PING_GOOD_RTT)
+      color = GREEN;
+    else if (avg < PING_FAIR_RTT)
+      color = YELLOW;
+    else
+      color = RED;
+  }
+  if (color == pingColor) return;  // avoid redrawing on every call
+  pingColor = color;
+  setPingLED(color);
+}
+
+// Stop probing and answering probes for the rest of this session.  Every unit
+// echoes every probe, so large rooms that do not need RTT should call this.
+void pauseLatency(void) {
+  pingPaused = true;
+  netUnsubscribe(pingTopic);
+  netUnsubscribe(echoTopic);
+}
+
+void printLatency(void) {
+  unsigned int lo = 0xFFFF, hi = 0;
+  unsigned long sum = 0;
+  for (int i = 0; i < ping.count; i++) {
+    sum += ping.window[i];
+    if (ping.window[i] < lo) lo = ping.window[i];
+    if (ping.window[i] > hi) hi = ping.window[i];
+  }
+  cliOut->print("Probes sent: ");
+  cliOut->print(ping.sent);
+  cliOut->print(" echoes: ");
+  cliOut->print(ping.echoes);
+  cliOut->print(" lost: ");
+  cliOut->println(ping.lost);
+  if (!ping.count) {
+    cliOut->println("No round trip samples");
+    return;
+  }
+  cliOut->print("Last ");
+  cliOut->print(ping.count);
+  cliOut->print(" RTT mS min/avg/max: ");
+  cliOut->print(lo);
+  cliOut->print("/");
+  cliOut->print(sum / ping.count);
+  cliOut->print("/");
+  cliOut->print(hi);
+  cliOut->print(" jitter: ");
+  cliOut->println(ping.jitter);
+
+  unsigned int most = 1;
+  for (int i = 0; i < PING_BINS; i++)
+    if (ping.hist[i] > most) most = ping.hist[i];
+  for (int i = 0; i < PING_BINS; i++) {
+    cliOut->print(i < PING_BINS - 1 ? "<" : ">=");
+    cliOut->print(i < PING_BINS - 1 ? pingBinLimit[i] : pingBinLimit[i - 1]);
+    cliOut->print("\t");
+    cliOut->print(ping.hist[i]);
+    cliOut->print("\t");
+    for (int j = 0; j < (int)(ping.hist[i] * 40 / most); j++) cliOut->print('#');
+    cliOut->println();
+  }
+}
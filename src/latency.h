@@ -0,0 +1,45 @@
+#ifndef _LATENCY_H_
+#define _LATENCY_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  Latency Probe Constants
+//==========================
+// Units in a room probe each other on "<room>/ping" with "P:<id>:<seq>".
+// Each echo "E:<id>:<seq>" goes back on "<room>/ping/<id>", to which only the
+// prober <id> subscribes, so a probe costs one message per peer rather than
+// every echo reaching every unit.
+#define PING_SUFFIX "/ping"   // appended to room name to form probe topic
+#define PING_INTERVAL 2000    // mS between probes while connected
+#define PING_TIMEOUT 5000     // mS before an unanswered probe counts as lost
+#define PING_SLOTS 4          // outstanding probes remembered for matching
+#define PING_WINDOW 32        // RTT samples kept for window statistics
+#define PING_BINS 8           // histogram bins (see pingBinLimit[])
+#define PING_MAX_MSG_LEN 16   // longest probe/echo message accepted
+#define PING_GOOD_RTT 150     // mS: below this the indicator is green
+#define PING_FAIR_RTT 400     // mS: below this the indicator is yellow
+
+// Round trip statistics for the current (or last) wireless session
+typedef struct {
+  unsigned long sent;              // probes sent
+  unsigned long echoes;            // echoes received (one per peer per probe)
+  unsigned long lost;              // probes with no echo before PING_TIMEOUT
+  unsigned int last;               // most recent RTT, mS
+  unsigned int jitter;             // smoothed RTT variation (RFC 3550), mS
+  unsigned int hist[PING_BINS];    // RTT histogram since connect
+  unsigned int window[PING_WINDOW];// most recent RTT samples, mS
+  unsigned char count;             // valid samples in window[]
+  unsigned char head;              // next slot to write in window[]
+} PING_STATS;
+
+// Function Prototypes
+void initLatency(void);
+void pingPoll(void);
+bool latencyMessage(char *topic, byte *data, unsigned int len);
+unsigned int pingAverage(void);
+void updatePingLED(void);
+void pauseLatency(void);
+void printLatency(void);
+
+#endif  // _LATENCY_H_
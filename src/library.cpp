@@ -0,0 +1,392 @@
+/*
+
+  SD card library index for the file browser.
+
+  Index file: a LIB_HEADER, then one 32-bit offset per entry in display
+  order, then the entries themselves: folder flag (1 byte), size (4 bytes),
+  name length (1 byte) and the name.  Entry i is found with two seeks, so
+  opening a folder and paging through it costs the same for ten files or ten
+  thousand.
+
+  Building uses a fixed amount of memory whatever the folder size, and only
+  while building.  The
+  directory is listed once into two scratch files: the entries, and a
+  fixed-size sort key per entry.  Each pass over the keys then picks the next
+  LIB_SORT_BATCH keys in order with a bounded heap and copies those entries
+  into the index.
+
+  If the index cannot be written (a locked or full card) the folder is still
+  listed without an index: folders, then files, each in card order, read in
+  two passes over the directory.  The last LIB_LIST_CACHE entries read are
+  kept, so moving about a page does not read the folder again.
+
+  A changed folder has its own index rebuilt in full.  FAT keeps no record
+  of what changed, so finding out takes the same listing and sort a rebuild
+  does; other folders' indexes are not touched.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "main.h"
+#include "storage.h"
+#include "library.h"
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;      // LIB_MAGIC once the index is complete
+  uint32_t count;      // entries
+  uint32_t signature;  // hashEntry() over the folder when built
+} LIB_HEADER;
+
+typedef struct __attribute__((packed)) {
+  char key[LIB_KEY_LEN];  // '0' folder or '1' file, then upper case name
+  uint32_t offset;        // entry in LIB_RECORDS; also breaks ties
+} LIB_KEY;
+
+#define RECORD_HEAD 6  // flag, size, name length
+
+File libIndex;                 // index of the folder being browsed
+LIB_HEADER libHeader;
+char libDir[LIB_PATH_LEN];     // folder being browsed
+File checkDir;                 // libraryStale(): listing being compared
+uint32_t checkHash, checkCount;
+File listDir;                  // no index: folder read in card order
+bool listFiles;                // listDir on its second pass, files
+uint32_t listFolders;          // entries that are folders, listed first
+uint32_t listNext, listFirst;  // entry listDir gives next; first kept
+LIB_ENTRY *listCache;          // entries listFirst to listNext - 1
+LIB_KEY *sortHeap;             // building: next keys in order
+
+void libraryJoin(char *path, int size, const char *dir, const char *name) {
+  int len = strlen(dir);
+  snprintf(path, size, "%s%s%s", dir, (len && dir[len - 1] == '/') ? "" : "/",
+           name);
+}
+
+void libraryParent(char *dir)  // "/books/old" -> "/books", "/books" -> "/"
+{
+  char *slash = strrchr(dir, '/');
+  if (!slash) return;
+  if (slash == dir)
+    dir[1] = 0;
+  else
+    *slash = 0;
+}
+
+// FNV-1a over everything shown for an entry, in directory order
+static uint32_t hashEntry(uint32_t hash, const LIB_ENTRY *e) {
+  for (const char *p = e->name; *p; p++) hash = (hash ^ (uint8_t)*p) * 16777619UL;
+  hash = (hash ^ (e->isDir ? 1 : 0)) * 16777619UL;
+  for (int i = 0; i < 4; i++)
+    hash = (hash ^ ((e->size >> (8 * i)) & 0xFF)) * 16777619UL;
+  return hash;
+}
+
+// Next entry of an open folder that should be listed
+static bool nextEntry(File &dir, LIB_ENTRY *e) {
+  for (;;) {
+    File f = dir.openNextFile();
+    if (!f) return false;
+    const char *name = strrchr(f.name(), '/');  // some cores give full paths
+    name = name ? name + 1 : f.name();
+    bool hidden = !name[0] || name[0] == '_' || name[0] == '.';
+    if (!hidden) {
+      e->isDir = f.isDirectory();
+      e->size = e->isDir ? 0 : f.size();
+      strncpy(e->name, name, LIB_NAME_LEN - 1);
+      e->name[LIB_NAME_LEN - 1] = 0;
+    }
+    f.close();
+    if (!hidden) return true;
+  }
+}
+
+static int keyCompare(const LIB_KEY *a, const LIB_KEY *b) {
+  int c = memcmp(a->key, b->key, LIB_KEY_LEN);
+  if (c) return c;
+  return a->offset < b->offset ? -1 : a->offset > b->offset;
+}
+
+static void siftDown(LIB_KEY *heap, int i, int n) {  // largest key on top
+  for (;;) {
+    int big = i, l = 2 * i + 1, r = l + 1;
+    if (l < n && keyCompare(&heap[l], &heap[big]) > 0) big = l;
+    if (r < n && keyCompare(&heap[r], &heap[big]) > 0) big = r;
+    if (big == i) return;
+    LIB_KEY t = heap[i];
+    heap[i] = heap[big];
+    heap[big] = t;
+    i = big;
+  }
+}
+
+static void siftUp(LIB_KEY *heap, int i) {
+  while (i && keyCompare(&heap[(i - 1) / 2], &heap[i]) < 0) {
+    LIB_KEY t = heap[i];
+    heap[i] = heap[(i - 1) / 2];
+    heap[(i - 1) / 2] = t;
+    i = (i - 1) / 2;
+  }
+}
+
+// The (up to) LIB_SORT_BATCH smallest keys after "after", in order
+static int nextBatch(File &keys, const LIB_KEY *after) {
+  LIB_KEY buf[16];  // 512 bytes per read
+  int n = 0, got;
+  keys.seek(0);
+  while ((got = keys.read((uint8_t *)buf, sizeof(buf))) >= (int)sizeof(LIB_KEY)) {
+    for (int i = 0; i < got / (int)sizeof(LIB_KEY); i++) {
+      if (after && keyCompare(&buf[i], after) <= 0) continue;  // placed
+      if (n < LIB_SORT_BATCH) {
+        sortHeap[n] = buf[i];
+        siftUp(sortHeap, n++);
+      } else if (keyCompare(&buf[i], &sortHeap[0]) < 0) {
+        sortHeap[0] = buf[i];
+        siftDown(sortHeap, 0, n);
+      }
+    }
+  }
+  for (int end = n - 1; end > 0; end--) {  // heap to ascending order
+    LIB_KEY t = sortHeap[0];
+    sortHeap[0] = sortHeap[end];
+    sortHeap[end] = t;
+    siftDown(sortHeap, 0, end);
+  }
+  return n;
+}
+
+static bool buildIndex(void) {
+  char recPath[LIB_PATH_LEN], keyPath[LIB_PATH_LEN], idxPath[LIB_PATH_LEN];
+  uint8_t head[RECORD_HEAD];
+  LIB_ENTRY e;
+  LIB_KEY k;
+  LIB_HEADER h = {0, 0, 2166136261UL};
+  uint32_t offset = 0;
+
+  File dir = store().open(libDir);
+  if (!dir || !dir.isDirectory()) return false;
+  sortHeap = (LIB_KEY *)malloc(LIB_SORT_BATCH * sizeof(LIB_KEY));
+  if (!sortHeap) {
+    Serial.println("Library: no memory to sort");
+    dir.close();
+    return false;
+  }
+  libraryJoin(recPath, sizeof(recPath), libDir, LIB_RECORDS);
+  libraryJoin(keyPath, sizeof(keyPath), libDir, LIB_KEYS);
+  libraryJoin(idxPath, sizeof(idxPath), libDir, LIB_INDEX);
+  File recs = store().open(recPath, FILE_WRITE);
+  File keys = store().open(keyPath, FILE_WRITE);
+  if (!recs || !keys) {
+    Serial.println("Library: cannot write index (card locked?)");
+    dir.close();
+    free(sortHeap);
+    return false;
+  }
+  while (nextEntry(dir, &e)) {  // one pass over the folder
+    int len = strlen(e.name);
+    h.signature = hashEntry(h.signature, &e);
+    head[0] = e.isDir;
+    memcpy(head + 1, &e.size, 4);
+    head[5] = len;
+    recs.write(head, RECORD_HEAD);
+    recs.write((uint8_t *)e.name, len);
+    memset(&k, 0, sizeof(k));
+    k.key[0] = e.isDir ? '0' : '1';
+    for (int i = 0; i < len && i < LIB_KEY_LEN - 1; i++)
+      k.key[i + 1] = toupper(e.name[i]);
+    k.offset = offset;
+    keys.write((uint8_t *)&k, sizeof(k));
+    offset += RECORD_HEAD + len;
+    h.count++;
+  }
+  dir.close();
+  recs.close();
+  keys.close();
+
+  recs = store().open(recPath);
+  keys = store().open(keyPath);
+  store().remove(idxPath);
+  File idx = store().open(idxPath, FILE_WRITE);
+  if (!recs || !keys || !idx) {
+    free(sortHeap);
+    return false;
+  }
+  idx.write((uint8_t *)&h, sizeof(h));  // magic still 0: not usable yet
+  uint8_t zero[64] = {0};
+  for (uint32_t i = 0; i < h.count * 4; i += sizeof(zero))
+    idx.write(zero, min((uint32_t)sizeof(zero), h.count * 4 - i));
+
+  uint32_t pos = sizeof(h) + h.count * 4, done = 0;
+  LIB_KEY last;
+  while (done < h.count) {
+    int n = nextBatch(keys, done ? &last : NULL);
+    if (!n) break;
+    last = sortHeap[n - 1];
+    idx.seek(pos);
+    for (int i = 0; i < n; i++) {  // copy entries in display order
+      char name[LIB_NAME_LEN];
+      recs.seek(sortHeap[i].offset);
+      recs.read(head, RECORD_HEAD);
+      recs.read((uint8_t *)name, head[5]);
+      idx.write(head, RECORD_HEAD);
+      idx.write((uint8_t *)name, head[5]);
+      sortHeap[i].offset = pos;  // key done with: keep where it went
+      pos += RECORD_HEAD + head[5];
+    }
+    idx.seek(sizeof(h) + done * 4);
+    for (int i = 0; i < n; i++)
+      idx.write((uint8_t *)&sortHeap[i].offset, 4);
+    done += n;
+  }
+  h.magic = LIB_MAGIC;  // complete
+  idx.seek(0);
+  idx.write((uint8_t *)&h, sizeof(h));
+  idx.close();
+  recs.close();
+  keys.close();
+  store().remove(recPath);
+  store().remove(keyPath);
+  free(sortHeap);
+  return done == h.count;
+}
+
+// No index: count the folder, then read entries from it as they are asked
+// for.  Going back past the kept entries starts again from the top.
+static bool openListing(void) {
+  LIB_ENTRY e;
+  listDir = store().open(libDir);
+  if (!listDir || !listDir.isDirectory()) {
+    if (listDir) listDir.close();
+    return false;
+  }
+  listCache = (LIB_ENTRY *)malloc(LIB_LIST_CACHE * sizeof(LIB_ENTRY));
+  if (!listCache) {
+    Serial.println("Library: no memory to list folder");
+    listDir.close();
+    return false;
+  }
+  Serial.println("Library: no index, listing folder unsorted");
+  libHeader.count = listFolders = 0;
+  while (nextEntry(listDir, &e)) {
+    libHeader.count++;
+    if (e.isDir) listFolders++;
+  }
+  listDir.rewindDirectory();
+  listFiles = false;
+  listNext = listFirst = 0;
+  return true;
+}
+
+// Next entry in listing order: a pass for folders, then one for files
+static bool nextListed(LIB_ENTRY *e) {
+  for (;;) {
+    if (!nextEntry(listDir, e)) {
+      if (listFiles) return false;
+      listDir.rewindDirectory();
+      listFiles = true;
+    } else if (e->isDir != listFiles) {
+      return true;
+    }
+  }
+}
+
+static bool listEntry(int i, LIB_ENTRY *e) {
+  uint32_t n = i, last = n;
+  if (!listDir) return false;
+  if (n < listFirst) {  // start again, at the files if it is one
+    listDir.rewindDirectory();
+    listFiles = n >= listFolders;
+    listNext = listFirst = listFiles ? listFolders : 0;
+    last = min(n + LIB_LIST_CACHE / 2, libHeader.count - 1);  // keep some
+  }                                                          // beyond it too
+  while (listNext <= last) {
+    if (!nextListed(&listCache[listNext % LIB_LIST_CACHE])) return false;
+    if (++listNext - listFirst > LIB_LIST_CACHE) listFirst++;
+  }
+  *e = listCache[n % LIB_LIST_CACHE];
+  return true;
+}
+
+static bool loadIndex(void) {
+  char idxPath[LIB_PATH_LEN];
+  libraryJoin(idxPath, sizeof(idxPath), libDir, LIB_INDEX);
+  if (!store().exists(idxPath)) return false;
+  libIndex = store().open(idxPath);
+  if (!libIndex) return false;
+  if (libIndex.read((uint8_t *)&libHeader, sizeof(libHeader)) ==
+          sizeof(libHeader) &&
+      libHeader.magic == LIB_MAGIC &&
+      libIndex.size() >= sizeof(libHeader) + libHeader.count * 4)
+    return true;
+  libIndex.close();  // partly written or damaged
+  return false;
+}
+
+// Open a folder for browsing.  Uses its index if there is one (checked
+// later by libraryStale()), otherwise builds one first.
+bool libraryOpen(const char *dir) {
+  libraryClose();
+  strncpy(libDir, dir, sizeof(libDir) - 1);
+  libDir[sizeof(libDir) - 1] = 0;
+  if (loadIndex()) {
+    checkDir = store().open(libDir);
+    checkHash = 2166136261UL;
+    checkCount = 0;
+    return true;
+  }
+  return (buildIndex() && loadIndex()) || openListing();
+}
+
+int libraryCount(void) {
+  return (libIndex || listDir) ? libHeader.count : 0;
+}
+
+bool libraryEntry(int i, LIB_ENTRY *e) {
+  uint8_t head[RECORD_HEAD];
+  uint32_t offset;
+  if (i < 0 || i >= (int)libHeader.count) return false;
+  if (!libIndex) return listEntry(i, e);
+  libIndex.seek(sizeof(LIB_HEADER) + i * 4);
+  if (libIndex.read((uint8_t *)&offset, 4) != 4) return false;
+  libIndex.seek(offset);
+  if (libIndex.read(head, RECORD_HEAD) != RECORD_HEAD) return false;
+  e->isDir = head[0];
+  memcpy(&e->size, head + 1, 4);
+  e->name[libIndex.read((uint8_t *)e->name, head[5])] = 0;
+  return true;
+}
+
+// Compare a few more directory entries with the index.  True once the
+// folder has been found to differ; call libraryRebuild() then.
+bool libraryStale(void) {
+  LIB_ENTRY e;
+  if (!checkDir) return false;  // checked, or nothing to check
+  for (int i = 0; i < LIB_CHECK_STEP; i++) {
+    if (!nextEntry(checkDir, &e)) {
+      checkDir.close();
+      return checkHash != libHeader.signature ||
+             checkCount != libHeader.count;
+    }
+    checkHash = hashEntry(checkHash, &e);
+    checkCount++;
+  }
+  return false;
+}
+
+// Only the open folder is rebuilt (see top of file)
+bool libraryRebuild(void) {
+  libraryClose();
+  return (buildIndex() && loadIndex()) || openListing();
+}
+
+void libraryClose(void) {
+  if (libIndex) libIndex.close();
+  if (checkDir) checkDir.close();
+  if (listDir) listDir.close();
+  free(listCache);
+  listCache = NULL;
+}
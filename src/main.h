@@ -24,12 +24,15 @@
 #define DEFAULT_MQTT_PASSWORD "****"
 #define DEFAULT_SERVER_ADDRESS "****"
 #define DEFAULT_MQTT_ROOM "****"
+#define DEFAULT_CLI_KEY ""    // empty key disables remote CLI
+#define MIN_REMOTE_KEY 8      // shortest remote CLI key accepted
 
 // Added by VE3OOI for UART CLI
 // Note: main.h needs to be loaded before any other h file AND must be loaded in
 // each cpp file!!!!!
 //#define REMOVE_CLI // uncomment this line to remove CLI routines
 #define TERMINAL_ECHO 1  // Enable local echo
+#define WEB_SERVER 1     // Keep Wi-Fi up & serve status page (webserver.h)
 
 //===================================  Hardware Connections
 //=============================
@@ -54,11 +57,15 @@
 #define MAXPITCH 2800        // highest allowed pitch
 #define MINPITCH 300         // how low can you go
 #define WORDSIZE 5           // number of chars per random word
+#define KOCH_WORDS 10        // real words a lesson needs to mix them in
 #define MAXWORDSPACES 99     // maximum word delay, in spaces
 #define FLASHCARDDELAY 2000  // wait in mS between cards
 #define ENCODER_TICKS 3      // Ticks required to register movement
-#define FNAMESIZE 15         // max size of a filename
-#define MAXFILES 20          // max number of SD files recognized
+#define LEAD_UP 1            // SD library: ".." row shown
+#define LEAD_ALL 2           // SD library: "Play all" row shown
+#define ROW_UP -1            // SD library: ".." chosen
+#define ROW_NONE -2          // SD library: empty folder
+#define ROW_ALL -3           // SD library: "Play all" chosen
 #define IAMBIC_A 1           // Iambic Keyer Mode B
 #define IAMBIC_B 2           // Iambic Keyer Mode A
 #define LONGPRESS 1000       // hold-down time for long press, in mSec
@@ -138,6 +145,7 @@ typedef struct {
                                       // "ve3ooi.ddns.net"
   char room[MAX_CHAR_STRING];  // this is actually MQTT "topic" but I called it
                                // room for simplicity. Default if "morsetutor"
+  char cli_key[MAX_CHAR_STRING];  // shared secret for remote CLI, "" = off
 } TUTOR_STRUT;
 
 // Added by VE3OOI
@@ -147,9 +155,12 @@ typedef struct {
 void initializeMem(void);
 void clearMem(void);
 void dumpMem(void);
+void corpusBenchmark(void);
 void openCLI(void);
 void executeSerial(char *str);
 void readSerialLine(char *inprompt, int size);
+char *cliArgument(char *str, int skip);
+bool getArgument(char *str, int skip, char *inprompt, int size);
 void setRunningConfig(void);
 
 //////
@@ -175,33 +186,41 @@ void dah(void);
 void sendElements(int x);
 void roger(void);
 void sendCharacter(char c);
+void sendCoded(char c, int code);
 void sendString(char *ptr);
 void sendMorseWord(char *ptr);
 void displayWPM(void);
 void checkForSpeedChange(void);
+void checkJump(void);
 void checkPause(void);
 void sendKochLesson(int lesson);
 void introLesson(int lesson);
 int getLessonNumber(void);
 void sendKoch(void);
-void addChar(char *str, char ch);
-char randomLetter(void);
-char randomNumber(void);
-void randomCallsign(char *call);
-void randomRST(char *rst);
 void sendNumbers(void);
 void sendLetters(void);
 void sendMixedChars(void);
 void sendPunctuation(void);
+void randomWord(char *word, int size);
 void sendWords(void);
 void sendCallsigns(void);
 void sendQSO(void);
 
 //////
-int getFileList(char list[][FNAMESIZE]);
-void displayFiles(char menu[][FNAMESIZE], int top, int itemCount);
-int fileMenu(char menu[][FNAMESIZE], int itemCount);
+int libraryLead(bool up);
+int libraryLeadRows(int lead);
+int libraryItem(int item, int lead);
+void libraryRow(int item, int lead, char *s);
+void displayLibrary(int top, int itemCount, int lead);
+int libraryMenu(bool up);
+bool browseLibrary(char *path, int size);
+bool askResume(long offset, long size);
+long jumpFrom(long pos, int steps, bool paragraph);
 void sendFile(char *filename);
+int mrsByte(void);
+void sendMorseFile(char *path);
+int corpusMenu(void);
+void sendCorpus(int text);
 void sendFromSD(void);
 
 //////
@@ -218,6 +237,8 @@ void copyWords(void);
 void encourageUser(void);
 void displayNumber(int num, int color, int x, int y, int wd, int ht);
 void showScore(void);
+void readReply(char *response, unsigned int *ms);
+void scoreReply(char *text, char *response, unsigned int *ms);
 void mimic1(char *text);
 void showHitsAndMisses(int hits, int misses);
 void headCopy(void);
@@ -225,9 +246,17 @@ void hitTone(void);
 void missTone(void);
 void mimic2(char *text);
 void mimic(char *text);
+int gradeCard(void);
 void flashcards(void);
 
 void twoWay(void);
+void showLeaderboard(unsigned int seq);
+void instructor(void);
+void student(void);
+void classroom(void);
+bool validSelection(int selection);
+int takeWebMode(void);
+void showRoster(void);
 void printConfig(unsigned char ee);
 void saveConfig(void);
 void loadConfig(void);
@@ -0,0 +1,112 @@
+/*
+
+  The Morse code table, and codes for prosigns.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+
+#include "morse.h"
+
+uint8_t morse[MORSE_COUNT] = {
+    // Each character is encoded into an 8-bit byte:
+    0b01001010,  // ! exclamation
+    0b01101101,  // " quotation
+    0b01010111,  // # pound                   // No Morse, mapped to SK
+    0b10110111,  // $ dollar or ~SX
+    0b00000000,  // % percent
+    0b00111101,  // & ampersand or ~AS
+    0b01100001,  // ' apostrophe
+    0b00110010,  // ( open paren
+    0b01010010,  // ) close paren
+    0b0,         // * asterisk                // No Morse
+    0b00110101,  // + plus or ~AR
+    0b01001100,  // , comma
+    0b01011110,  // - hypen
+    0b01010101,  // . period
+    0b00110110,  // / slant
+    0b00100000,  // 0                         // Read the bits from RIGHT to
+                 // left,
+    0b00100001,  // 1                         // with a "1"=dit and "0"=dah
+    0b00100011,  // 2                         // example: 2 = 11000 or
+                 // dit-dit-dah-dah-dah
+    0b00100111,  // 3                         // the final bit is always 1 =
+                 // stop bit.
+    0b00101111,  // 4                         // see "sendElements" routine for
+                 // more info.
+    0b00111111,  // 5
+    0b00111110,  // 6
+    0b00111100,  // 7
+    0b00111000,  // 8
+    0b00110000,  // 9
+    0b01111000,  // : colon
+    0b01101010,  // ; semicolon
+    0b0,         // <                         // No Morse
+    0b00101110,  // = equals or ~BT
+    0b0,         // >                         // No Morse
+    0b01110011,  // ? question
+    0b01101001,  // @ at or ~AC
+    0b00000101,  // A
+    0b00011110,  // B
+    0b00011010,  // C
+    0b00001110,  // D
+    0b00000011,  // E
+    0b00011011,  // F
+    0b00001100,  // G
+    0b00011111,  // H
+    0b00000111,  // I
+    0b00010001,  // J
+    0b00001010,  // K
+    0b00011101,  // L
+    0b00000100,  // M
+    0b00000110,  // N
+    0b00001000,  // O
+    0b00011001,  // P
+    0b00010100,  // Q
+    0b00001101,  // R
+    0b00001111,  // S
+    0b00000010,  // T
+    0b00001011,  // U
+    0b00010111,  // V
+    0b00001001,  // W
+    0b00010110,  // X
+    0b00010010,  // Y
+    0b00011100   // Z
+};
+
+int morseCode(char c)  // code for a character, either case; 0 if none
+{
+  if (c >= 'a' && c <= 'z') c -= 32;
+  if (c < MORSE_FIRST || c > MORSE_LAST) return 0;
+  return morse[c - MORSE_FIRST];
+}
+
+int morseLength(int code)  // number of elements in a code
+{
+  int n = 0;
+  while (code > 1) {
+    code >>= 1;
+    n++;
+  }
+  return code ? n : 0;
+}
+
+// Prosign: the letters sent as one character, e.g. "SK" = ...-.-
+int morseJoin(const char *letters) {
+  int bits = 0, n = 0;  // elements so far, first on the right
+  for (; *letters; letters++) {
+    int c = morseCode(*letters);
+    int len = morseLength(c);
+    if (!len || n + len > MORSE_MAX_ELEMENTS) return 0;
+    for (int i = 0; i < len; i++) bits |= ((c >> i) & 1) << (n + i);
+    n += len;
+  }
+  return n ? bits | (1 << n) : 0;  // stop bit after the last element
+}
@@ -0,0 +1,29 @@
+#ifndef _MORSE_H_
+#define _MORSE_H_
+
+// Portable: builds for the ESP32 and for Linux (see tools/mrs) so that text
+// encoded on a computer sounds the same as text sent by the tutor.
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+
+//===================================  Morse Table Constants
+//=============================
+// A code holds one bit per element, read from the right (1 = dit, 0 = dah),
+// then a 1 stop bit.  morse[] holds the codes for '!' to 'Z'; prosigns made
+// by running letters together need up to MORSE_MAX_ELEMENTS in an int.
+#define MORSE_FIRST '!'         // morse[0]
+#define MORSE_LAST 'Z'          // last entry of morse[]
+#define MORSE_COUNT (MORSE_LAST - MORSE_FIRST + 1)
+#define MORSE_MAX_ELEMENTS 15   // longest code morseJoin() will build
+
+extern uint8_t morse[MORSE_COUNT];
+
+// Function Prototypes
+int morseCode(char c);
+int morseJoin(const char *letters);
+int morseLength(int code);
+
+#endif  // _MORSE_H_
@@ -0,0 +1,34 @@
+#ifndef _MRS_H_
+#define _MRS_H_
+
+// Portable: written by tools/mrs on a computer, played by the tutor.
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+
+//===================================  Morse Stream (MRS) Constants
+//======================
+// A .MRS file is text already turned into Morse: an MRS_HEADER, a seek table
+// and one record per character.  A record is the character to show and its
+// code (see morse.h): 2 bytes, or 3 if the code needs more than 7 elements,
+// marked by MRS_LONG in the first byte.  A space is ' ' with code 0.  Seek
+// table entry i is the file offset of record i * seekEvery.
+#define MRS_EXT ".MRS"
+#define MRS_MAGIC 0x3153524DUL  // "MRS1"
+#define MRS_SEEK_EVERY 128      // records per seek table entry
+#define MRS_LONG 0x80           // record's code is 16 bits
+#define MRS_RECORD_MAX 3        // bytes in the longest record
+
+typedef struct {
+  uint32_t magic;      // MRS_MAGIC
+  uint32_t chars;      // records
+  uint32_t seekEvery;  // records per seek table entry
+  uint32_t seekCount;  // seek table entries
+} MRS_HEADER;
+
+// Function Prototypes
+int mrsRecord(uint8_t *out, char shown, int code);
+
+#endif  // _MRS_H_
@@ -0,0 +1,241 @@
+/*
+
+  Sentence and paragraph index for SD card texts.
+
+  Index file: a NAV_HEADER, a page table, the sentence starts and the
+  paragraph starts (32-bit byte offsets, ascending).  Page table entry p
+  holds, for sentences and for paragraphs, the number of starts before byte
+  p * NAV_PAGE of the text: the position of the first start in that page.
+
+  The page table is written as the text is read, since its size follows from
+  the text's.  Sentence and paragraph starts go to scratch files meanwhile
+  and are appended at the end.
+
+  A paragraph starts after a blank line.  A sentence starts at the first
+  character after . ! or ? (and any closing quotes or brackets), white space,
+  and anything but a lower case letter; every paragraph starts a sentence.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "main.h"
+#include "storage.h"
+#include "library.h"
+#include "navindex.h"
+
+typedef struct {
+  uint32_t magic;       // NAV_MAGIC once the index is complete
+  uint32_t size;        // of the text when indexed
+  uint32_t stamp;       // its last write time
+  uint32_t sentences;   // entries in each table
+  uint32_t paragraphs;
+  uint32_t pages;
+} NAV_HEADER;
+
+typedef struct {
+  uint32_t sentence;   // first sentence start in the page
+  uint32_t paragraph;  // first paragraph start in the page
+} NAV_PAGE_ENTRY;
+
+typedef struct {  // start offsets waiting to be written
+  uint32_t at[NAV_BATCH];
+  int n;
+  uint32_t total;
+} NAV_BATCH_BUF;
+
+File navFile;  // index of the file being played
+NAV_HEADER navHeader;
+
+static void navPath(char *out, int size, const char *path, const char *ext) {
+  char name[LIB_NAME_LEN + 8];
+  char dir[LIB_PATH_LEN];
+  strncpy(dir, path, sizeof(dir) - 1);
+  dir[sizeof(dir) - 1] = 0;
+  const char *slash = strrchr(path, '/');
+  snprintf(name, sizeof(name), "_%s%s", slash ? slash + 1 : path, ext);
+  libraryParent(dir);
+  libraryJoin(out, size, dir, name);
+}
+
+static void keep(NAV_BATCH_BUF *b, File &f, uint32_t offset) {
+  b->at[b->n++] = offset;
+  b->total++;
+  if (b->n == NAV_BATCH) {
+    f.write((uint8_t *)b->at, b->n * 4);
+    b->n = 0;
+  }
+}
+
+static void append(File &to, const char *path) {  // copy then delete
+  uint8_t buf[512];
+  int n;
+  File from = store().open(path);
+  while (from && (n = from.read(buf, sizeof(buf))) > 0) to.write(buf, n);
+  if (from) from.close();
+  store().remove(path);
+}
+
+// Index a text in one pass.  Slow only the first time a book is played.
+bool navBuild(const char *path) {
+  char idxPath[LIB_PATH_LEN], sentPath[LIB_PATH_LEN], paraPath[LIB_PATH_LEN];
+  static NAV_BATCH_BUF sent, para;
+  NAV_HEADER h;
+  NAV_PAGE_ENTRY page;
+  uint8_t buf[512];
+  int n;
+
+  navPath(idxPath, sizeof(idxPath), path, NAV_EXT);
+  navPath(sentPath, sizeof(sentPath), path, ".SEN");
+  navPath(paraPath, sizeof(paraPath), path, ".PAR");
+  File text = store().open(path);
+  if (!text) return false;
+  store().remove(idxPath);
+  File idx = store().open(idxPath, FILE_WRITE);
+  File sf = store().open(sentPath, FILE_WRITE);
+  File pf = store().open(paraPath, FILE_WRITE);
+  if (!idx || !sf || !pf) {
+    Serial.println("Navigation: cannot write index (card locked?)");
+    text.close();
+    return false;
+  }
+  memset(&h, 0, sizeof(h));
+  h.size = text.size();
+  h.stamp = text.getLastWrite();
+  h.pages = h.size / NAV_PAGE + 1;
+  idx.write((uint8_t *)&h, sizeof(h));  // magic still 0: not usable yet
+  sent.n = sent.total = para.n = para.total = 0;
+
+  int newlines = 2;      // line ends since the last text: file start counts
+  bool ended = false;    // last text was the end of a sentence
+  bool gap = false;      // and white space has followed it
+  uint32_t offset = 0;
+  while ((n = text.read(buf, sizeof(buf))) > 0) {
+    for (int i = 0; i < n; i++, offset++) {
+      uint8_t c = buf[i];
+      if (offset % NAV_PAGE == 0) {  // a new page starts here
+        page.sentence = sent.total;
+        page.paragraph = para.total;
+        idx.write((uint8_t *)&page, sizeof(page));
+      }
+      if (isspace(c)) {
+        if (c == '\n') newlines++;
+        gap = ended;
+        continue;
+      }
+      if (newlines >= 2) {  // after a blank line
+        keep(&para, pf, offset);
+        keep(&sent, sf, offset);
+      } else if (gap && !islower(c))
+        keep(&sent, sf, offset);
+      newlines = 0;
+      gap = false;
+      ended = (c && strchr(".!?", c)) || (ended && c && strchr("\"')]", c));
+    }
+  }
+  text.close();
+  for (uint32_t p = (offset + NAV_PAGE - 1) / NAV_PAGE; p < h.pages; p++) {
+    page.sentence = sent.total;  // pages at or past the end
+    page.paragraph = para.total;
+    idx.write((uint8_t *)&page, sizeof(page));
+  }
+  sf.write((uint8_t *)sent.at, sent.n * 4);
+  pf.write((uint8_t *)para.at, para.n * 4);
+  sf.close();
+  pf.close();
+  append(idx, sentPath);
+  append(idx, paraPath);
+  h.sentences = sent.total;
+  h.paragraphs = para.total;
+  h.magic = NAV_MAGIC;  // complete
+  idx.seek(0);
+  idx.write((uint8_t *)&h, sizeof(h));
+  idx.close();
+  return true;
+}
+
+// Open a text's index.  False if it has none or the text has changed since;
+// navBuild() then.
+bool navOpen(const char *path) {
+  char idxPath[LIB_PATH_LEN];
+  navClose();
+  File text = store().open(path);
+  if (!text) return false;
+  uint32_t size = text.size(), stamp = text.getLastWrite();
+  text.close();
+  navPath(idxPath, sizeof(idxPath), path, NAV_EXT);
+  if (!store().exists(idxPath)) return false;
+  navFile = store().open(idxPath);
+  if (navFile &&
+      navFile.read((uint8_t *)&navHeader, sizeof(navHeader)) ==
+          sizeof(navHeader) &&
+      navHeader.magic == NAV_MAGIC && navHeader.size == size &&
+      navHeader.stamp == stamp &&
+      navFile.size() == sizeof(NAV_HEADER) +
+                            navHeader.pages * sizeof(NAV_PAGE_ENTRY) +
+                            (navHeader.sentences + navHeader.paragraphs) * 4)
+    return true;
+  navClose();  // stale, partly written or damaged
+  return false;
+}
+
+// Number of starts in a table before "pos", and the first at or after it
+static uint32_t startsBefore(long pos, bool paragraph, uint32_t *next) {
+  NAV_PAGE_ENTRY page;
+  uint32_t at[16];
+  uint32_t count = paragraph ? navHeader.paragraphs : navHeader.sentences;
+  uint32_t table = sizeof(NAV_HEADER) + navHeader.pages * sizeof(page) +
+                   (paragraph ? navHeader.sentences * 4 : 0);
+  uint32_t p = pos / NAV_PAGE;
+  if (p >= navHeader.pages) p = navHeader.pages - 1;
+  navFile.seek(sizeof(NAV_HEADER) + p * sizeof(page));
+  navFile.read((uint8_t *)&page, sizeof(page));
+  uint32_t i = paragraph ? page.paragraph : page.sentence;
+  navFile.seek(table + i * 4);
+  while (i < count) {  // at most one page of starts to pass
+    int n = navFile.read((uint8_t *)at, sizeof(at)) / 4;
+    if (n <= 0) break;
+    for (int j = 0; j < n && i < count; j++, i++)
+      if (at[j] >= (uint32_t)pos) {
+        *next = at[j];
+        return i;
+      }
+  }
+  return i;
+}
+
+static long startAt(uint32_t i, bool paragraph) {
+  uint32_t at;
+  navFile.seek(sizeof(NAV_HEADER) +
+               navHeader.pages * sizeof(NAV_PAGE_ENTRY) +
+               ((paragraph ? navHeader.sentences : 0) + i) * 4);
+  return navFile.read((uint8_t *)&at, 4) == 4 ? at : -1;
+}
+
+long navNext(long pos, bool paragraph)  // next start after pos, -1 if none
+{
+  uint32_t next = pos;
+  uint32_t count = paragraph ? navHeader.paragraphs : navHeader.sentences;
+  if (!navFile) return -1;
+  uint32_t i = startsBefore(pos + 1, paragraph, &next);
+  return i < count ? (long)next : -1;
+}
+
+// Start of the sentence (or paragraph) being played, or of the one before if
+// it has only just begun.
+long navPrev(long pos, bool paragraph) {
+  uint32_t next;
+  if (!navFile) return -1;
+  pos -= NAV_REPEAT;
+  if (pos <= 0) return 0;
+  uint32_t i = startsBefore(pos + 1, paragraph, &next);
+  return i ? startAt(i - 1, paragraph) : 0;
+}
+
+void navClose(void) {
+  if (navFile) navFile.close();
+}
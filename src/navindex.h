@@ -0,0 +1,27 @@
+#ifndef _NAVINDEX_H_
+#define _NAVINDEX_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  Navigation Index Constants
+//========================
+// A hidden "_<name>.NAV" file beside each SD text lists where its sentences
+// and paragraphs start, so playback can jump between them with a seek.  It is
+// built in one pass over the text the first time the file is played, and
+// again if the text changes.  A jump reads one NAV_PAGE table entry and at
+// most a page's worth of boundaries, however long the book.
+#define NAV_EXT ".NAV"
+#define NAV_MAGIC 0x314E544DUL  // "MTN1": index is complete
+#define NAV_PAGE 4096           // bytes of text per page table entry
+#define NAV_BATCH 64            // boundaries buffered per write when building
+#define NAV_REPEAT 10           // back within this many chars: previous one
+
+// Function Prototypes
+bool navOpen(const char *path);
+bool navBuild(const char *path);
+long navNext(long pos, bool paragraph);
+long navPrev(long pos, bool paragraph);
+void navClose(void);
+
+#endif  // _NAVINDEX_H_
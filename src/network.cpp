@@ -7,49 +7,140 @@
 #include "UART.h"  // VE3OOI Serial Interface Routines (TTY Commands)
 #include "main.h"
 #include "network.h"
+#include "latency.h"
+#include "stream.h"
+#include "presence.h"
+#include "telemetry.h"
+#include "remotecli.h"
+#include "classroom.h"
+#include "webserver.h"
 
 // Added by VE3OOI
 extern char myCall[10];  // Defined in main.cpp
 extern TUTOR_STRUT cfg;  // Defined in main.cpp
 
 char localid[10];
-char tbuf[MAXBUFLEN],
-    rbuf[MAXBUFLEN];  // send receive MQTT buffer
+char rbuf[MAXBUFLEN];  // receive MQTT buffer
 
 WiFiClient espClient;
 PubSubClient client(espClient);
 //
 
-// orign code here
-char buf[MAXBUFLEN];        // buffer for incoming characters
-int inPtr = 0, outPtr = 0;  // pointer to location of next character
+// All PubSubClient calls are made from netTask() once connected.  The UI only
+// posts to txQueue and reads rxQueue, so keying never waits on TCP and the
+// broker keepalive is serviced even while morseInput() is blocked.
+QueueHandle_t txQueue = NULL;      // outbound NET_MSG, drained by netTask()
+QueueHandle_t rxQueue = NULL;      // incoming characters for twoWay()
+SemaphoreHandle_t netLock = NULL;  // held while touching client
+TaskHandle_t netTaskHandle = NULL;
+unsigned long rxDrops = 0;  // received characters lost to a full rxQueue
+unsigned long txDrops = 0;  // outbound messages lost to a full txQueue
+
+void netTask(void *param) {
+  NET_MSG msg;
+  TickType_t wake = xTaskGetTickCount();
+  for (;;) {
+    if (cfg.conflag & SRV_CONNECTED) {
+      xSemaphoreTake(netLock, portMAX_DELAY);
+      client.loop();  // keepalive and incoming messages
+      for (int i = 0; i < NET_TX_BURST; i++) {  // then outbound traffic
+        if (xQueueReceive(txQueue, &msg, 0) != pdTRUE) break;
+        client.publish(msg.topic, msg.payload, msg.len, msg.retain);
+      }
+      pingPoll();
+      streamPoll();
+      presencePoll();
+      classPoll();
+      if (!client.connected()) {
+        Serial.print("MQTT connection lost: ");
+        Serial.println(client.state());
+        cfg.conflag &= ~SRV_CONNECTED;
+      }
+      xSemaphoreGive(netLock);
+    }
+    telemetryPoll();  // samples even while offline, publishes when idle
+#ifdef WEB_SERVER
+    webPoll();  // browsers; only needs Wi-Fi, not the broker
+#endif
+    vTaskDelayUntil(&wake, pdMS_TO_TICKS(NET_PUMP_MS));
+  }
+}
+
+void startNetTask(void) {
+  if (netTaskHandle) return;  // only ever one network task
+  txQueue = xQueueCreate(TX_QUEUE_LEN, sizeof(NET_MSG));
+  rxQueue = xQueueCreate(RX_QUEUE_LEN, sizeof(char));
+  netLock = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(netTask, "net", NET_TASK_STACK, NULL,
+                          NET_TASK_PRIORITY, &netTaskHandle, NET_TASK_CORE);
+}
+
+// Stable name for this unit in fleet topics: "<call>-<low 24 bits of MAC>"
+void deviceId(char *id, int size) {
+  uint64_t mac = ESP.getEfuseMac();
+  snprintf(id, size, "%s-%06lx", myCall, (unsigned long)(mac >> 24) & 0xFFFFFF);
+}
 
-// Added by VE3OOI to process MQTT messages from main.cpp
-void processMQTT(void) { client.loop(); }
+// Queue a message for netTask() to publish.  Never blocks; returns false if
+// the queue is full or the message does not fit.
+bool netPublish(const char *topic, const void *data, unsigned int len,
+                bool retain) {
+  NET_MSG msg;
+  if (!(cfg.conflag & SRV_CONNECTED)) return false;
+  if (strlen(topic) >= sizeof(msg.topic) || len > sizeof(msg.payload))
+    return false;
+  strcpy(msg.topic, topic);
+  memcpy(msg.payload, data, len);
+  msg.len = len;
+  msg.retain = retain;
+  if (xQueueSend(txQueue, &msg, 0) != pdTRUE) {
+    txDrops++;
+    return false;
+  }
+  return true;
+}
+
+// Subscribe to an extra topic while netTask() is running
+bool netSubscribe(const char *topic) {
+  bool ok;
+  if (!(cfg.conflag & SRV_CONNECTED)) return false;
+  xSemaphoreTake(netLock, portMAX_DELAY);
+  ok = client.subscribe(topic);
+  xSemaphoreGive(netLock);
+  return ok;
+}
+
+bool netUnsubscribe(const char *topic) {
+  bool ok;
+  if (!(cfg.conflag & SRV_CONNECTED)) return false;
+  xSemaphoreTake(netLock, portMAX_DELAY);
+  ok = client.unsubscribe(topic);
+  xSemaphoreGive(netLock);
+  return ok;
+}
 
 // orign code here
 void enQueue(char ch) {
-  buf[inPtr++] = ch;  // add character to buffer, increment pointer
-  if (inPtr == MAXBUFLEN) inPtr = 0;  // circularize it!
+  if (xQueueSend(rxQueue, &ch, 0) != pdTRUE) rxDrops++;
 }
 
 char deQueue() {
   char ch = 0;
-  if (outPtr != inPtr)                  // return 0 if no characters available
-    ch = buf[outPtr++];                 // get character and increment pointer
-  if (outPtr == MAXBUFLEN) outPtr = 0;  // circularize it!
+  if (rxQueue) xQueueReceive(rxQueue, &ch, 0);  // 0 if nothing available
   return ch;
 }
 
 // Modified by VE3OOI
 void sendWireless(uint8_t data) {
+  char tbuf[sizeof(localid) + 2];
   if (cfg.conflag & SRV_CONNECTED) {
-    memset(tbuf, 0,
-           sizeof(tbuf));  // Flush string.  Ensure it NULL terminated string
     sprintf(tbuf, "%s:%c", localid, data);
-    client.publish(cfg.room, (char *)tbuf, strlen(tbuf));
-    Serial.print("Sending MQTT message: ");
-    Serial.println((char *)tbuf);
+    if (netPublish(cfg.room, tbuf, strlen(tbuf), false)) {
+      Serial.print("Sending MQTT message: ");
+      Serial.println((char *)tbuf);
+    } else {
+      Serial.println("Error: MQTT send queue full");
+    }
   } else {
     Serial.println("Error: No MQTT server connection");
   }
@@ -58,22 +149,42 @@ void sendWireless(uint8_t data) {
 // Modified by VE3OOI
 void closeWireless() {
   setStatusLED(BLACK);  // erase two-way status LED
+  setPingLED(BLACK);    // and the latency indicator beside it
                         //  Serial.println("Telling peer I am closing");
+  for (int i = 0; txQueue && i < NET_FLUSH_WAIT / NET_PUMP_MS; i++) {
+    if (!uxQueueMessagesWaiting(txQueue)) break;  // let last characters go
+    delay(NET_PUMP_MS);
+  }
+  if (netLock) xSemaphoreTake(netLock, portMAX_DELAY);
+  if (cfg.conflag & SRV_CONNECTED) leavePresence();  // clear our heartbeat
+  cfg.conflag = 0;  // stop netTask() before pulling the connection
   client.disconnect();
+  if (netLock) xSemaphoreGive(netLock);
   Serial.println("Disconnected from MQTT");
+#ifndef WEB_SERVER
   WiFi.disconnect();
-  cfg.conflag = 0;
   Serial.println("Wireless now closed");
+#endif
+}
+
+// Join Wi-Fi in the background at power up so the web page is always
+// reachable.  Does not wait: netTask() starts serving once connected.
+void startWiFi(void) {
+  if (!strcmp(cfg.wifi_ssid, DEFAULT_SSID)) return;  // not configured yet
+  startNetTask();
+  WiFi.begin(cfg.wifi_ssid, cfg.wifi_password);
 }
 
 // Modified by VE3OOI
-void initWireless() {
+void initWireless(bool announce) {
+  startNetTask();
   Serial.println("\r\n\r\nMQTT Sensor v0.1 Initialization\r\n");
   Serial.println();
   Serial.print("Connecting to ");
   Serial.println(cfg.wifi_ssid);
 
-  WiFi.begin(cfg.wifi_ssid, cfg.wifi_password);
+  if (WiFi.status() != WL_CONNECTED)  // may already be up for the web page
+    WiFi.begin(cfg.wifi_ssid, cfg.wifi_password);
 
   cfg.conflag = 0;
   int timeout = 0;
@@ -88,6 +199,7 @@ void initWireless() {
     Serial.print("Error Connecting to ");
     Serial.println(cfg.wifi_ssid);
     cfg.conflag = 0;
+    noteConnect(false);
     return;
   }
 
@@ -120,6 +232,7 @@ void initWireless() {
   } else {
     Serial.println("Error resolving MQTT hostname via DHCP provided DNS");
     cfg.conflag = 0;
+    noteConnect(false);
     return;
   }
 
@@ -135,49 +248,64 @@ void initWireless() {
     sprintf(localid, "%c%c%c", (char)random(65, 90), (char)random(65, 90),
             (char)random(65, 90));
 
-    if (client.connect(localid, cfg.mqtt_userid, cfg.mqtt_password)) {
-      memset(tbuf, 0,
-             sizeof(tbuf));  // Flush string.  Ensure it NULL terminated string
+    // broker clears our retained heartbeat if we vanish without closing
+    char willTopic[MAX_TOPIC_LEN];
+    presenceTopic(willTopic, sizeof(willTopic), localid);
+    if (client.connect(localid, cfg.mqtt_userid, cfg.mqtt_password,
+                       willTopic, 0, true, "")) {
+      char tbuf[MAXBUFLEN];
       // Announce arrival
-      sprintf(tbuf, "%s:%s-%s", myCall, localid, "Online");
-
-      client.publish(cfg.room, (char *)tbuf, strlen(tbuf));
-      delay(500);  // Allow message to reach device.  To allow receive buffer to
-                   // be processed
+      snprintf(tbuf, sizeof(tbuf), "%s:%s-%s", myCall, localid, "Online");
+      client.publish(cfg.room, (const uint8_t *)tbuf, strlen(tbuf));
 
       // Subscribe to topic (which i call the "room")
       client.subscribe(cfg.room);
-      cfg.conflag |= SRV_CONNECTED;
+      initLatency();  // reset RTT statistics and answer peer probes
+      initStream();   // accept file streams and queue reports
+      initPresence();  // heartbeat and roster of stations in the room
+#ifndef REMOVE_CLI
+      initRemoteCLI();  // configuration commands, if a CLI key is set
+#endif
+      xQueueReset(txQueue);
+      xQueueReset(rxQueue);
+      cfg.conflag |= SRV_CONNECTED;  // netTask() takes over from here
+      noteConnect(true);
 
       // Send CQ
-      sendWireless(' ');
-      sendWireless('c');
-      sendWireless('q');
-      sendWireless(' ');
-      delay(500);  // Allow messages to reach device.  To allow receive buffer
-                   // to be processed
+      if (announce) {
+        sendWireless(' ');
+        sendWireless('c');
+        sendWireless('q');
+        sendWireless(' ');
+        delay(500);  // Allow messages to reach device.  To allow receive
+                     // buffer to be processed
+      }
 
       // Error connecting to MQTT Server
     } else {
       Serial.print("Error Connecting to MQTT Server: ");
       Serial.println(client.state());
       cfg.conflag = 0;
+      noteConnect(false);
       return;
     }
   }
-  inPtr = outPtr = 0;  // reset pointer to location of next character
-  memset(buf, 0,
-         sizeof(buf));  // Flush string.  Ensure it NULL terminated string
   memset(rbuf, 0,
          sizeof(rbuf));  // Flush string.  Ensure it NULL terminated string
-  memset(tbuf, 0,
-         sizeof(tbuf));  // Flush string.  Ensure it NULL terminated string
   Serial.println("MQTT Connected");
 }
 
 // Added by VE3OOIt process incomming MQTT message
 void MQTTcallback(char *topic, byte *data, unsigned int data_len) {
   char *substring, ch;
+
+  if (latencyMessage(topic, data, data_len)) return;  // probe or echo
+  if (streamMessage(topic, data, data_len)) return;   // file stream
+  if (presenceMessage(topic, data, data_len)) return; // heartbeat/directory
+  if (classMessage(topic, data, data_len)) return;    // classroom lessons
+#ifndef REMOVE_CLI
+  if (remoteMessage(topic, data, data_len)) return;   // remote CLI command
+#endif
   // In order to republish this payload, a copy must be made
   // as the orignal payload buffer will be overwritten whilst
   // constructing the PUBLISH packet.
@@ -202,8 +330,7 @@ void MQTTcallback(char *topic, byte *data, unsigned int data_len) {
       if (substring != NULL) {
         if (strlen(substring) > 1 && substring[1] != (char)NULL) {
           ch = substring[1];
-          setStatusLED(GREEN);  // green status LED for data received
-          enQueue(ch);          // put recieved data into queue
+          enQueue(ch);  // put recieved data into queue
         } else {
           Serial.println("MQTTcallback Received null message");
         }
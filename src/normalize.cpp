@@ -0,0 +1,195 @@
+/*
+
+  Streaming text normalizer for SD card texts (see normalize.h).
+
+  A small state machine: a UTF-8 character being decoded, a prosign name
+  being collected, and whether a word space is owed.  Each byte costs a few
+  comparisons and a table lookup, far faster than any Morse speed.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+#include <string.h>
+
+#include "morse.h"
+#include "normalize.h"
+
+// Prosigns without a punctuation character of their own, by byte
+static const char *prosigns[] = {"BK", "CL", "CT", "DO", "HH", "KA", "SOS", "VE"};
+#define PROSIGNS (int)(sizeof(prosigns) / sizeof(prosigns[0]))
+
+// Base letters of U+00C0 to U+00FF and U+0100 to U+017F; '?' is handled in
+// mapChar() or has no letter
+static const char latin1[] = "AAAAAA?CEEEEIIIIDNOOOOO?OUUUUY??"
+                             "AAAAAA?CEEEEIIIIDNOOOOO?OUUUUY?Y";
+static const char latinA[] = "AAAAAACCCCCCCCDDDDEEEEEEEEEEGGGGGGGGHHHH"
+                             "IIIIIIIIII??JJKKKLLLLLLLLLLNNNNNNNNNOOOOOO"
+                             "??RRRRRRSSSSSSSSTTTTTTUUUUUUUUUUUUWWYYYZZZZZZS";
+
+long normDropped = 0;
+static uint32_t codePoint;      // UTF-8 character being decoded
+static int moreBytes = 0;       // continuation bytes it still needs
+static uint8_t leadByte;        // its first byte, for Latin-1 if it is not UTF-8
+static char token[NORM_TOKEN + 1];
+static int tokenLen = -1;       // letters after a '<', -1 = not in one
+static bool spaceOwed = false;  // white space since the last character
+static bool started = false;    // a character has been given back
+
+void normReset(void) {
+  moreBytes = 0;
+  tokenLen = -1;
+  spaceOwed = false;
+  started = false;
+  normDropped = 0;
+}
+
+// What a character becomes: "" to leave it out quietly, NULL if it has no
+// Morse, " " for white space
+static const char *mapChar(uint32_t c) {
+  static char one[2];
+  if (c < 0x80) {
+    if (c == ' ' || (c >= '\t' && c <= '\r')) return " ";
+    if (c >= 'a' && c <= 'z') c -= 32;
+    one[0] = c;
+    if (morseCode(c)) return one;
+    switch (c) {
+      case '[': case '{': return "(";
+      case ']': case '}': return ")";
+      case '_': case '~': return "-";
+      case '\\': case '|': return "/";
+      case '`': return "'";
+    }
+    return c < ' ' ? "" : NULL;
+  }
+  switch (c) {
+    case 0xA0: case 0x2007: case 0x202F: case 0x205F: case 0x3000:
+      return " ";  // no-break and other fixed spaces
+    case 0xAD: case 0x200B: case 0x200C: case 0x200D: case 0x2060: case 0xFEFF:
+      return "";   // soft hyphen, zero width characters, byte order mark
+    case 0xAB: case 0xBB: case 0x201C: case 0x201D: case 0x201E: case 0x201F:
+    case 0x2033:
+      return "\"";
+    case 0xB4: case 0x2018: case 0x2019: case 0x201A: case 0x201B: case 0x2032:
+    case 0x2039: case 0x203A:
+      return "'";
+    case 0x2010: case 0x2011: case 0x2012: case 0x2013: case 0x2014:
+    case 0x2015: case 0x2212:
+      return "-";
+    case 0x2026: return "...";
+    case 0xC6: case 0xE6: return "AE";
+    case 0xD7: return "X";
+    case 0xDE: case 0xFE: return "TH";
+    case 0xDF: return "SS";
+    case 0xF7: return "/";
+    case 0x132: case 0x133: return "IJ";
+    case 0x152: case 0x153: return "OE";
+  }
+  if (c >= 0x2000 && c <= 0x200A) return " ";
+  if (c >= 0x300 && c <= 0x36F) return "";  // accents written separately
+  one[0] = '?';
+  if (c >= 0xC0 && c <= 0xFF) one[0] = latin1[c - 0xC0];
+  if (c >= 0x100 && c <= 0x17F) one[0] = latinA[c - 0x100];
+  return one[0] == '?' ? NULL : one;
+}
+
+static int emit(const char *s, char *out, int n) {
+  if (!s) {
+    normDropped++;
+    return n;
+  }
+  if (*s == ' ') {
+    spaceOwed = started;  // no space before the first character
+    return n;
+  }
+  if (*s && spaceOwed) {
+    out[n++] = ' ';
+    spaceOwed = false;
+  }
+  for (; *s; s++) {
+    out[n++] = *s;
+    started = true;
+  }
+  return n;
+}
+
+static int endToken(char *out, int n)  // '<' and letters that were not a prosign
+{
+  if (tokenLen < 0) return n;
+  normDropped++;  // the '<'
+  token[tokenLen] = 0;
+  tokenLen = -1;
+  return emit(token, out, n);
+}
+
+static int prosign(char *out, int n) {  // "<" letters ">"
+  token[tokenLen] = 0;
+  int code = morseJoin(token);
+  char c[2] = {0, 0};
+  for (int i = MORSE_FIRST; code && i <= MORSE_LAST && !c[0]; i++)
+    if (morse[i - MORSE_FIRST] == code) c[0] = i;
+  for (int i = 0; code && i < PROSIGNS && !c[0]; i++)
+    if (morseJoin(prosigns[i]) == code) c[0] = NORM_PROSIGN + i;
+  if (!c[0]) return endToken(out, n);  // not a prosign, e.g. <NAME>
+  tokenLen = -1;
+  return emit(c, out, n);
+}
+
+// Feed the next byte of a text; returns how many characters were put in
+// "out" (room for NORM_MAX), often none
+int normByte(int b, char *out) {
+  int n = 0;
+  if (moreBytes) {
+    if ((b & 0xC0) == 0x80) {  // continuation byte
+      codePoint = (codePoint << 6) | (b & 0x3F);
+      if (--moreBytes) return 0;
+      return emit(mapChar(codePoint), out, n);
+    }
+    moreBytes = 0;  // not UTF-8 after all: take the lead byte as Latin-1
+    n = emit(mapChar(leadByte), out, n);
+  }
+  if (b >= 0x80) {
+    n = endToken(out, n);
+    if (b >= 0xF8) return emit(mapChar(b), out, n);  // only Latin-1
+    if (b >= 0xC0) {                                 // lead byte
+      leadByte = b;
+      moreBytes = b >= 0xF0 ? 3 : b >= 0xE0 ? 2 : 1;
+      codePoint = b & (0x3F >> moreBytes);
+    }  // a continuation byte alone: joined part way through a character
+    return n;
+  }
+  if (tokenLen >= 0) {
+    bool letter = (b >= 'A' && b <= 'Z') || (b >= 'a' && b <= 'z');
+    if (b == '>' && tokenLen > 0) return prosign(out, n);
+    if (letter && tokenLen < NORM_TOKEN) {
+      token[tokenLen++] = b & ~0x20;
+      return n;
+    }
+    n = endToken(out, n);
+  }
+  if (b == '<') {
+    tokenLen = 0;
+    return n;
+  }
+  return emit(mapChar(b), out, n);
+}
+
+int normEnd(char *out)  // end of the text: anything still held back
+{
+  int n = 0;
+  if (moreBytes) n = emit(mapChar(leadByte), out, n);
+  moreBytes = 0;
+  return endToken(out, n);
+}
+
+int normProsign(char c)  // code for a byte from NORM_PROSIGN up, 0 if none
+{
+  int i = (uint8_t)c - NORM_PROSIGN;
+  return (i >= 0 && i < PROSIGNS) ? morseJoin(prosigns[i]) : 0;
+}
@@ -0,0 +1,36 @@
+#ifndef _NORMALIZE_H_
+#define _NORMALIZE_H_
+
+// Portable: used by the tutor while playing SD texts and by tools/mrs, so a
+// text sounds the same either way.
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+#include <stdint.h>
+
+//===================================  Text Normalizer Constants
+//=========================
+// Texts come from e-books and web pages: UTF-8 with curly quotes, dashes,
+// accented letters, line breaks and indents.  normByte() takes a text one
+// byte at a time and gives back only what can be sent: upper case letters,
+// digits, punctuation with a Morse code and single word spaces.  Typographic
+// punctuation becomes its plain equivalent and accents are dropped.  Letters
+// between < and > become one prosign: the punctuation character with the
+// same code (<BT> is =, <AR> is +) or, for the few without one, a byte from
+// NORM_PROSIGN up that normProsign() turns back into a code.  Bytes that are
+// not UTF-8 are read as Latin-1.  Only a character being decoded or a
+// prosign name is held back, so it can be reset and restarted after a seek.
+#define NORM_TOKEN 3        // longest prosign name, e.g. SOS
+#define NORM_MAX 8          // most bytes one normByte() call gives back
+#define NORM_PROSIGN 0x80   // first prosign byte
+
+extern long normDropped;    // characters left out since normReset()
+
+// Function Prototypes
+void normReset(void);
+int normByte(int b, char *out);
+int normEnd(char *out);
+int normProsign(char c);
+
+#endif  // _NORMALIZE_H_
@@ -0,0 +1,135 @@
+/*
+
+  Playlists for SD card playback.
+
+  A folder's items come from its library index: folders sort first, so the
+  files are the entries from the first non-folder on, found by a binary
+  search.  A playlist file is counted once when opened; items are then read
+  forward from the last one found, so playing in order reads each line once.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "main.h"
+#include "storage.h"
+#include "library.h"
+#include "playlist.h"
+
+#define LIST_TEXT 0    // a single file
+#define LIST_FOLDER 1  // the files in a folder
+#define LIST_FILE 2    // a playlist file
+
+char listPath[LIB_PATH_LEN];  // what was opened
+int listType = LIST_TEXT;
+int listCount = 0;
+int listFirst = 0;   // LIST_FOLDER: library entry of the first file
+File listFile;       // LIST_FILE: open playlist
+int listNext = 0;    // LIST_FILE: item starting at listFile's position
+char listLine[PLAYLIST_LINE];  // LIST_FILE: item listNext - 1
+
+static bool endsWith(const char *s, const char *end) {
+  int n = strlen(s), m = strlen(end);
+  return n >= m && !strcasecmp(s + n - m, end);
+}
+
+// Next item line of the playlist file, false at the end
+static bool nextLine(char *line) {
+  for (;;) {
+    int n = 0, c;
+    while ((c = listFile.read()) >= 0 && c != '\n')
+      if (c != '\r' && n < PLAYLIST_LINE - 1) line[n++] = c;
+    line[n] = 0;
+    if (c < 0 && !n) return false;
+    char *p = line;
+    while (*p == ' ' || *p == '\t') p++;
+    if (*p && *p != '#') {
+      memmove(line, p, strlen(p) + 1);
+      return true;
+    }
+  }
+}
+
+// Open a folder, playlist file or text.  Returns the number of items.
+int playlistOpen(const char *path) {
+  LIB_ENTRY e;
+  playlistClose();
+  strncpy(listPath, path, sizeof(listPath) - 1);
+  listPath[sizeof(listPath) - 1] = 0;
+  File f = store().open(path);
+  if (!f) return 0;
+  bool isDir = f.isDirectory();
+  f.close();
+  if (isDir) {
+    listType = LIST_FOLDER;
+    if (!libraryOpen(path)) return 0;
+    int lo = 0, hi = libraryCount();  // first entry that is not a folder
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (libraryEntry(mid, &e) && e.isDir)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    listFirst = lo;
+    listCount = libraryCount() - lo;
+  } else if (endsWith(path, PLAYLIST_EXT)) {
+    char line[PLAYLIST_LINE];
+    listType = LIST_FILE;
+    listFile = store().open(path);
+    while (listFile && nextLine(line)) listCount++;
+    if (listFile) listFile.seek(0);
+  } else {
+    listType = LIST_TEXT;
+    listCount = 1;
+  }
+  return listCount;
+}
+
+bool playlistIsList(void) { return listType != LIST_TEXT; }
+
+// Full path of item i
+bool playlistItem(int i, char *path, int size) {
+  LIB_ENTRY e;
+  char dir[LIB_PATH_LEN];
+  if (i < 0 || i >= listCount) return false;
+  switch (listType) {
+    case LIST_TEXT:
+      strncpy(path, listPath, size - 1);
+      path[size - 1] = 0;
+      return true;
+    case LIST_FOLDER:
+      if (!libraryEntry(listFirst + i, &e)) return false;
+      libraryJoin(path, size, listPath, e.name);
+      return true;
+  }
+  if (!listFile) return false;
+  if (i < listNext - 1) {  // going back: start again
+    listFile.seek(0);
+    listNext = 0;
+  }
+  while (listNext <= i) {  // read forward to it
+    if (!nextLine(listLine)) return false;
+    listNext++;
+  }
+  if (listLine[0] == '/') {  // from the top of the card
+    strncpy(path, listLine, size - 1);
+    path[size - 1] = 0;
+  } else {  // from the playlist's folder
+    strcpy(dir, listPath);
+    libraryParent(dir);
+    libraryJoin(path, size, dir, listLine);
+  }
+  return true;
+}
+
+void playlistClose(void) {
+  if (listType == LIST_FOLDER) libraryClose();
+  if (listFile) listFile.close();
+  listType = LIST_TEXT;
+  listCount = listFirst = listNext = 0;
+}
@@ -0,0 +1,23 @@
+#ifndef _PLAYLIST_H_
+#define _PLAYLIST_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  Playlist Constants
+//================================
+// What sendFile() plays: every file in a folder (in library order), the
+// files named in a playlist file, or a single text.  A playlist file ends in
+// PLAYLIST_EXT and lists one file per line, relative to its own folder
+// unless it starts with '/'.  Blank lines and lines starting with '#' are
+// skipped, so M3U playlists made on a computer work.
+#define PLAYLIST_EXT ".M3U"
+#define PLAYLIST_LINE 300  // longest line read from a playlist file
+
+// Function Prototypes
+int playlistOpen(const char *path);
+bool playlistIsList(void);
+bool playlistItem(int i, char *path, int size);
+void playlistClose(void);
+
+#endif  // _PLAYLIST_H_
@@ -0,0 +1,52 @@
+#ifndef _PRESENCE_H_
+#define _PRESENCE_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  Presence Constants
+//================================
+// Each connected unit keeps a retained heartbeat "<call>,<minutes online>" on
+// "<room>/hb/<id>".  The broker clears it through the last will if the unit
+// drops off, and the unit clears it itself on a clean close.  One unit per
+// room (the lowest id) keeps "rooms/<room>" = "<stations>,<id>" up to date so
+// that units can list active rooms before joining one.  The directory entry
+// is retained and nobody is left to clear it if the whole room drops off at
+// once, so a reader only lists a room while the heartbeat of the unit that
+// wrote the entry is still there: that heartbeat is cleared by its will.
+#define HB_SUFFIX "/hb/"          // appended to room name for heartbeats
+#define DIRECTORY_PREFIX "rooms/" // prepended to room name for directory
+#define HB_INTERVAL 60000         // mS between heartbeats
+#define HB_EXPIRE (3 * HB_INTERVAL)  // forget stations silent this long
+#define ROSTER_MAX 24             // stations remembered in our room
+#define ROOMS_MAX 16              // rooms remembered from the directory
+#define HB_MAX_MSG_LEN 24         // longest heartbeat accepted
+
+#define ROOM_HEARD 1              // directory entry seen, writer not watched yet
+#define ROOM_WATCHED 2            // subscribed to writer's heartbeat
+#define ROOM_LIVE 3               // writer's heartbeat seen, room is listed
+
+typedef struct {
+  char id[4];                   // connection id (localid) of station
+  char call[MAX_CALLSIGN_STRING];
+  unsigned int minutes;         // minutes online, from heartbeat
+  unsigned long seen;           // millis() of last heartbeat, 0 = slot free
+} STATION;
+
+typedef struct {
+  char name[MAX_CHAR_STRING];
+  unsigned int stations;        // 0 = slot free
+  char leader[4];               // id of unit that wrote the entry
+  byte state;                   // ROOM_HEARD, ROOM_WATCHED or ROOM_LIVE
+} ROOM;
+
+// Function Prototypes
+void presenceTopic(char *topic, int size, const char *id);
+void initPresence(void);
+bool presenceMessage(char *topic, byte *data, unsigned int len);
+void presencePoll(void);
+void leavePresence(void);
+int getRoster(STATION *list, int max);
+int getRooms(ROOM *list, int max);
+
+#endif  // _PRESENCE_H_
@@ -0,0 +1,50 @@
+#ifndef _REMOTECLI_H_
+#define _REMOTECLI_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  Remote CLI Constants
+//==============================
+// A unit with a CLI key set accepts configuration commands on "cmd/<dev>"
+// where <dev> is deviceId().  Each command is "<seq> <mac> <command>":
+//   <seq>     decimal, greater than the last accepted seq this session
+//   <mac>     lowercase hex HMAC-SHA256(key, "<challenge>:<seq>:<command>")
+//   <command> a serial CLI command line, e.g. "W S MYWIFI"
+// <challenge> is a random value the unit publishes (retained) on
+// "cmd/<dev>/challenge" each time it connects, so old commands cannot be
+// replayed.  Output comes back on "cmd/<dev>/reply" as "<seq> <text>" chunks
+// ending with "<seq> OK" or "<seq> ERR <reason>".
+#define REMOTE_PREFIX "cmd/"
+#define CHALLENGE_SUFFIX "/challenge"
+#define REPLY_SUFFIX "/reply"
+#define REMOTE_COMMANDS "CHMNPRSUW"   // commands allowed remotely; not L,
+                                      // which reloads cfg under the UI task
+#define CHALLENGE_BYTES 8             // random bytes in session challenge
+#define HMAC_BYTES 32                 // SHA-256
+#define REMOTE_MAX_MSG_LEN 160        // longest command message accepted
+#define REMOTE_CHUNK 192              // reply text per message; fits 256 byte
+                                      // PubSubClient packet with topic
+
+// Collects CLI output and publishes it in REMOTE_CHUNK pieces
+class ReplyBuffer : public Print {
+ public:
+  ReplyBuffer(const char *topic, unsigned long seq);
+  size_t write(uint8_t ch);
+  using Print::write;
+  void finish(const char *status);
+
+ private:
+  void flush(void);
+  const char *topic;
+  char text[REMOTE_CHUNK + 16];  // "<seq> " prefix plus chunk
+  int prefix, len;
+};
+
+// Function Prototypes
+void initRemoteCLI(void);
+bool keyMac(const char *text, int len, char *hex);
+bool remoteAllowed(char *command);
+bool remoteMessage(char *topic, byte *data, unsigned int len);
+
+#endif  // _REMOTECLI_H_
@@ -0,0 +1,189 @@
+/*
+
+  Per-character performance log (see statlog.h).
+
+  The log is only ever appended to.  STATS_SUM is written after the log,
+  so if power fails between the two the totals are behind, never ahead:
+  statsBegin() adds in the records after the ones they cover.  If the log
+  is shorter than the totals claim (it was deleted or replaced), they are
+  rebuilt from the whole log.  A write that fails part way still moves the
+  count past the whole records it wrote, so they are not counted twice.  A
+  record it cut short is padded out with zeros before the next records are
+  appended, and the count moves past it too.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "main.h"
+#include "storage.h"
+#include "wordlist.h"
+#include "adaptive.h"
+#include "statlog.h"
+
+extern Print *cliOut;  // Defined in main.cpp
+
+static const char kochOrder[] = KOCH_ORDER;
+static STATS_SUMMARY sum;
+static STATS_RECORD batch[STATS_BATCH];
+static int batched = 0;  // records in batch[] not yet written
+
+static int kochPlace(char c)  // place in KOCH_ORDER, -1 if not there
+{
+  const char *p = strchr(kochOrder, toupper(c));
+  return (c && p) ? p - kochOrder : -1;
+}
+
+static void count(const STATS_RECORD *r)  // add a record to the totals
+{
+  int i = kochPlace(r->ch);
+  if (i < 0) return;
+  sum.total[i].tries++;
+  if (r->wpm & STATS_RIGHT)
+    sum.total[i].ms += r->time * STATS_TICK;
+  else
+    sum.total[i].misses++;
+}
+
+static void resetTotals(void) {
+  memset(&sum, 0, sizeof(sum));
+  sum.magic = STATS_MAGIC;
+}
+
+// Count the records after those the saved totals cover
+static void catchUp(void) {
+  STATS_RECORD r[STATS_DUMP];
+  File f = store().exists(STATS_LOG) ? store().open(STATS_LOG) : File();
+  if (!f) {
+    if (sum.records) resetTotals();  // log deleted
+    return;
+  }
+  uint32_t logged = f.size() / sizeof(STATS_RECORD);
+  if (logged < sum.records) {  // log replaced: start again
+    resetTotals();
+    Serial.println("Stats: rebuilding totals from " STATS_LOG);
+  }
+  f.seek(sum.records * sizeof(STATS_RECORD));
+  while (sum.records < logged) {
+    int n = f.read((uint8_t *)r, sizeof(r)) / sizeof(STATS_RECORD);
+    if (n <= 0) break;
+    for (int i = 0; i < n; i++) count(&r[i]);
+    sum.records += n;
+  }
+  f.close();
+}
+
+void statsBegin(void)  // load the totals & start adaptive Koch from them
+{
+  resetTotals();
+  batched = 0;
+  File f = store().open(STATS_SUM);
+  if (f) {
+    if (f.read((uint8_t *)&sum, sizeof(sum)) != sizeof(sum) ||
+        sum.magic != STATS_MAGIC)
+      resetTotals();
+    f.close();
+  }
+  catchUp();
+  for (int i = 0; i < WORDLIST_LEVELS; i++) {
+    STATS_TOTAL *t = &sum.total[i];
+    uint32_t right = t->tries - t->misses;
+    adaptSeed(i, t->tries, t->misses, right ? t->ms / right : 0);
+  }
+}
+
+void statsAdd(char c, int mode, int wpm, bool correct, unsigned int ms) {
+  STATS_RECORD *r = &batch[batched++];
+  r->ch = c;
+  r->mode = mode;
+  r->wpm = (wpm & ~STATS_RIGHT) | (correct ? STATS_RIGHT : 0);
+  ms = (ms + STATS_TICK / 2) / STATS_TICK;
+  r->time = (ms > 255) ? 255 : ms;
+  count(r);
+  if (batched >= STATS_BATCH) statsFlush();
+}
+
+void statsFlush(void)  // append waiting records, then save the totals
+{
+  if (!batched) return;
+  int n = batched;
+  batched = 0;
+  if (storeKind() == STORE_NONE) return;  // totals kept until power off
+  size_t want = n * sizeof(STATS_RECORD), wrote = 0;
+  File f = store().open(STATS_LOG, FILE_APPEND);
+  if (f) {
+    uint8_t pad[sizeof(STATS_RECORD)] = {0};
+    size_t torn = f.size() % sizeof(pad);
+    if (!torn || f.write(pad, sizeof(pad) - torn) == sizeof(pad) - torn) {
+      if (torn) sum.records++;  // skip the record cut short
+      wrote = f.write((uint8_t *)batch, want);
+    }
+    f.close();
+  }
+  sum.records += wrote / sizeof(STATS_RECORD);  // whole ones that got there
+  if (wrote != want) {
+    Serial.println("Stats: cannot write " STATS_LOG);
+    return;
+  }
+  f = store().open(STATS_SUM, FILE_WRITE);
+  if (f) {
+    f.write((uint8_t *)&sum, sizeof(sum));
+    f.close();
+  }
+}
+
+void statsPrint(void)  // totals by character, in Koch order
+{
+  uint32_t tries = 0, misses = 0;
+  cliOut->println("Char  Tries  Miss%  Avg mS");
+  for (int i = 0; i < WORDLIST_LEVELS; i++) {
+    STATS_TOTAL *t = &sum.total[i];
+    if (!t->tries) continue;
+    uint32_t right = t->tries - t->misses;
+    char s[40];
+    sprintf(s, "  %c  %6lu  %5lu  %6lu", kochOrder[i], (unsigned long)t->tries,
+            (unsigned long)(t->misses * 100 / t->tries),
+            (unsigned long)(right ? t->ms / right : 0));
+    cliOut->println(s);
+    tries += t->tries;
+    misses += t->misses;
+  }
+  cliOut->print("Answers: ");
+  cliOut->print(tries);
+  cliOut->print(" missed: ");
+  cliOut->print(misses);
+  cliOut->print(" logged: ");
+  cliOut->println(sum.records + batched);
+}
+
+void statsDump(void)  // every record, as CSV
+{
+  STATS_RECORD r[STATS_DUMP];
+  char s[40];
+  statsFlush();
+  cliOut->println("char,mode,wpm,correct,ms");
+  File f = store().open(STATS_LOG);
+  if (!f) return;
+  int n;
+  while ((n = f.read((uint8_t *)r, sizeof(r)) / sizeof(STATS_RECORD)) > 0)
+    for (int i = 0; i < n; i++) {
+      sprintf(s, "%c,%d,%d,%d,%d", r[i].ch, r[i].mode,
+              r[i].wpm & ~STATS_RIGHT, (r[i].wpm & STATS_RIGHT) ? 1 : 0,
+              r[i].time * STATS_TICK);
+      cliOut->println(s);
+    }
+  f.close();
+}
+
+void statsErase(void)  // forget everything, adaptive weights too
+{
+  store().remove(STATS_LOG);
+  store().remove(STATS_SUM);
+  resetTotals();
+  batched = 0;
+  adaptReset();
+}
@@ -0,0 +1,53 @@
+#ifndef _STATLOG_H_
+#define _STATLOG_H_
+
+#include <Arduino.h>
+#include "main.h"
+#include "wordlist.h"
+
+//===================================  Statistics Log Constants
+//==========================
+// Every character answered in a copy mode is logged as a STATS_RECORD of
+// four bytes.  Records are kept in RAM and appended to STATS_LOG in the
+// content store STATS_BATCH at a time, and when an activity ends.  Totals
+// per Koch character are kept up to date as records are added, and saved
+// to STATS_SUM after each batch together with the number of records they
+// cover.  Querying them never reads the log.  At power up, any records the
+// totals missed are added in and the adaptive Koch weights are started
+// from the totals.
+#define STATS_LOG "/_STATLOG.MTL"  // hidden from the SD card library
+#define STATS_SUM "/_STATSUM.MTL"
+#define STATS_MAGIC 0x3153544DUL   // "MTS1"
+#define STATS_BATCH 32             // records held before writing
+#define STATS_TICK 20              // mS per unit of logged hesitation
+#define STATS_RIGHT 0x80           // set in wpm if copied correctly
+#define STATS_DUMP 64              // records read at a time for the CLI
+
+typedef struct {
+  uint8_t ch;    // character asked
+  uint8_t mode;  // menu selection it was asked in, e.g. 11 = Copy One
+  uint8_t wpm;   // character speed, | STATS_RIGHT if copied correctly
+  uint8_t time;  // hesitation before keying it, STATS_TICK mS (255 = more)
+} STATS_RECORD;
+
+typedef struct {
+  uint32_t tries;   // answers
+  uint32_t misses;  // wrong or missing
+  uint32_t ms;      // hesitation before the right ones, summed
+} STATS_TOTAL;
+
+typedef struct {
+  uint32_t magic;                      // STATS_MAGIC
+  uint32_t records;                    // records in STATS_LOG counted
+  STATS_TOTAL total[WORDLIST_LEVELS];  // by place in KOCH_ORDER
+} STATS_SUMMARY;
+
+// Function Prototypes
+void statsBegin(void);
+void statsAdd(char c, int mode, int wpm, bool correct, unsigned int ms);
+void statsFlush(void);
+void statsPrint(void);
+void statsDump(void);
+void statsErase(void);
+
+#endif  // _STATLOG_H_
@@ -0,0 +1,47 @@
+/*
+
+  Content store: the SD card, or LittleFS in flash when there is no card.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+#include <SD.h>
+#include <SPI.h>
+
+#include "main.h"
+#include "storage.h"
+
+int storeType = STORE_NONE;
+fs::FS *storeFS = &SD;  // SD until storeBegin() finds otherwise
+
+int storeBegin(void)  // mount the card, or the flash partition without one
+{
+  delay(200);  // dont rush things on power-up
+  if (SD.begin(SD_CS, SPI, SD_FREQ, "/sd", STORE_MAX_FILES) &&
+      SD.cardType() != CARD_NONE) {
+    storeType = STORE_SD;
+    storeFS = &SD;
+    delay(100);  // takin' it easy
+  } else if (LittleFS.begin(STORE_FORMAT, "/littlefs", STORE_MAX_FILES,
+                            STORE_LABEL)) {
+    storeType = STORE_FLASH;
+    storeFS = &LittleFS;
+  } else {
+    Serial.println("Store: no SD card and no flash partition");
+    storeType = STORE_NONE;
+  }
+  return storeType;
+}
+
+fs::FS &store(void) { return *storeFS; }
+
+int storeKind(void) { return storeType; }
+
+const char *storeName(void) {
+  return storeType == STORE_FLASH ? "flash" : "card";
+}
@@ -0,0 +1,33 @@
+#ifndef _STORAGE_H_
+#define _STORAGE_H_
+
+#include <Arduino.h>
+#include <FS.h>
+#include "main.h"
+
+//===================================  Content Store Constants
+//===========================
+// Texts, playlists, bookmarks and indexes are kept on the SD card if one is
+// fitted, otherwise on a LittleFS partition in the ESP32's own flash: the
+// "spiffs" partition of the partition table the firmware was built with
+// (see partitions/ and platformio.ini).  Everything that touches them goes
+// through store(), so the library, reader, bookmarks, navigation index and
+// playlists work the same on either.  Flash needs no card to start up and
+// does not share the SPI bus with the display.
+#define STORE_NONE 0          // storeKind(): nothing to read
+#define STORE_SD 1            //   SD card
+#define STORE_FLASH 2         //   LittleFS in flash
+#define STORE_LABEL "spiffs"  // partition holding the flash store
+#define STORE_FORMAT true     // format the partition if it has never been
+#define STORE_MAX_FILES 12    // files open at once: a folder index being
+                              // built needs four next to the reader's,
+                              // playlist's and navigation index's
+#define SD_FREQ 4000000       // SPI clock for the card, as SD.begin()'s default
+
+// Function Prototypes
+int storeBegin(void);
+fs::FS &store(void);
+int storeKind(void);
+const char *storeName(void);
+
+#endif  // _STORAGE_H_
@@ -0,0 +1,174 @@
+/*
+
+  Rate matched wireless file streaming.
+
+  The sender runs up to STREAM_AHEAD characters ahead of its own audio so that
+  receivers always have text queued, and throttles on the queue space that
+  receivers report so that nobody's receive queue overflows.  Receivers play
+  the text at their own speed; a slow receiver simply reports less space.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+
+#include "main.h"
+#include "network.h"
+#include "stream.h"
+
+extern PubSubClient client;     // Defined in network.cpp
+extern char localid[10];        // Defined in network.cpp
+extern QueueHandle_t rxQueue;   // Defined in network.cpp
+extern TUTOR_STRUT cfg;         // Defined in main.cpp
+
+typedef struct {
+  char id[4];
+  int credit;                // reported free space less chars sent since
+  unsigned long lastReport;  // millis() of last report, 0 = slot free
+} STREAM_PEER;
+
+STREAM_PEER peers[STREAM_PEERS];
+portMUX_TYPE streamMux = portMUX_INITIALIZER_UNLOCKED;
+char fileTopic[MAX_TOPIC_LEN];
+char flowTopic[MAX_TOPIC_LEN];        // our own reports arrive here
+char senderId[sizeof(peers[0].id)];   // who we are receiving from
+unsigned char chunkSeq = 0, expectSeq = 0;
+int bootstrap = STREAM_BOOTSTRAP;     // credit used before any report
+bool seekPending = false;             // next chunk starts after a jump
+unsigned long lastChunk = 0, lastReport = 0;
+unsigned long lastHeard = 0;          // millis() of last report from anyone
+int lastFree = -1;
+
+// Called by initWireless() once connected
+void initStream(void) {
+  memset(peers, 0, sizeof(peers));
+  snprintf(fileTopic, sizeof(fileTopic), "%s%s", cfg.room, FILE_SUFFIX);
+  snprintf(flowTopic, sizeof(flowTopic), "%s%s%s", cfg.room, FLOW_SUFFIX,
+           localid);
+  senderId[0] = 0;
+  bootstrap = STREAM_BOOTSTRAP;
+  seekPending = false;
+  lastChunk = lastReport = 0;
+  lastHeard = millis();
+  lastFree = -1;
+  client.subscribe(fileTopic);
+  client.subscribe(flowTopic);
+}
+
+// Called from MQTTcallback().  Returns true if the message was consumed.
+bool streamMessage(char *topic, byte *data, unsigned int len) {
+  char msg[MAX_PAYLOAD_LEN + 1], *id = msg, *p;
+
+  if (strcmp(topic, fileTopic) && strcmp(topic, flowTopic)) return false;
+  if (len > MAX_PAYLOAD_LEN) return true;
+  memcpy(msg, data, len);
+  msg[len] = 0;
+  p = strchr(msg, MQTT_DELIMETER);
+  if (p == NULL || p - msg >= (int)sizeof(senderId)) return true;
+  *p++ = 0;
+
+  if (!strcmp(topic, fileTopic)) {  // a chunk of someone's file
+    if (!strcmp(id, localid)) return true;  // our own chunk echoed back
+    char *text = strchr(p, MQTT_DELIMETER);
+    if (text == NULL) return true;
+    bool seek = (*p == 'S');  // sender jumped: drop what it sent before
+    unsigned char seq = atoi(seek ? p + 1 : p);
+    if (seek && !strcmp(id, senderId)) xQueueReset(rxQueue);
+    if (strcmp(id, senderId) || seq != expectSeq) {
+      if (senderId[0] && !strcmp(id, senderId)) Serial.println("Chunk lost");
+      strcpy(senderId, id);
+    }
+    expectSeq = seq + 1;
+    lastChunk = millis();
+    for (text++; *text; text++) enQueue(*text);
+    return true;
+  }
+
+  if (!strcmp(topic, flowTopic)) {  // a receiver reporting its queue space
+    int avail = atoi(p), slot = -1, unused = -1, oldest = 0;
+    portENTER_CRITICAL(&streamMux);
+    for (int i = 0; i < STREAM_PEERS && slot < 0; i++) {
+      if (!peers[i].lastReport) {
+        if (unused < 0) unused = i;
+      } else if (!strcmp(peers[i].id, id)) {
+        slot = i;  // known receiver
+      } else if (peers[i].lastReport < peers[oldest].lastReport) {
+        oldest = i;
+      }
+    }
+    if (slot < 0) slot = (unused >= 0) ? unused : oldest;
+    strcpy(peers[slot].id, id);
+    peers[slot].credit = avail;
+    peers[slot].lastReport = lastHeard = millis();
+    portEXIT_CRITICAL(&streamMux);
+    return true;
+  }
+  return false;
+}
+
+// Called from netTask().  While a stream is arriving, report receive queue
+// space to its sender when it changes noticeably or every STREAM_REPORT_MS.
+void streamPoll(void) {
+  char msg[16], topic[MAX_TOPIC_LEN];
+  unsigned long now = millis();
+  if (!senderId[0] || (now - lastChunk > STREAM_IDLE)) return;
+  int avail = uxQueueSpacesAvailable(rxQueue);
+  if ((abs(avail - lastFree) < STREAM_REPORT_DELTA) &&
+      (now - lastReport < STREAM_REPORT_MS))
+    return;
+  lastFree = avail;
+  lastReport = now;
+  snprintf(topic, sizeof(topic), "%s%s%s", cfg.room, FLOW_SUFFIX, senderId);
+  snprintf(msg, sizeof(msg), "%s:%d", localid, avail);
+  client.publish(topic, (const uint8_t *)msg, strlen(msg));
+}
+
+// True if every receiver heard from recently has room for len more characters.
+// One chunk is held back for text that was in flight when a report was made.
+// With nobody reporting, the sender is paced by its own audio alone.
+bool streamCanSend(int len) {
+  bool known = false, ok = true;
+  unsigned long now = millis();
+  portENTER_CRITICAL(&streamMux);
+  for (int i = 0; i < STREAM_PEERS; i++) {
+    if (!peers[i].lastReport) continue;
+    if (now - peers[i].lastReport > STREAM_PEER_TIMEOUT) {
+      peers[i].lastReport = 0;  // receiver left or stopped playing
+      continue;
+    }
+    known = true;
+    if (peers[i].credit - STREAM_CHUNK < len) ok = false;
+  }
+  portEXIT_CRITICAL(&streamMux);
+  if (known) return ok;
+  return (bootstrap >= len) || (now - lastHeard > STREAM_PEER_TIMEOUT);
+}
+
+// Publish a chunk and charge it against every receiver's credit.  False if
+// it could not be queued: the caller keeps it to try again.
+bool streamChunk(char *text, int len) {
+  char msg[MAX_PAYLOAD_LEN];
+  int n = snprintf(msg, sizeof(msg), "%s:%s%u:", localid,
+                   seekPending ? "S" : "", chunkSeq);
+  if (len > (int)sizeof(msg) - n) len = sizeof(msg) - n;
+  memcpy(msg + n, text, len);
+  if (!netPublish(fileTopic, msg, n + len, false)) return false;
+  seekPending = false;
+  chunkSeq++;
+  bootstrap -= len;
+  portENTER_CRITICAL(&streamMux);
+  for (int i = 0; i < STREAM_PEERS; i++)
+    if (peers[i].lastReport) peers[i].credit -= len;
+  portEXIT_CRITICAL(&streamMux);
+  return true;
+}
+
+// The sender skipped or jumped: tell receivers straight away to drop the
+// text they hold, or with the next chunk if the marker cannot go now
+bool streamSeek(void) {
+  seekPending = true;
+  return streamChunk((char *)"", 0);
+}
@@ -0,0 +1,41 @@
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+
+#include <Arduino.h>
+#include "main.h"
+
+//===================================  Telemetry Constants
+//===============================
+// Health samples are taken every TELEMETRY_SAMPLE_MS and published in batches
+// of up to TELEMETRY_BATCH records as one binary message on
+// "metrics/<call>-<mac>".  A batch is only sent when the outbound queue is
+// empty so it never delays two-way traffic.
+#define METRICS_PREFIX "metrics/"
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_SAMPLE_MS 60000   // mS between health samples
+#define TELEMETRY_BATCH 4           // samples per published message
+#define TELEMETRY_MIN_GAP 240000    // mS minimum between publishes
+
+// One health sample, little-endian, 34 bytes on the wire
+typedef struct __attribute__((packed)) {
+  uint8_t version;       // TELEMETRY_VERSION
+  int8_t mode;           // menu selection being run, -1 = in menus
+  uint32_t uptime;       // seconds since boot
+  uint32_t freeHeap;     // bytes
+  uint32_t minHeap;      // lowest free heap since boot, bytes
+  uint32_t rxDrops;      // received characters lost to a full queue
+  uint32_t txDrops;      // outbound messages lost to a full queue
+  uint16_t connects;     // successful initWireless() since boot
+  uint16_t connectFails; // failed initWireless() since boot
+  uint16_t elements;     // dits and dahs timed since last sample
+  int16_t meanError;     // mean keydown length error, uS (+ = too long)
+  uint16_t maxError;     // worst absolute keydown error, uS
+  uint16_t rtt;          // average round trip to the room, mS (0 = none)
+} TELEMETRY;
+
+// Function Prototypes
+void noteElement(int intendedMs, unsigned long actualUs);
+void noteConnect(bool ok);
+void telemetryPoll(void);
+
+#endif  // _TELEMETRY_H_
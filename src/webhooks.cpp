@@ -0,0 +1,121 @@
+/*
+
+  Tutor side of the web server: status, settings and mode changes.
+
+  webPoll() runs in netTask(), so these hooks must not draw on the screen or
+  wait on the user.  Mode changes are handed to loop() through webSelection
+  and a simulated button press.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include "UART.h"
+#include "main.h"
+#include "network.h"
+#include "latency.h"
+#include "remotecli.h"
+#include "webserver.h"
+
+extern TUTOR_STRUT cfg;                  // Defined in main.cpp
+extern char myCall[MAX_CALLSIGN_STRING]; // Defined in main.cpp
+extern int charSpeed, codeSpeed, activity;  // Defined in main.cpp
+extern volatile boolean button_pressed;  // Defined in main.cpp
+extern Print *cliOut;                    // Defined in main.cpp
+extern bool cliActive;                   // Defined in main.cpp
+
+volatile int webSelection = -2;  // menu selection asked for, -2 = none
+
+// CLI output collected for one reply
+class TextBuffer : public Print {
+ public:
+  TextBuffer(char *buf, int size) : buf(buf), size(size), len(0) { *buf = 0; }
+  size_t write(uint8_t ch) {
+    if (len >= size - 1) return 0;
+    buf[len++] = ch;
+    buf[len] = 0;
+    return 1;
+  }
+  using Print::write;
+
+ private:
+  char *buf;
+  int size, len;
+};
+
+bool webNetworkUp(void) { return WiFi.status() == WL_CONNECTED; }
+
+unsigned long webMillis(void) { return millis(); }
+
+void webStatus(char *json, int size) {
+  snprintf(json, size,
+           "{\"call\":\"%s\",\"room\":\"%s\",\"wpm\":%d,\"fwpm\":%d,"
+           "\"mode\":%d,\"connected\":%s,\"rtt\":%u}",
+           myCall, cfg.room, charSpeed, codeSpeed, activity,
+           (cfg.conflag & SRV_CONNECTED) ? "true" : "false", pingAverage());
+}
+
+// Random hex challenge for a browser to sign with the CLI key
+void webChallenge(char *challenge, int size) {
+  int i;
+  for (i = 0; i < size - 1; i++)
+    challenge[i] = "0123456789abcdef"[esp_random() & 15];
+  challenge[i] = 0;
+}
+
+// Same key as the remote CLI; no key means no web control.  The browser
+// proves it has the key by signing our challenge.
+bool webAuthorize(const char *challenge, const char *mac) {
+#ifndef REMOVE_CLI
+  char text[WEB_CHALLENGE_LEN + 8], expect[2 * HMAC_BYTES + 1];
+  unsigned char diff = 0;
+  if (!cfg.cli_key[0] || strlen(mac) != 2 * HMAC_BYTES) return false;
+  int n = snprintf(text, sizeof(text), "web:%s", challenge);
+  if (!keyMac(text, n, expect)) return false;
+  for (int i = 0; i < 2 * HMAC_BYTES; i++) diff |= mac[i] ^ expect[i];
+  return !diff;
+#else
+  return false;
+#endif
+}
+
+void webConfig(const char *command, char *reply, int size) {
+#ifndef REMOVE_CLI
+  char cmd[RBUFF];
+  TextBuffer out(reply, size);
+  strncpy(cmd, command, sizeof(cmd) - 1);
+  cmd[sizeof(cmd) - 1] = 0;
+  if (!remoteAllowed(cmd)) {  // same list as the remote CLI
+    snprintf(reply, size, "Not allowed from the web");
+    return;
+  }
+  if (cliActive) {  // serial CLI owns the command buffers
+    snprintf(reply, size, "Serial CLI in use");
+    return;
+  }
+  cliOut = &out;
+  executeSerial(cmd);
+  cliOut = &Serial;
+#else
+  snprintf(reply, size, "CLI Not Implemented");
+#endif
+}
+
+// Leave the current activity and start another (-1 = menus)
+bool webMode(int selection) {
+  if (!validSelection(selection)) return false;
+  webSelection = selection;
+  button_pressed = true;  // as if the encoder button had been pushed
+  return true;
+}
+
+// Menu selection asked for by a browser, or -2 if none
+int takeWebMode(void) {
+  int selection = webSelection;
+  webSelection = -2;
+  return selection;
+}
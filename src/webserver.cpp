@@ -0,0 +1,578 @@
+/*
+
+  Small HTTP and WebSocket server for live text, configuration and control.
+
+  Written against BSD sockets so the same file runs on lwIP on the ESP32 and
+  on Linux for testing.  Everything is polled and non-blocking from one task,
+  with a fixed slot per client, so memory use is known at compile time.
+  Characters reach the browser as soon as webPoll() next runs; nothing on the
+  page polls the unit.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#include <lwip/sockets.h>
+#else
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+
+#include "webserver.h"
+
+#define WEB_GUID "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"  // RFC 6455
+
+enum { WEB_FREE, WEB_HTTP, WEB_SOCKET, WEB_CLOSING };
+
+typedef struct {
+  int fd;
+  unsigned char state;
+  bool authed;               // may use cli: and mode:
+  char challenge[WEB_CHALLENGE_LEN];  // answered by the next auth:
+  int rxLen, txLen;
+  const char *body;          // static body still to send after tx[]
+  int bodyLen;
+  unsigned long lastActive;  // webMillis() of last input
+  char rx[WEB_RX_BUF];
+  char tx[WEB_TX_BUF];
+} WEB_CLIENT;
+
+static const char WEB_PAGE[] =
+    "<!DOCTYPE html><html><head><meta name=viewport "
+    "content='width=device-width'><title>Morse Tutor</title><style>"
+    "body{font-family:monospace;background:#000;color:#0ff}"
+    "#t{white-space:pre-wrap;border:1px solid #066;min-height:12em;padding:4px}"
+    ".r{color:#0f0}.i{color:#fff}input{width:60%}</style></head><body>"
+    "<div id=s>connecting</div><div id=t></div>"
+    "<p><input id=x placeholder='text to send'><button onclick=S()>Send"
+    "</button></p><p><input id=k type=password placeholder='CLI key'>"
+    "<button onclick=A()>Unlock</button></p><p><input id=c "
+    "placeholder='CLI command, e.g. R MYROOM'><button onclick=C()>Run</button>"
+    " <input id=m size=3 style=width:4em placeholder=17><button onclick=M()>"
+    "Mode</button></p><pre id=p></pre><script>"
+    "var w,q,t=document.getElementById('t'),p=document.getElementById('p');"
+    "function v(i){return document.getElementById(i).value}"
+    "function o(){w=new WebSocket('ws://'+location.host+'/ws');"
+    "w.onclose=function(){setTimeout(o,2000)};w.onmessage=function(e){"
+    "var d=JSON.parse(e.data);if(d.status){document.getElementById('s')"
+    ".textContent=JSON.stringify(d.status);return}if(d.reply!=null||d.error)"
+    "{p.textContent=d.reply!=null?d.reply:'error: '+d.error;return}"
+    "if(d.challenge){q=d.challenge;return}"
+    "for(var k in d){var n=document.createElement('span');n.className=k;"
+    "n.textContent=d[k];t.appendChild(n)}"
+    "if(t.textContent.length>4000)t.removeChild(t.firstChild)}}"
+    "function S(){w.send('send:'+v('x')+' ');document.getElementById('x')"
+    ".value=''}function A(){w.send('auth:'+Q(v('k'),'web:'+q))}"
+    "function C(){w.send('cli:'+v('c'))}function M(){w.send('mode:'+v('m'))}"
+    "function H(m){var K=[],h=[],w=[],i,j,n,s,e,a,t,u,l=m.length*8,r=function"
+    "(x,n){return x>>>n|x<<32-n};for(i=2,n=0;n<64;i++){for(j=2;i%j;j++);if(j="
+    "=i){if(n<8)h[n]=Math.pow(i,.5)*4294967296|0;K[n++]=Math.pow(i,1/3)*42949"
+    "67296|0}}m=m.concat(128);while(m.length%64-56)m.push(0);m.push(0,0,0,0,l"
+    ">>>24,l>>16&255,l>>8&255,l&255);for(i=0;i<m.length;i+=64){for(j=0;j<64;j"
+    "++)if(j<16)w[j]=m[i+4*j]<<24|m[i+4*j+1]<<16|m[i+4*j+2]<<8|m[i+4*j+3];els"
+    "e{a=w[j-15];t=w[j-2];w[j]=w[j-16]+(r(a,7)^r(a,18)^a>>>3)+w[j-7]+(r(t,17)"
+    "^r(t,19)^t>>>10)|0}s=h.slice();for(j=0;j<64;j++){e=s[4];a=s[0];t=s[7]+(r"
+    "(e,6)^r(e,11)^r(e,25))+(e&s[5]^~e&s[6])+K[j]+w[j];u=(r(a,2)^r(a,13)^r(a,"
+    "22))+(a&s[1]^a&s[2]^s[1]&s[2]);s.pop();s.unshift(t+u|0);s[4]=s[4]+t|0}fo"
+    "r(j=0;j<8;j++)h[j]=h[j]+s[j]|0}for(i=0,s=[];i<32;i++)s[i]=h[i>>2]>>>24-8"
+    "*(i&3)&255;return s}function B(s){return Array.from(new TextEncoder().en"
+    "code(s))}function Q(k,m){var i,x=[],y=[];k=B(k);if(k.length>64)k=H(k);fo"
+    "r(i=0;i<64;i++){x[i]=k[i]^54;y[i]=k[i]^92}return H(y.concat(H(x.concat(B"
+    "(m))))).map(function(b){return(b<16?'0':'')+b.toString(16)}).join('')}"
+    "o()</script></body></html>";
+
+static WEB_CLIENT web[WEB_CLIENTS];
+static int listener = -1;
+
+// Character events: webEvent() (tutor) is the only writer of evHead and
+// webPoll() the only writer of evTail, so no lock is needed
+static char evType[WEB_EVENTS], evChar[WEB_EVENTS];
+static unsigned int evHead = 0, evTail = 0;
+
+// Browser text: webPoll() writes textHead, webText() (tutor) writes textTail
+static char textRing[WEB_TEXT];
+static unsigned int textHead = 0, textTail = 0;
+
+static char lastStatus[WEB_STATUS_LEN];
+static unsigned long lastStatusCheck = 0;
+
+//===================================  SHA-1 and Base64
+// Only used for the WebSocket handshake (RFC 6455 section 4.2.2)
+
+static uint32_t rol(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+
+static void sha1(const unsigned char *data, int len, unsigned char *digest) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  unsigned char block[64];
+  uint32_t w[80];
+  int total = ((len + 8) / 64 + 1) * 64;  // message, 0x80, length, padded
+
+  for (int off = 0; off < total; off += 64) {
+    for (int i = 0; i < 64; i++) {
+      int n = off + i;
+      if (n < len)
+        block[i] = data[n];
+      else if (n == len)
+        block[i] = 0x80;
+      else if (n >= total - 8)
+        block[i] = (uint64_t)len * 8 >> (8 * (total - 1 - n));
+      else
+        block[i] = 0;
+    }
+    for (int i = 0; i < 16; i++)
+      w[i] = (uint32_t)block[4 * i] << 24 | block[4 * i + 1] << 16 |
+             block[4 * i + 2] << 8 | block[4 * i + 3];
+    for (int i = 16; i < 80; i++)
+      w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f, k;
+    for (int i = 0; i < 80; i++) {
+      if (i < 20) {
+        f = (b & c) | (~b & d);
+        k = 0x5A827999;
+      } else if (i < 40) {
+        f = b ^ c ^ d;
+        k = 0x6ED9EBA1;
+      } else if (i < 60) {
+        f = (b & c) | (b & d) | (c & d);
+        k = 0x8F1BBCDC;
+      } else {
+        f = b ^ c ^ d;
+        k = 0xCA62C1D6;
+      }
+      uint32_t temp = rol(a, 5) + f + e + k + w[i];
+      e = d;
+      d = c;
+      c = rol(b, 30);
+      b = a;
+      a = temp;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+  }
+  for (int i = 0; i < 20; i++) digest[i] = h[i / 4] >> (24 - 8 * (i % 4));
+}
+
+static void base64(const unsigned char *in, int len, char *out) {
+  static const char table[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  for (int i = 0; i < len; i += 3) {
+    uint32_t n = in[i] << 16;
+    if (i + 1 < len) n |= in[i + 1] << 8;
+    if (i + 2 < len) n |= in[i + 2];
+    *out++ = table[(n >> 18) & 63];
+    *out++ = table[(n >> 12) & 63];
+    *out++ = (i + 1 < len) ? table[(n >> 6) & 63] : '=';
+    *out++ = (i + 2 < len) ? table[n & 63] : '=';
+  }
+  *out = 0;
+}
+
+//===================================  Client Output
+
+static void webDrop(WEB_CLIENT *c) {
+  close(c->fd);
+  c->fd = -1;
+  c->state = WEB_FREE;
+}
+
+// Queue output.  A client whose buffer is full is too slow and is dropped
+// rather than holding up the tutor.
+static bool webWrite(WEB_CLIENT *c, const char *data, int len) {
+  if (c->txLen + len > WEB_TX_BUF) {
+    webDrop(c);
+    return false;
+  }
+  memcpy(c->tx + c->txLen, data, len);
+  c->txLen += len;
+  return true;
+}
+
+static void webFrame(WEB_CLIENT *c, int opcode, const char *data, int len) {
+  char hdr[4];
+  int n = 0;
+  hdr[n++] = 0x80 | opcode;  // FIN, unmasked
+  if (len < 126) {
+    hdr[n++] = len;
+  } else {
+    hdr[n++] = 126;
+    hdr[n++] = len >> 8;
+    hdr[n++] = len & 0xFF;
+  }
+  if (c->txLen + n + len > WEB_TX_BUF) {
+    webDrop(c);
+    return;
+  }
+  webWrite(c, hdr, n);
+  webWrite(c, data, len);
+}
+
+// Send {"key":"text"} with text escaped for JSON.  msg[] is static, as are
+// the other large buffers here: webPoll() is only ever run by one task and
+// that task's stack also has to hold the CLI when a command is run.
+static void webJson(WEB_CLIENT *c, const char *key, const char *text) {
+  static char msg[WEB_RX_BUF];
+  int n = snprintf(msg, sizeof(msg), "{\"%s\":\"", key);
+  for (; *text && n < (int)sizeof(msg) - 4; text++) {
+    if (*text == '"' || *text == '\\') {
+      msg[n++] = '\\';
+      msg[n++] = *text;
+    } else if (*text == '\n') {
+      msg[n++] = '\\';
+      msg[n++] = 'n';
+    } else if ((unsigned char)*text >= ' ') {
+      msg[n++] = *text;
+    }
+  }
+  msg[n++] = '"';
+  msg[n++] = '}';
+  webFrame(c, 1, msg, n);
+}
+
+static void webReply(WEB_CLIENT *c, const char *status, const char *type,
+                     const char *body, int len) {
+  char hdr[160];
+  int n = snprintf(hdr, sizeof(hdr),
+                   "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %d\r\n"
+                   "Cache-Control: no-store\r\nConnection: close\r\n\r\n",
+                   status, type, len);
+  if (!webWrite(c, hdr, n)) return;
+  if (len <= WEB_TX_BUF / 2) {  // small bodies are copied
+    if (!webWrite(c, body, len)) return;
+  } else {  // the page is sent straight from flash once the header is out
+    c->body = body;
+    c->bodyLen = len;
+  }
+  c->state = WEB_CLOSING;
+}
+
+static void webFlush(WEB_CLIENT *c) {
+  int n;
+  if (c->txLen) {
+    n = send(c->fd, c->tx, c->txLen, MSG_DONTWAIT);
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+      webDrop(c);
+      return;
+    }
+    if (n > 0) {
+      memmove(c->tx, c->tx + n, c->txLen - n);
+      c->txLen -= n;
+    }
+  }
+  if (!c->txLen && c->bodyLen) {
+    n = send(c->fd, c->body, c->bodyLen, MSG_DONTWAIT);
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+      webDrop(c);
+      return;
+    }
+    if (n > 0) {
+      c->body += n;
+      c->bodyLen -= n;
+    }
+  }
+  if (c->state == WEB_CLOSING && !c->txLen && !c->bodyLen) webDrop(c);
+}
+
+//===================================  Requests
+
+// Value of header name in the request, or NULL.  Terminates the value.
+static char *webHeader(char *headers, const char *name) {
+  int len = strlen(name);
+  for (char *p = strstr(headers, "\r\n"); p; p = strstr(p, "\r\n")) {
+    p += 2;
+    if (strncasecmp(p, name, len) || p[len] != ':') continue;
+    p += len + 1;
+    while (*p == ' ') p++;
+    char *end = strstr(p, "\r\n");
+    if (end) *end = 0;
+    return p;
+  }
+  return NULL;
+}
+
+// Each challenge answers one auth: attempt, so a reply seen on the network
+// cannot be used again
+static void webNewChallenge(WEB_CLIENT *c) {
+  webChallenge(c->challenge, sizeof(c->challenge));
+  webJson(c, "challenge", c->challenge);
+}
+
+static void webUpgrade(WEB_CLIENT *c, char *headers) {
+  char hdr[160], accept[32], *key = webHeader(headers, "Sec-WebSocket-Key");
+  unsigned char digest[20], joined[64 + sizeof(WEB_GUID)];
+  if (!key || strlen(key) > 64) {
+    webReply(c, "400 Bad Request", "text/plain", "\n", 1);
+    return;
+  }
+  int n = snprintf((char *)joined, sizeof(joined), "%s%s", key, WEB_GUID);
+  sha1(joined, n, digest);
+  base64(digest, sizeof(digest), accept);
+  n = snprintf(hdr, sizeof(hdr),
+               "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+               "Connection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n",
+               accept);
+  if (!webWrite(c, hdr, n)) return;
+  c->state = WEB_SOCKET;
+  c->authed = false;
+  if (lastStatus[0]) webFrame(c, 1, lastStatus, strlen(lastStatus));
+  webNewChallenge(c);
+}
+
+static void webRequest(WEB_CLIENT *c) {
+  char *path = c->rx + 4, *end;
+  c->rx[c->rxLen] = 0;
+  if (strncmp(c->rx, "GET ", 4) || !(end = strchr(path, ' '))) {
+    webReply(c, "405 Method Not Allowed", "text/plain", "GET only\n", 9);
+    return;
+  }
+  *end = 0;
+  c->rxLen = 0;
+  if (!strcmp(path, "/")) {
+    webReply(c, "200 OK", "text/html", WEB_PAGE, sizeof(WEB_PAGE) - 1);
+  } else if (!strcmp(path, "/status")) {
+    static char status[WEB_STATUS_LEN];
+    webStatus(status, sizeof(status));
+    webReply(c, "200 OK", "application/json", status, strlen(status));
+  } else if (!strcmp(path, "/ws")) {
+    webUpgrade(c, end + 1);
+  } else {
+    webReply(c, "404 Not Found", "text/plain", "Not found\n", 10);
+  }
+}
+
+static void webMessage(WEB_CLIENT *c, char *text) {
+  static char reply[WEB_RX_BUF - 32];
+  if (!strncmp(text, "send:", 5)) {
+    for (text += 5; *text; text++) {
+      unsigned int head = textHead;
+      if (head - __atomic_load_n(&textTail, __ATOMIC_ACQUIRE) >= WEB_TEXT)
+        break;  // tutor is not taking text; drop the rest
+      textRing[head % WEB_TEXT] = *text;
+      __atomic_store_n(&textHead, head + 1, __ATOMIC_RELEASE);
+    }
+  } else if (!strncmp(text, "auth:", 5)) {
+    c->authed = webAuthorize(c->challenge, text + 5);
+    if (c->authed)
+      webJson(c, "reply", "unlocked");
+    else
+      webJson(c, "error", "auth");
+    if (c->state == WEB_SOCKET) webNewChallenge(c);
+  } else if (!c->authed) {
+    webJson(c, "error", "locked");
+  } else if (!strncmp(text, "cli:", 4)) {
+    webConfig(text + 4, reply, sizeof(reply));
+    webJson(c, "reply", reply);
+  } else if (!strncmp(text, "mode:", 5)) {
+    if (webMode(atoi(text + 5)))
+      webJson(c, "reply", "ok");
+    else
+      webJson(c, "error", "mode");
+  } else {
+    webJson(c, "error", "unknown");
+  }
+}
+
+// Handle complete frames in rx[].  Clients must mask; lengths that do not
+// fit in rx[] close the connection.
+static void webFrames(WEB_CLIENT *c) {
+  while (c->state == WEB_SOCKET && c->rxLen >= 2) {
+    unsigned char *b = (unsigned char *)c->rx;
+    int opcode = b[0] & 0x0F, len = b[1] & 0x7F, hdr = 2;
+    if (!(b[1] & 0x80) || len == 127) {
+      webDrop(c);
+      return;
+    }
+    if (len == 126) {
+      if (c->rxLen < 4) return;
+      len = b[2] << 8 | b[3];
+      hdr = 4;
+    }
+    if (hdr + 4 + len >= WEB_RX_BUF) {
+      webDrop(c);
+      return;
+    }
+    if (c->rxLen < hdr + 4 + len) return;  // wait for the rest
+    char *payload = c->rx + hdr + 4;
+    for (int i = 0; i < len; i++) payload[i] ^= b[hdr + (i & 3)];
+    char next = payload[len];
+    payload[len] = 0;
+    if (opcode == 1 && (b[0] & 0x80)) {
+      webMessage(c, payload);
+    } else if (opcode == 8) {
+      webFrame(c, 8, "", 0);
+      if (c->state == WEB_SOCKET) c->state = WEB_CLOSING;
+    } else if (opcode == 9) {
+      webFrame(c, 10, payload, len);  // pong
+    }
+    if (c->state == WEB_FREE) return;
+    payload[len] = next;
+    c->rxLen -= hdr + 4 + len;
+    memmove(c->rx, payload + len, c->rxLen);
+  }
+}
+
+static void webRead(WEB_CLIENT *c) {
+  int n = recv(c->fd, c->rx + c->rxLen, WEB_RX_BUF - 1 - c->rxLen, MSG_DONTWAIT);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+    webDrop(c);  // closed by browser
+    return;
+  }
+  if (n < 0) return;
+  c->rxLen += n;
+  c->lastActive = webMillis();
+  if (c->state == WEB_CLOSING) c->rxLen = 0;  // answered; ignore the rest
+  if (c->state == WEB_SOCKET) {
+    webFrames(c);
+  } else if (c->state == WEB_HTTP) {
+    c->rx[c->rxLen] = 0;
+    if (strstr(c->rx, "\r\n\r\n"))
+      webRequest(c);
+    else if (c->rxLen >= WEB_RX_BUF - 1)
+      webDrop(c);  // headers too long
+  }
+}
+
+//===================================  Server
+
+static bool webListen(void) {
+  struct sockaddr_in addr;
+  int one = 1;
+  listener = socket(AF_INET, SOCK_STREAM, 0);
+  if (listener < 0) return false;
+  setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(WEB_PORT);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(listener, (struct sockaddr *)&addr, sizeof(addr)) ||
+      listen(listener, WEB_CLIENTS)) {
+    close(listener);
+    listener = -1;
+    return false;
+  }
+  fcntl(listener, F_SETFL, O_NONBLOCK);
+  for (int i = 0; i < WEB_CLIENTS; i++) web[i].state = WEB_FREE;
+  return true;
+}
+
+static void webAccept(void) {
+  int fd;
+  while ((fd = accept(listener, NULL, NULL)) >= 0) {
+    WEB_CLIENT *c = NULL;
+    for (int i = 0; i < WEB_CLIENTS && !c; i++)
+      if (web[i].state == WEB_FREE) c = &web[i];
+    if (!c) {  // all slots busy
+      close(fd);
+      continue;
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    c->fd = fd;
+    c->state = WEB_HTTP;
+    c->authed = false;
+    c->rxLen = c->txLen = c->bodyLen = 0;
+    c->lastActive = webMillis();
+  }
+}
+
+// Send queued character events, one frame per run of the same type
+static void webBroadcast(bool listening) {
+  char run[64], type = 0;
+  int n = 0;
+  unsigned int head = __atomic_load_n(&evHead, __ATOMIC_ACQUIRE);
+  while (evTail != head || n) {
+    char t = 0, ch = 0;
+    if (evTail != head) {
+      t = evType[evTail % WEB_EVENTS];
+      ch = evChar[evTail % WEB_EVENTS];
+    }
+    if (n && (t != type || n == (int)sizeof(run) - 1)) {  // end of run
+      run[n] = 0;
+      char key[2] = {type, 0};
+      for (int i = 0; i < WEB_CLIENTS && listening; i++)
+        if (web[i].state == WEB_SOCKET) webJson(&web[i], key, run);
+      n = 0;
+    }
+    if (!t) break;
+    type = t;
+    run[n++] = ch;
+    __atomic_store_n(&evTail, evTail + 1, __ATOMIC_RELEASE);
+  }
+}
+
+static void webPushStatus(void) {
+  static char status[WEB_STATUS_LEN];
+  int n = snprintf(status, sizeof(status), "{\"status\":");
+  webStatus(status + n, sizeof(status) - n - 1);
+  strcat(status, "}");
+  if (!strcmp(status, lastStatus)) return;
+  strcpy(lastStatus, status);
+  for (int i = 0; i < WEB_CLIENTS; i++)
+    if (web[i].state == WEB_SOCKET) webFrame(&web[i], 1, status, strlen(status));
+}
+
+// Called regularly (every few mS).  Never blocks.
+void webPoll(void) {
+  bool listening = false;
+  unsigned long now = webMillis();
+  if (!webNetworkUp()) {
+    if (listener >= 0) webStop();
+    evTail = __atomic_load_n(&evHead, __ATOMIC_ACQUIRE);  // nobody to tell
+    return;
+  }
+  if (listener < 0 && !webListen()) return;
+  webAccept();
+  for (int i = 0; i < WEB_CLIENTS; i++) {
+    WEB_CLIENT *c = &web[i];
+    if (c->state == WEB_FREE) continue;
+    webRead(c);
+    if (c->state == WEB_HTTP && now - c->lastActive > WEB_IDLE_MS) webDrop(c);
+    if (c->state == WEB_SOCKET) listening = true;
+  }
+  webBroadcast(listening);
+  if (listening && now - lastStatusCheck >= WEB_STATUS_MS) {
+    lastStatusCheck = now;
+    webPushStatus();
+  }
+  for (int i = 0; i < WEB_CLIENTS; i++)
+    if (web[i].state != WEB_FREE) webFlush(&web[i]);
+}
+
+void webStop(void) {
+  for (int i = 0; i < WEB_CLIENTS; i++)
+    if (web[i].state != WEB_FREE) webDrop(&web[i]);
+  if (listener >= 0) close(listener);
+  listener = -1;
+}
+
+// Record a character for connected browsers.  Safe to call from the tutor
+// task at any rate; events are dropped if webPoll() falls behind.
+void webEvent(char type, char ch) {
+  unsigned int head = evHead;
+  if (head - __atomic_load_n(&evTail, __ATOMIC_ACQUIRE) >= WEB_EVENTS) return;
+  evType[head % WEB_EVENTS] = type;
+  evChar[head % WEB_EVENTS] = ch;
+  __atomic_store_n(&evHead, head + 1, __ATOMIC_RELEASE);
+}
+
+// Next character typed in a browser for the tutor to send, or 0
+char webText(void) {
+  unsigned int tail = textTail;
+  if (tail == __atomic_load_n(&textHead, __ATOMIC_ACQUIRE)) return 0;
+  char ch = textRing[tail % WEB_TEXT];
+  __atomic_store_n(&textTail, tail + 1, __ATOMIC_RELEASE);
+  return ch;
+}
@@ -0,0 +1,57 @@
+#ifndef _WEBSERVER_H_
+#define _WEBSERVER_H_
+
+// Portable: builds for the ESP32 (lwIP sockets) and for Linux (POSIX
+// sockets, see tools/webhost) so the protocol can be tested without hardware.
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "main.h"
+#endif
+
+//===================================  Web Server Constants
+//==============================
+// GET /        status page (WEB_PAGE)
+// GET /status  status as JSON
+// GET /ws      WebSocket.  The unit pushes {"o":"..."} characters it sent,
+//              {"i":"..."} characters keyed in, {"r":"..."} characters
+//              received from the room and {"status":{...}} when it changes.
+//              The browser sends "send:<text>", "auth:<mac>",
+//              "cli:<command>" and "mode:<menu selection>"; cli and mode
+//              need auth first and reply {"reply":"..."} or {"error":"..."}.
+//              The unit sends {"challenge":"<hex>"} on connecting and after
+//              each auth; <mac> is lowercase hex HMAC-SHA256(cli key,
+//              "web:<challenge>"), so the key never crosses the network.
+// All buffers are fixed; a client that cannot keep up is disconnected.
+#ifndef WEB_PORT
+#define WEB_PORT 80          // tools/webhost builds with 8080
+#endif
+#define WEB_CLIENTS 4        // simultaneous connections
+#define WEB_RX_BUF 512       // request headers or one WebSocket frame
+#define WEB_TX_BUF 1024      // output waiting for the socket
+#define WEB_EVENTS 256       // character events waiting for webPoll(); and
+#define WEB_TEXT 128         // browser text for the tutor: both powers of 2
+#define WEB_IDLE_MS 30000    // plain HTTP connections idle this long close
+#define WEB_STATUS_MS 1000   // how often status is checked for changes
+#define WEB_STATUS_LEN 256   // longest status JSON
+#define WEB_CHALLENGE_LEN 17 // hex challenge and terminator
+
+#define WEB_EV_OUT 'o'       // sounded by this unit
+#define WEB_EV_IN 'i'        // decoded from the key or paddles
+#define WEB_EV_RX 'r'        // received from the room
+
+// Function Prototypes
+void webPoll(void);
+void webStop(void);
+void webEvent(char type, char ch);
+char webText(void);
+
+// Supplied by the platform (webhooks.cpp on the tutor)
+bool webNetworkUp(void);
+unsigned long webMillis(void);
+void webStatus(char *json, int size);
+void webChallenge(char *challenge, int size);
+bool webAuthorize(const char *challenge, const char *mac);
+void webConfig(const char *command, char *reply, int size);
+bool webMode(int selection);
+
+#endif  // _WEBSERVER_H_
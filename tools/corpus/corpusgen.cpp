@@ -0,0 +1,282 @@
+/*
+
+  Builds the texts compiled into the tutor's flash (src/corpusdata.cpp) for
+  units without an SD card.  See src/corpus.h for the image layout.
+
+  Each file is read as the tutor reads SD texts (src/normalize.cpp) and
+  becomes one text, named after the file: gettysburg.txt is GETTYSBURG.  One Huffman
+  code is made for all of them from their character counts, limited to
+  CORPUS_MAX_BITS bits.  The image is then decoded again with the tutor's
+  own decoder (src/corpus.cpp) and compared with the input, and the
+  compression and decoding speed are reported.
+
+  Usage:
+    corpusgen [-o file] [-s chars] [-r rounds] file...
+
+  -o is the file to write (default ../../src/corpusdata.cpp), -s the
+  characters per sync table entry (default CORPUS_SYNC) and -r how many
+  times the whole image is decoded to time it (default 20).
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "corpus.h"
+#include "normalize.h"
+
+struct Text {
+  std::string file, name, chars;
+  long bytes = 0;  // size of the file as read
+};
+
+static bool readText(const char *path, Text *t) {
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  char out[NORM_MAX];
+  int c;
+  normReset();
+  while ((c = getc(f)) != EOF) {
+    t->chars.append(out, normByte(c, out));
+    t->bytes++;
+  }
+  t->chars.append(out, normEnd(out));
+  fclose(f);
+  if (normDropped)
+    printf("%s: %ld characters without Morse left out\n", path, normDropped);
+
+  t->file = path;
+  const char *base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+  for (const char *p = base; *p && *p != '.'; p++)
+    if ((int)t->name.size() < CORPUS_NAME_LEN - 1) t->name += toupper(*p);
+  return true;
+}
+
+// Huffman code lengths for the symbol counts, none over CORPUS_MAX_BITS.
+// If the tree is too deep the rare counts are raised and it is built again.
+static void codeLengths(std::vector<long> count, uint8_t *len) {
+  for (;;) {
+    struct Node {
+      long count;
+      int left, right;
+    };
+    std::vector<Node> nodes;
+    std::vector<int> live;
+    for (int s = 0; s < CORPUS_SYMBOLS; s++) {
+      len[s] = 0;
+      if (count[s]) {
+        live.push_back(nodes.size());
+        nodes.push_back({count[s], -1, s});
+      }
+    }
+    if (live.size() <= 1) {  // one symbol still needs one bit
+      if (!live.empty()) len[nodes[0].right] = 1;
+      return;
+    }
+    auto rarer = [&](int a, int b) { return nodes[a].count > nodes[b].count; };
+    std::make_heap(live.begin(), live.end(), rarer);
+    while (live.size() > 1) {  // join the two rarest
+      std::pop_heap(live.begin(), live.end(), rarer);
+      int a = live.back();
+      live.pop_back();
+      std::pop_heap(live.begin(), live.end(), rarer);
+      int b = live.back();
+      live.pop_back();
+      nodes.push_back({nodes[a].count + nodes[b].count, a, b});
+      live.push_back(nodes.size() - 1);
+      std::push_heap(live.begin(), live.end(), rarer);
+    }
+    int deepest = 0;
+    std::vector<std::pair<int, int>> stack = {{live[0], 0}};
+    while (!stack.empty()) {  // depth of every leaf
+      auto [n, depth] = stack.back();
+      stack.pop_back();
+      if (nodes[n].left < 0) {
+        len[nodes[n].right] = depth;
+        deepest = std::max(deepest, depth);
+      } else {
+        stack.push_back({nodes[n].left, depth + 1});
+        stack.push_back({nodes[n].right, depth + 1});
+      }
+    }
+    if (deepest <= CORPUS_MAX_BITS) return;
+    for (auto &c : count)
+      if (c) c = c / 2 + 1;
+  }
+}
+
+struct BitWriter {
+  std::vector<uint8_t> bytes;
+  uint32_t bits = 0;
+
+  void put(uint32_t code, int len) {  // most significant bit first
+    for (int i = len - 1; i >= 0; i--) {
+      if (bits % 8 == 0) bytes.push_back(0);
+      if ((code >> i) & 1) bytes.back() |= 0x80 >> (bits % 8);
+      bits++;
+    }
+  }
+};
+
+template <typename T>
+static void append(std::vector<uint8_t> &image, const T &v) {
+  const uint8_t *p = (const uint8_t *)&v;
+  image.insert(image.end(), p, p + sizeof(v));
+}
+
+static std::vector<uint8_t> buildImage(std::vector<Text> &texts, int every) {
+  std::vector<long> count(CORPUS_SYMBOLS, 0);
+  for (auto &t : texts)
+    for (unsigned char c : t.chars) count[corpusSymbol(c)]++;
+  uint8_t len[CORPUS_SYMBOLS];
+  codeLengths(count, len);
+
+  uint32_t codes[CORPUS_SYMBOLS], code = 0;
+  for (int l = 1; l <= CORPUS_MAX_BITS; l++) {  // canonical, as corpusOpen()
+    for (int s = 0; s < CORPUS_SYMBOLS; s++)
+      if (len[s] == l) codes[s] = code++;
+    code <<= 1;
+  }
+
+  BitWriter out;
+  std::vector<uint32_t> syncs;
+  std::vector<CORPUS_TEXT> table;
+  for (auto &t : texts) {
+    CORPUS_TEXT e;
+    memset(&e, 0, sizeof(e));
+    strncpy(e.name, t.name.c_str(), CORPUS_NAME_LEN - 1);
+    e.chars = t.chars.size();
+    e.sync = syncs.size();
+    for (size_t i = 0; i < t.chars.size(); i++) {
+      if (i % every == 0) syncs.push_back(out.bits);
+      int s = corpusSymbol((unsigned char)t.chars[i]);
+      out.put(codes[s], len[s]);
+    }
+    table.push_back(e);
+  }
+
+  std::vector<uint8_t> image;
+  CORPUS_HEADER h = {CORPUS_MAGIC, (uint32_t)texts.size(), (uint32_t)every,
+                     (uint32_t)syncs.size()};
+  append(image, h);
+  image.insert(image.end(), len, len + CORPUS_SYMBOLS);
+  for (auto &e : table) append(image, e);
+  for (auto s : syncs) append(image, s);
+  image.insert(image.end(), out.bytes.begin(), out.bytes.end());
+  image.insert(image.end(), 3, 0);  // the decoder reads three bytes at a time
+  return image;
+}
+
+static bool writeSource(const char *path, const std::vector<uint8_t> &image,
+                        const std::vector<Text> &texts, long chars) {
+  FILE *f = fopen(path, "w");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  fprintf(f, "/*\n\n  Texts built into the tutor for units without an SD card.\n\n"
+             "  Made by tools/corpus/corpusgen from:\n");
+  for (auto &t : texts)
+    fprintf(f, "    %s (%s, %zu characters)\n", t.file.c_str(), t.name.c_str(),
+            t.chars.size());
+  fprintf(f, "  Do not edit: change the texts and run it again.\n\n"
+             "  Software is licensed under a Creative Commons Attribution 4.0 "
+             "International\n  License.\n\n*/\n\n"
+             "#ifdef ARDUINO\n#include <Arduino.h>\n#include \"main.h\"\n"
+             "#endif\n#include <stdint.h>\n\n#include \"corpus.h\"\n\n");
+  fprintf(f, "// %ld characters in %zu bytes\nconst uint8_t corpusData[] = {",
+          chars, image.size());
+  for (size_t i = 0; i < image.size(); i++)
+    fprintf(f, "%s0x%02x,", i % 12 ? " " : "\n    ", image[i]);
+  fprintf(f, "\n};\n");
+  return fclose(f) == 0;
+}
+
+int main(int argc, char **argv) {
+  const char *outPath = "../../src/corpusdata.cpp";
+  int every = CORPUS_SYNC, rounds = 20, opt;
+  while ((opt = getopt(argc, argv, "o:s:r:")) != -1) {
+    switch (opt) {
+      case 'o':
+        outPath = optarg;
+        break;
+      case 's':
+        every = atoi(optarg);
+        break;
+      case 'r':
+        rounds = atoi(optarg);
+        break;
+      default:
+        optind = argc + 1;
+    }
+  }
+  if (argc - optind > CORPUS_TEXTS) {
+    fprintf(stderr, "corpusgen: at most %d texts\n", CORPUS_TEXTS);
+    return 2;
+  }
+  if (optind >= argc || every <= 0 || rounds <= 0) {
+    fprintf(stderr, "usage: corpusgen [-o file] [-s chars] [-r rounds] file...\n");
+    return 2;
+  }
+  std::vector<Text> texts;
+  long bytes = 0, chars = 0;
+  for (int i = optind; i < argc; i++) {
+    Text t;
+    if (!readText(argv[i], &t)) return 1;
+    bytes += t.bytes;
+    chars += t.chars.size();
+    texts.push_back(t);
+  }
+  std::vector<uint8_t> image = buildImage(texts, every);
+
+  if (!corpusOpen(image.data())) {
+    fprintf(stderr, "corpusgen: image not recognised\n");
+    return 1;
+  }
+  for (size_t i = 0; i < texts.size(); i++) {  // round trip
+    std::string back;
+    int c;
+    corpusStart(i, 0);
+    while ((c = corpusGet()) >= 0) back += (char)c;
+    if (back != texts[i].chars) {
+      fprintf(stderr, "corpusgen: %s does not decode as written\n",
+              texts[i].file.c_str());
+      return 1;
+    }
+  }
+  clock_t start = clock();
+  long decoded = 0;
+  for (int r = 0; r < rounds; r++)
+    for (size_t i = 0; i < texts.size(); i++) {
+      corpusStart(i, 0);
+      while (corpusGet() >= 0) decoded++;
+    }
+  double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  if (!writeSource(outPath, image, texts, chars)) return 1;
+  printf("%zu texts: %ld bytes read, %ld characters, %zu byte image "
+         "(%.2f bits per character, %.1f%% of the text read)\n",
+         texts.size(), bytes, chars, image.size(),
+         chars ? image.size() * 8.0 / chars : 0.0,
+         bytes ? image.size() * 100.0 / bytes : 0.0);
+  if (secs > 0)
+    printf("decoding: %.1f million characters per second on this computer\n",
+           decoded / secs / 1e6);
+  printf("written to %s\n", outPath);
+  return 0;
+}
@@ -0,0 +1,139 @@
+/*
+
+  Converts text files to pre-encoded Morse (.MRS) files for the tutor's SD
+  card, using the tutor's own code table (src/morse.cpp).
+
+  Text is read as the tutor reads it (src/normalize.cpp): UTF-8 quotes,
+  dashes and accented letters become plain ones, runs of white space become
+  one word space and letters between < and >, e.g. <BT> or <SK>, are sent as
+  one prosign.  Anything else has no Morse and is left out; the count is
+  reported for each file so nothing goes missing unnoticed.
+
+  Usage:
+    mrsconv [-o directory] [-w wpm] file...
+
+  Each file is written beside the original (or into -o directory) with its
+  extension changed to .MRS, and its playing time at -w WPM (default 20) is
+  shown.
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "morse.h"
+#include "mrs.h"
+#include "normalize.h"
+
+struct Output {
+  std::vector<uint8_t> data;      // records
+  std::vector<uint32_t> starts;   // data offset of every MRS_SEEK_EVERY'th
+  uint32_t chars = 0;
+  long units = 0;                 // playing time in dits
+
+  void add(char shown, int code) {
+    uint8_t rec[MRS_RECORD_MAX];
+    if (chars % MRS_SEEK_EVERY == 0) starts.push_back(data.size());
+    int n = mrsRecord(rec, shown, code);
+    data.insert(data.end(), rec, rec + n);
+    chars++;
+    if (shown == ' ') {
+      units += 4;  // 7 with the preceding character space
+      return;
+    }
+    int len = morseLength(code);
+    for (int i = 0; i < len; i++) units += ((code >> i) & 1) ? 1 : 3;
+    units += (len - 1) + 3;  // gaps inside, then character space
+  }
+
+  void text(const char *s, int n) {  // characters from the normalizer
+    for (int i = 0; i < n; i++) {
+      if ((uint8_t)s[i] >= NORM_PROSIGN)  // prosign without a character
+        add('*', normProsign(s[i]));
+      else
+        add(s[i], s[i] == ' ' ? 0 : morseCode(s[i]));
+    }
+  }
+};
+
+static std::string outPath(const char *in, const char *dir) {
+  std::string name = in;
+  size_t slash = name.rfind('/');
+  std::string base = slash == std::string::npos ? name : name.substr(slash + 1);
+  size_t dot = base.rfind('.');
+  if (dot != std::string::npos && dot) base = base.substr(0, dot);
+  base += MRS_EXT;
+  if (dir) return std::string(dir) + "/" + base;
+  return slash == std::string::npos ? base : name.substr(0, slash + 1) + base;
+}
+
+static bool convert(const char *in, const char *dir, int wpm) {
+  FILE *f = fopen(in, "rb");
+  if (!f) {
+    perror(in);
+    return false;
+  }
+  Output out;
+  char text[NORM_MAX];
+  int c;
+  normReset();
+  while ((c = getc(f)) != EOF) out.text(text, normByte(c, text));
+  out.text(text, normEnd(text));
+  fclose(f);
+  long dropped = normDropped;
+
+  std::string path = outPath(in, dir);
+  MRS_HEADER h = {MRS_MAGIC, out.chars, MRS_SEEK_EVERY,
+                  (uint32_t)out.starts.size()};
+  if (!h.seekCount) out.starts.push_back(0);  // empty text: one entry
+  h.seekCount = out.starts.size();
+  uint32_t base = sizeof(h) + h.seekCount * 4;
+  for (auto &s : out.starts) s += base;
+  FILE *o = fopen(path.c_str(), "wb");
+  if (!o || fwrite(&h, sizeof(h), 1, o) != 1 ||
+      fwrite(out.starts.data(), 4, h.seekCount, o) != h.seekCount ||
+      fwrite(out.data.data(), 1, out.data.size(), o) != out.data.size()) {
+    perror(path.c_str());
+    if (o) fclose(o);
+    return false;
+  }
+  fclose(o);
+  long secs = out.units * 12 / (10 * wpm);  // a dit is 1.2 / wpm seconds
+  printf("%s -> %s: %u characters, %zu bytes, %ld left out, %ld:%02ld:%02ld at "
+         "%d WPM\n",
+         in, path.c_str(), out.chars, base + out.data.size(), dropped,
+         secs / 3600, secs / 60 % 60, secs % 60, wpm);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  const char *dir = NULL;
+  int wpm = 20, opt, failed = 0;
+  while ((opt = getopt(argc, argv, "o:w:")) != -1) {
+    switch (opt) {
+      case 'o':
+        dir = optarg;
+        break;
+      case 'w':
+        wpm = atoi(optarg);
+        break;
+      default:
+        optind = argc + 1;
+    }
+  }
+  if (optind >= argc || wpm <= 0) {
+    fprintf(stderr, "usage: mrsconv [-o directory] [-w wpm] file...\n");
+    return 2;
+  }
+  for (int i = optind; i < argc; i++)
+    if (!convert(argv[i], dir, wpm)) failed++;
+  return failed ? 1 : 0;
+}
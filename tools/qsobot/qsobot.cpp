@@ -0,0 +1,645 @@
+/*
+
+  Practice-partner bot: stations that join tutor rooms over MQTT, answer CQ
+  calls and work a plausible QSO, using the same text generators as the
+  tutor's own QSO practice (src/content.cpp).
+
+  Each bot is a separate MQTT connection with its own id and callsign, so a
+  room sees it as another unit, and it keeps a heartbeat for the roster.  All
+  bots run from one thread and one epoll loop.  Every bot in a room receives
+  the room's traffic from the broker but only one of them, the room's lead,
+  decodes it; the others discard their copy, so the work done per character
+  does not grow with the number of bots.
+
+  An over ends after END_IDLE_MS of silence following K, KN, SK, BK or AR,
+  or after OVER_IDLE_MS of silence following anything else.  An idle bot
+  that hears "CQ ... DE <call>" waits a moment and answers unless another
+  station starts first.  It then sends the QSO exchange after the caller's
+  next over and signs off after the one after that.  With -c a bot also
+  calls CQ when its room has been quiet, so bots work each other and keep a
+  room busy.
+
+  Usage:
+    qsobot -s server [-p port] [-u user] [-w password] [-r room[,room...]]
+           [-n bots] [-W wpm | -W min-max] [-c seconds] [-v]
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <ctype.h>
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "content.h"
+
+//===================================  Bot Constants
+//=====================================
+#define MAX_BOTS 2000
+#define MAX_ROOMS 64
+#define ROOM_LEN 30             // as MAX_CHAR_STRING on the tutor
+#define SENDERS 16              // stations tracked per room
+#define LINE_LEN 400            // longest over remembered
+#define RX_BUF 1024
+#define TX_BUF 2048             // output waiting for the socket, per bot
+#define KEEPALIVE 60            // seconds, as PubSubClient
+#define HB_INTERVAL 60000       // mS between heartbeats, as presence.h
+#define END_IDLE_MS 1500        // silence after a prosign that ends an over
+#define OVER_IDLE_MS 5000       // silence that ends an over without one
+#define ANSWER_MIN 1000         // mS before answering a CQ
+#define ANSWER_MAX 4000
+#define REPLY_MIN 800           // mS before replying to an over
+#define REPLY_MAX 2500
+#define PARTNER_TIMEOUT 60000   // give up on a silent partner
+#define RECONNECT_MS 5000
+
+enum { BOT_IDLE, BOT_CALLING, BOT_PENDING, BOT_ANSWERED, BOT_EXCHANGED };
+
+typedef struct {
+  char id[4];                   // tutor's localid
+  char line[LINE_LEN];          // the over so far
+  int len;
+  unsigned long last;           // mS of last character, 0 = slot free
+  bool ended;                   // last word was K, KN, SK, BK or AR
+} SENDER;
+
+typedef struct {
+  char name[ROOM_LEN];
+  int lead;                     // bot that decodes this room, -1 = none
+  SENDER senders[SENDERS];
+  unsigned long lastChar;       // mS of last character heard from anyone
+  unsigned long lastCQ;         // mS a bot last called CQ here
+} ROOMSTATE;
+
+typedef struct {
+  int fd;                       // -1 = not connected
+  int room;
+  char id[4];
+  char call[CALL_LEN];
+  int charMs;                   // mS per character at this bot's speed
+  int state;
+  char partner[CALL_LEN];
+  char partnerId[4];
+  unsigned long since;          // mS state was entered
+  unsigned long due;            // mS of next character or action
+  char text[QSO_LEN];           // being sent
+  int pos;
+  int rxLen, txLen;
+  bool waitOut;                 // EPOLLOUT armed
+  unsigned char rx[RX_BUF];
+  unsigned char tx[TX_BUF];
+  unsigned long lastBeat, lastPing, joined;
+} BOT;
+
+BOT bots[MAX_BOTS];
+ROOMSTATE rooms[MAX_ROOMS];
+int botCount = 0, roomCount = 0;
+int epfd;
+struct sockaddr_storage broker;
+socklen_t brokerLen;
+const char *user = NULL, *password = NULL;
+int cqSeconds = 0;              // 0 = never call CQ
+bool verbose = false;
+volatile bool running = true;
+
+unsigned long statSent = 0, statOvers = 0, statQSOs = 0, statDrained = 0;
+
+long random(long lo, long hi) {  // for content.cpp, as Arduino's random()
+  return lo + rand() % (hi - lo);
+}
+
+static unsigned long now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000UL + ts.tv_nsec / 1000000;
+}
+
+//===================================  MQTT
+
+static int putString(unsigned char *p, const char *s, int len) {
+  p[0] = len >> 8;
+  p[1] = len & 0xFF;
+  memcpy(p + 2, s, len);
+  return len + 2;
+}
+
+// Fixed header + body into pkt; returns total length
+static int packet(unsigned char *pkt, int first, const unsigned char *body,
+                  int len) {
+  int n = 0, rem = len;
+  pkt[n++] = first;
+  do {
+    pkt[n] = rem % 128;
+    rem /= 128;
+    if (rem) pkt[n] |= 0x80;
+    n++;
+  } while (rem);
+  memcpy(pkt + n, body, len);
+  return n + len;
+}
+
+static void dropBot(int i);
+
+// Send what is queued for a bot.  Only asks for EPOLLOUT while backed up.
+static void flushBot(int i) {
+  BOT *b = &bots[i];
+  if (b->txLen) {
+    int n = send(b->fd, b->tx, b->txLen, MSG_DONTWAIT);
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+      dropBot(i);
+      return;
+    }
+    if (n > 0) {
+      memmove(b->tx, b->tx + n, b->txLen - n);
+      b->txLen -= n;
+    }
+  }
+  bool want = b->txLen > 0;
+  if (want != b->waitOut) {
+    struct epoll_event ev;
+    ev.events = EPOLLIN | (want ? (uint32_t)EPOLLOUT : 0);
+    ev.data.u32 = i;
+    epoll_ctl(epfd, EPOLL_CTL_MOD, b->fd, &ev);
+    b->waitOut = want;
+  }
+}
+
+// Packets are queued whole, so the broker never sees part of one.  A bot
+// that falls TX_BUF behind is dropped and reconnects.
+static void sendPacket(BOT *b, const unsigned char *pkt, int len) {
+  if (b->fd < 0) return;
+  if (b->txLen + len > TX_BUF) {
+    fprintf(stderr, "%s: broker not keeping up\n", b->call);
+    dropBot(b - bots);
+    return;
+  }
+  memcpy(b->tx + b->txLen, pkt, len);
+  b->txLen += len;
+  flushBot(b - bots);
+}
+
+static void publish(BOT *b, const char *topic, const char *msg, bool retain) {
+  unsigned char body[256], pkt[264];
+  int n = putString(body, topic, strlen(topic));
+  int len = strlen(msg);
+  if (n + len > (int)sizeof(body)) return;
+  memcpy(body + n, msg, len);
+  sendPacket(b, pkt, packet(pkt, 0x30 | (retain ? 1 : 0), body, n + len));
+}
+
+static void heartbeat(BOT *b, bool leaving) {
+  char topic[ROOM_LEN + 8], msg[24] = "";
+  snprintf(topic, sizeof(topic), "%s/hb/%s", rooms[b->room].name, b->id);
+  if (!leaving)
+    snprintf(msg, sizeof(msg), "%s,%lu", b->call, (now() - b->joined) / 60000);
+  publish(b, topic, msg, true);
+  b->lastBeat = now();
+}
+
+static bool connectBot(int i) {
+  BOT *b = &bots[i];
+  unsigned char body[300], pkt[310];
+  char will[ROOM_LEN + 8];
+  int n, one = 1;
+
+  b->fd = socket(broker.ss_family, SOCK_STREAM, 0);
+  if (b->fd < 0 || connect(b->fd, (struct sockaddr *)&broker, brokerLen)) {
+    if (b->fd >= 0) close(b->fd);
+    b->fd = -1;
+    return false;
+  }
+  setsockopt(b->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  struct epoll_event ev;
+  ev.events = EPOLLIN;
+  ev.data.u32 = i;
+  epoll_ctl(epfd, EPOLL_CTL_ADD, b->fd, &ev);
+  b->rxLen = b->txLen = 0;
+  b->waitOut = false;
+  snprintf(will, sizeof(will), "%s/hb/%s", rooms[b->room].name, b->id);
+  n = putString(body, "MQTT", 4);
+  body[n++] = 4;                                       // 3.1.1
+  body[n++] = 0x02 | 0x04 | 0x20 | (user ? 0x80 : 0) | // clean, will, retain
+              (password ? 0x40 : 0);
+  body[n++] = 0;
+  body[n++] = KEEPALIVE;
+  n += putString(body + n, b->id, strlen(b->id));
+  n += putString(body + n, will, strlen(will));
+  n += putString(body + n, "", 0);                     // will clears heartbeat
+  if (user) n += putString(body + n, user, strlen(user));
+  if (password) n += putString(body + n, password, strlen(password));
+  sendPacket(b, pkt, packet(pkt, 0x10, body, n));
+
+  n = 0;
+  body[n++] = 0;
+  body[n++] = 1;                                       // packet id
+  n += putString(body + n, rooms[b->room].name, strlen(rooms[b->room].name));
+  body[n++] = 0;                                       // QoS 0
+  sendPacket(b, pkt, packet(pkt, 0x82, body, n));
+
+  b->joined = b->lastPing = now();
+  heartbeat(b, false);
+  if (rooms[b->room].lead < 0) rooms[b->room].lead = i;
+  return true;
+}
+
+static void dropBot(int i) {
+  BOT *b = &bots[i];
+  ROOMSTATE *r = &rooms[b->room];
+  fprintf(stderr, "%s (%s): lost connection\n", b->call, b->id);
+  epoll_ctl(epfd, EPOLL_CTL_DEL, b->fd, NULL);
+  close(b->fd);
+  b->fd = -1;
+  b->state = BOT_IDLE;
+  b->pos = strlen(b->text);
+  b->due = now() + RECONNECT_MS;
+  if (r->lead == i) {  // hand decoding to another bot in the room
+    r->lead = -1;
+    for (int j = 0; j < botCount && r->lead < 0; j++)
+      if (bots[j].room == b->room && bots[j].fd >= 0) r->lead = j;
+  }
+}
+
+//===================================  Conversation
+
+static void say(BOT *b, const char *text, unsigned long start) {
+  snprintf(b->text, sizeof(b->text), "%s", text);
+  b->pos = 0;
+  b->due = start;
+}
+
+static bool sending(BOT *b) { return b->text[b->pos] != 0; }
+
+static void setState(BOT *b, int state) {
+  b->state = state;
+  b->since = now();
+}
+
+// Another bot in the room has already answered the CQ this bot waits on
+static bool answered(BOT *b) {
+  for (int i = 0; i < botCount; i++) {
+    BOT *o = &bots[i];
+    if (o != b && o->room == b->room && o->state >= BOT_ANSWERED &&
+        !strcmp(o->partnerId, b->partnerId) && o->since >= b->since)
+      return true;
+  }
+  return false;
+}
+
+// Word after the last "DE" in an over, or NULL
+static const char *callAfterDE(char *line, char *call) {
+  char *p = NULL, *q = line;
+  while ((q = strstr(q, "DE ")) != NULL) {
+    if (q == line || q[-1] == ' ') p = q + 3;
+    q += 3;
+  }
+  if (!p) return NULL;
+  int n = 0;
+  while (p[n] && p[n] != ' ' && n < CALL_LEN - 1) {
+    call[n] = p[n];
+    n++;
+  }
+  call[n] = 0;
+  return n ? call : NULL;
+}
+
+static bool hasWord(const char *line, const char *word) {
+  int len = strlen(word);
+  for (const char *p = strstr(line, word); p; p = strstr(p + 1, word))
+    if ((p == line || p[-1] == ' ') && (p[len] == ' ' || !p[len])) return true;
+  return false;
+}
+
+// A station in room r finished an over
+static void over(int r, SENDER *s) {
+  char caller[CALL_LEN], text[QSO_LEN];
+  s->line[s->len] = 0;
+  statOvers++;
+  if (verbose) printf("[%s] %s: %s\n", rooms[r].name, s->id, s->line);
+  bool de = callAfterDE(s->line, caller) != NULL;
+  bool cq = de && hasWord(s->line, "CQ");
+  bool sk = hasWord(s->line, "SK");
+
+  for (int i = 0; i < botCount; i++) {
+    BOT *b = &bots[i];
+    if (b->room != r || b->fd < 0 || !strcmp(b->id, s->id)) continue;
+    if (b->state != BOT_IDLE && b->state != BOT_CALLING &&
+        !strcmp(b->partnerId, s->id)) {
+      if (b->state == BOT_ANSWERED && !sk) {  // caller came back to us
+        qsoExchange(text, sizeof(text), b->partner, b->call);
+        say(b, text, now() + random(REPLY_MIN, REPLY_MAX));
+        setState(b, BOT_EXCHANGED);
+      } else if (b->state != BOT_PENDING) {   // their exchange or 73
+        qsoSignoff(text, sizeof(text), b->partner, b->call);
+        say(b, text, now() + random(REPLY_MIN, REPLY_MAX));
+        setState(b, BOT_IDLE);
+        statQSOs++;
+      }
+    } else if (b->state == BOT_PENDING && de && hasWord(s->line, b->partner)) {
+      setState(b, BOT_IDLE);  // someone else answered that CQ
+    } else if (b->state == BOT_CALLING && de && hasWord(s->line, b->call) &&
+               strcmp(caller, b->call)) {
+      strcpy(b->partner, caller);  // someone answered our CQ
+      strcpy(b->partnerId, s->id);
+      qsoExchange(text, sizeof(text), b->partner, b->call);
+      say(b, text, now() + random(REPLY_MIN, REPLY_MAX));
+      setState(b, BOT_EXCHANGED);
+    } else if (b->state == BOT_IDLE && cq && !sending(b) &&
+               strcmp(caller, b->call)) {
+      strcpy(b->partner, caller);  // answer after a pause, if still clear
+      strcpy(b->partnerId, s->id);
+      b->due = now() + random(ANSWER_MIN, ANSWER_MAX);
+      setState(b, BOT_PENDING);
+    }
+  }
+}
+
+// Characters decoded by a room's lead: "<id>:<c>" as sendWireless() sends
+static void heard(int r, const char *msg, int len) {
+  ROOMSTATE *room = &rooms[r];
+  SENDER *s = NULL, *oldest = &room->senders[0];
+  unsigned long t = now();
+  if (len < 3 || msg[len - 2] != ':') return;  // "Online" notices and such
+  char ch = toupper(msg[len - 1]);
+  int idLen = len - 2 < 3 ? len - 2 : 3;
+  room->lastChar = t;
+  for (int i = 0; i < SENDERS && !s; i++) {
+    SENDER *p = &room->senders[i];
+    if (p->last && !strncmp(p->id, msg, idLen) && !p->id[idLen]) s = p;
+    if (p->last < oldest->last) oldest = p;
+  }
+  if (!s) {  // new station: reuse the quietest slot
+    s = oldest;
+    memcpy(s->id, msg, idLen);
+    s->id[idLen] = 0;
+    s->len = 0;
+    s->ended = false;
+  }
+  s->last = t;
+  if (ch == ' ') {  // a K mid-over (as in sendQSO) is followed by more text
+    if (!s->len || s->line[s->len - 1] == ' ') return;
+    s->line[s->len] = 0;
+    char *word = strrchr(s->line, ' ');
+    word = word ? word + 1 : s->line;
+    s->ended = !strcmp(word, "K") || !strcmp(word, "KN") ||
+               !strcmp(word, "SK") || !strcmp(word, "BK") ||
+               !strcmp(word, "AR");
+  }
+  if (s->len < LINE_LEN - 1) s->line[s->len++] = ch;
+}
+
+static void readBot(int i) {
+  BOT *b = &bots[i];
+  bool lead = rooms[b->room].lead == i;
+  int n = recv(b->fd, b->rx + b->rxLen, sizeof(b->rx) - b->rxLen, 0);
+  if (n == 0 || (n < 0 && errno != EAGAIN)) {
+    dropBot(i);
+    return;
+  }
+  if (n < 0) return;
+  b->rxLen += n;
+  int pos = 0;
+  while (b->rxLen - pos >= 2) {
+    int len = 0, mult = 1, hdr = 1;
+    do {
+      if (pos + hdr >= b->rxLen) goto partial;
+      len += (b->rx[pos + hdr] & 0x7F) * mult;
+      mult *= 128;
+    } while ((b->rx[pos + hdr++] & 0x80) && hdr < 5);
+    if (hdr + len > RX_BUF) {
+      dropBot(i);
+      return;
+    }
+    if (pos + hdr + len > b->rxLen) break;
+    unsigned char *p = b->rx + pos;
+    if ((p[0] >> 4) == 3 && lead) {  // PUBLISH, QoS 0
+      int tlen = p[hdr] << 8 | p[hdr + 1];
+      const char *topic = (const char *)p + hdr + 2;
+      if (tlen == (int)strlen(rooms[b->room].name) &&
+          !strncmp(topic, rooms[b->room].name, tlen))
+        heard(b->room, topic + tlen, len - 2 - tlen);
+    } else if ((p[0] >> 4) == 3) {
+      statDrained++;
+    } else if ((p[0] >> 4) == 2 && len >= 2 && p[hdr + 1]) {
+      fprintf(stderr, "%s: broker refused connection (%d)\n", b->id,
+              p[hdr + 1]);
+      running = false;
+    }
+    pos += hdr + len;
+  }
+partial:
+  memmove(b->rx, b->rx + pos, b->rxLen - pos);
+  b->rxLen -= pos;
+}
+
+// Timers: characters going out, answers, CQs, timeouts, heartbeats
+static void tick(void) {
+  unsigned long t = now();
+  char text[QSO_LEN], msg[8];
+
+  for (int r = 0; r < roomCount; r++) {  // end overs on silence
+    for (int i = 0; i < SENDERS; i++) {
+      SENDER *s = &rooms[r].senders[i];
+      if (s->last && s->len &&
+          t - s->last > (s->ended ? END_IDLE_MS : OVER_IDLE_MS)) {
+        over(r, s);
+        s->len = 0;
+        s->ended = false;
+      }
+    }
+  }
+
+  for (int i = 0; i < botCount; i++) {
+    BOT *b = &bots[i];
+    ROOMSTATE *room = &rooms[b->room];
+    if (b->fd < 0) {
+      if ((long)(t - b->due) >= 0 && !connectBot(i)) b->due = t + RECONNECT_MS;
+      continue;
+    }
+    if (!sending(b)) {
+      if (b->state == BOT_PENDING && (long)(t - b->due) >= 0) {
+        if (answered(b)) {
+          setState(b, BOT_IDLE);  // another bot here got in first
+        } else {
+          qsoAnswer(text, sizeof(text), b->partner, b->call);
+          say(b, text, t);
+          setState(b, BOT_ANSWERED);
+        }
+      } else if (b->state != BOT_IDLE && b->state != BOT_PENDING &&
+                 t - b->since > PARTNER_TIMEOUT) {
+        setState(b, BOT_IDLE);
+      } else if (cqSeconds && b->state == BOT_IDLE &&
+                 t - room->lastChar > cqSeconds * 1000UL &&
+                 t - room->lastCQ > cqSeconds * 1000UL) {
+        qsoCQ(text, sizeof(text), b->call);
+        say(b, text, t);
+        setState(b, BOT_CALLING);
+        room->lastCQ = t;
+      }
+    }
+    while (sending(b) && (long)(t - b->due) >= 0) {
+      char ch = toupper(b->text[b->pos++]);
+      if (ch == ' ' && b->text[b->pos] == ' ') continue;  // 1 word space
+      snprintf(msg, sizeof(msg), "%s:%c", b->id, ch);
+      publish(b, room->name, msg, false);
+      room->lastChar = t;  // other bots here hear it without the round trip
+      statSent++;
+      b->due += b->charMs;
+    }
+    if (t - b->lastBeat > HB_INTERVAL) heartbeat(b, false);
+    if (t - b->lastPing > KEEPALIVE * 500UL) {
+      unsigned char ping[2] = {0xC0, 0};
+      sendPacket(b, ping, 2);
+      b->lastPing = t;
+    }
+  }
+}
+
+//===================================  Main
+
+static void stop(int) { running = false; }
+
+static bool uniqueId(const char *id) {
+  for (int i = 0; i < botCount; i++)
+    if (!strcmp(bots[i].id, id)) return false;
+  return true;
+}
+
+int main(int argc, char **argv) {
+  int opt, port = 1883, count = 1, wpmMin = 15, wpmMax = 15;
+  const char *server = NULL;
+  char roomList[256] = "QSO";
+  struct epoll_event events[64];
+  unsigned long lastStats;
+
+  while ((opt = getopt(argc, argv, "s:p:u:w:r:n:W:c:v")) != -1) {
+    switch (opt) {
+      case 's':
+        server = optarg;
+        break;
+      case 'p':
+        port = atoi(optarg);
+        break;
+      case 'u':
+        user = optarg;
+        break;
+      case 'w':
+        password = optarg;
+        break;
+      case 'r':
+        snprintf(roomList, sizeof(roomList), "%s", optarg);
+        break;
+      case 'n':
+        count = atoi(optarg);
+        break;
+      case 'W':
+        if (sscanf(optarg, "%d-%d", &wpmMin, &wpmMax) < 2) wpmMax = wpmMin;
+        break;
+      case 'c':
+        cqSeconds = atoi(optarg);
+        break;
+      case 'v':
+        verbose = true;
+        break;
+      default:
+        server = NULL;
+        optind = argc;
+    }
+  }
+  if (!server || count < 1 || count > MAX_BOTS || wpmMin < 5 ||
+      wpmMax < wpmMin || (user && strlen(user) > 64) ||
+      (password && strlen(password) > 64)) {
+    fprintf(stderr,
+            "usage: qsobot -s server [-p port] [-u user] [-w password] "
+            "[-r room[,room...]]\n              [-n bots (max %d)] "
+            "[-W wpm | -W min-max] [-c seconds] [-v]\n",
+            MAX_BOTS);
+    return 2;
+  }
+
+  struct addrinfo hints, *ai;
+  char service[8];
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_socktype = SOCK_STREAM;
+  snprintf(service, sizeof(service), "%d", port);
+  if (getaddrinfo(server, service, &hints, &ai)) {
+    fprintf(stderr, "qsobot: unknown server %s\n", server);
+    return 1;
+  }
+  memcpy(&broker, ai->ai_addr, ai->ai_addrlen);
+  brokerLen = ai->ai_addrlen;
+  freeaddrinfo(ai);
+
+  for (char *name = strtok(roomList, ","); name && roomCount < MAX_ROOMS;
+       name = strtok(NULL, ",")) {
+    snprintf(rooms[roomCount].name, ROOM_LEN, "%s", name);
+    rooms[roomCount++].lead = -1;
+  }
+
+  struct rlimit rl;  // one descriptor per bot
+  if (!getrlimit(RLIMIT_NOFILE, &rl)) {
+    rl.rlim_cur = rl.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &rl);
+  }
+  signal(SIGPIPE, SIG_IGN);
+  signal(SIGINT, stop);
+  signal(SIGTERM, stop);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  srand(time(NULL) ^ getpid());
+  epfd = epoll_create1(0);
+
+  for (botCount = 0; botCount < count;) {
+    BOT *b = &bots[botCount];
+    do {  // 3 letters like the tutor's localid, unique in this process
+      snprintf(b->id, sizeof(b->id), "%c%c%c", (char)random('A', 'Z' + 1),
+               (char)random('A', 'Z' + 1), (char)random('A', 'Z' + 1));
+    } while (!uniqueId(b->id));
+    randomCallsign(b->call);
+    b->room = botCount % roomCount;
+    b->charMs = 10000 / random(wpmMin, wpmMax + 1);  // PARIS: 50 dits a word
+    b->partnerId[0] = 0;
+    setState(b, BOT_IDLE);
+    botCount++;
+    if (!connectBot(botCount - 1)) {
+      fprintf(stderr, "qsobot: cannot reach %s:%d\n", server, port);
+      return 1;
+    }
+  }
+  printf("qsobot: %d bots in %d rooms\n", botCount, roomCount);
+
+  lastStats = now();
+  while (running) {
+    int n = epoll_wait(epfd, events, 64, 10);
+    for (int i = 0; i < n; i++) {
+      int b = events[i].data.u32;
+      if (bots[b].fd >= 0 && (events[i].events & ~EPOLLOUT)) readBot(b);
+      if (bots[b].fd >= 0 && (events[i].events & EPOLLOUT)) flushBot(b);
+    }
+    tick();
+    if (verbose && now() - lastStats >= 10000) {
+      printf("sent %lu chars, %lu overs heard, %lu QSOs, %lu copies skipped\n",
+             statSent, statOvers, statQSOs, statDrained);
+      lastStats = now();
+    }
+  }
+
+  for (int i = 0; i < botCount; i++) {  // clear heartbeats & say goodbye
+    unsigned char bye[2] = {0xE0, 0};
+    if (bots[i].fd < 0) continue;
+    heartbeat(&bots[i], true);
+    sendPacket(&bots[i], bye, 2);
+    close(bots[i].fd);
+  }
+  return 0;
+}
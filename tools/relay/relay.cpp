@@ -0,0 +1,896 @@
+/*
+
+  Room relay: a small MQTT 3.1.1 broker for Morse Tutor classrooms and clubs.
+
+  Speaks what PubSubClient uses (CONNECT with will, SUBSCRIBE, UNSUBSCRIBE,
+  PUBLISH at QoS 0, PINGREQ, DISCONNECT) plus retained messages, which the
+  tutor uses for heartbeats, the room directory and remote CLI challenges.
+
+  One thread, one epoll loop.  Messages are handled in arrival order and each
+  subscriber's output is a FIFO, so traffic within a room stays in order.
+  Every buffer is allocated once at start up.  Subscriptions and retained
+  messages are indexed by the first topic level (the room name), so a
+  publish or subscribe only looks at its own room.  Output for a subscriber is gathered for a
+  whole epoll round and sent with one system call.  A subscriber that falls
+  TX_BUF bytes behind loses messages (QoS 0) instead of slowing the room.
+
+  Usage:
+    relay [-p port] [-n max clients] [-a user:password] [-v]
+    relay -b [-h host] [-p port] [-a user:password] [-c clients] [-r rooms]
+          [-m msgs/sec] [-t seconds]    benchmark a running relay (or any broker)
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+//===================================  Relay Constants
+//===================================
+#define DEFAULT_PORT 1883
+#define DEFAULT_CLIENTS 5000   // connection slots allocated at start up
+#define MAX_PACKET 1024        // largest packet accepted; PubSubClient: 256
+#define TX_BUF 4096            // output queued per client
+#define MAX_TOPIC 96           // longest topic or filter
+#define SUBS_PER_CLIENT 16     // tutor uses about 8
+#define RETAIN_MAX 16384       // retained topics (two per tutor is typical)
+#define RETAIN_PAYLOAD 128     // longest retained payload kept
+#define BUCKETS 4096           // subscription index, power of 2
+#define EVENTS 256             // epoll events per wait
+#define KEEPALIVE_GRACE 1.5    // MQTT: drop after 1.5 x keepalive silence
+
+// MQTT control packet types (high nibble of first byte)
+#define CONNECT 1
+#define CONNACK 2
+#define PUBLISH 3
+#define PUBACK 4
+#define SUBSCRIBE 8
+#define SUBACK 9
+#define UNSUBSCRIBE 10
+#define UNSUBACK 11
+#define PINGREQ 12
+#define PINGRESP 13
+#define DISCONNECT 14
+
+typedef struct {
+  int fd;                  // -1 = slot free
+  bool connected;          // CONNECT accepted
+  bool dirty;              // on the flush list
+  bool waitOut;            // EPOLLOUT armed
+  unsigned short keepalive;
+  time_t lastIn;
+  unsigned long stamp;     // last publish delivered, avoids duplicates
+  int rxLen;
+  unsigned char rx[MAX_PACKET + 8];
+  int txHead, txLen;       // ring in tx[]
+  unsigned char *tx;
+  int subs[SUBS_PER_CLIENT];  // index into sub[], -1 = unused
+  bool hasWill, willRetain;
+  char willTopic[MAX_TOPIC];
+  unsigned char will[RETAIN_PAYLOAD];
+  int willLen;
+} CONN;
+
+typedef struct {
+  int conn;                // -1 = free
+  int next;                // next in bucket chain or free list
+  char filter[MAX_TOPIC];
+} SUB;
+
+typedef struct {
+  unsigned char state;     // 0 = empty, 1 = used, 2 = deleted
+  int next;                // next used topic with the same first level
+  char topic[MAX_TOPIC];
+  int len;
+  unsigned char payload[RETAIN_PAYLOAD];
+} RETAINED;
+
+CONN *conns;
+int maxConns = DEFAULT_CLIENTS;
+SUB *sub;
+int subFree = -1;
+int bucket[BUCKETS];       // first subscription for each room hash
+int wildHead = -1;         // filters starting with + or #
+RETAINED *retained;
+int retainBucket[BUCKETS]; // first retained topic for each room hash
+int *dirtyList, dirtyCount = 0;
+int epfd, listener;
+unsigned long pubStamp = 0;
+const char *auth = NULL;   // "user:password" required if set
+bool verbose = false;
+
+unsigned long statIn = 0, statOut = 0, statDrops = 0, statClients = 0;
+
+//===================================  Topics
+
+static unsigned int hashLevel(const char *s) {  // FNV-1a of the first level
+  unsigned int h = 2166136261u;
+  for (; *s && *s != '/'; s++) h = (h ^ (unsigned char)*s) * 16777619u;
+  return h;
+}
+
+static unsigned int hashTopic(const char *s) {
+  unsigned int h = 2166136261u;
+  for (; *s; s++) h = (h ^ (unsigned char)*s) * 16777619u;
+  return h;
+}
+
+// MQTT 3.1.1 section 4.7 matching of a topic against a filter
+static bool topicMatch(const char *filter, const char *topic) {
+  if ((*filter == '+' || *filter == '#') && *topic == '$') return false;
+  while (*filter) {
+    if (*filter == '#') return true;
+    if (*filter == '+') {
+      while (*topic && *topic != '/') topic++;
+      filter++;
+    } else {
+      while (*filter && *filter != '/') {
+        if (*filter++ != *topic++) return false;
+      }
+      if (*topic && *topic != '/') return false;
+    }
+    if (!*filter) return !*topic;
+    if (*topic != '/') return !strcmp(filter, "/#");  // "a/#" matches "a"
+    filter++;
+    topic++;
+  }
+  return !*topic;
+}
+
+//===================================  Output
+
+// A connection is on dirtyList exactly while its dirty flag is set, so the
+// list never holds more than maxConns entries
+static void markDirty(int c) {
+  if (conns[c].dirty) return;
+  conns[c].dirty = true;
+  dirtyList[dirtyCount++] = c;
+}
+
+// Queue bytes for a client.  False (and nothing queued) if they do not fit.
+static bool queue(int c, const unsigned char *data, int len) {
+  CONN *k = &conns[c];
+  if (k->txLen + len > TX_BUF) return false;
+  int tail = (k->txHead + k->txLen) % TX_BUF;
+  int first = TX_BUF - tail < len ? TX_BUF - tail : len;
+  memcpy(k->tx + tail, data, first);
+  memcpy(k->tx, data + first, len - first);
+  k->txLen += len;
+  markDirty(c);
+  return true;
+}
+
+static int putLength(unsigned char *p, int len) {  // remaining length varint
+  int n = 0;
+  do {
+    p[n] = len % 128;
+    len /= 128;
+    if (len) p[n] |= 0x80;
+    n++;
+  } while (len);
+  return n;
+}
+
+static int buildPublish(unsigned char *pkt, const char *topic,
+                        const unsigned char *payload, int len, bool retain) {
+  int tlen = strlen(topic), n = 0;
+  pkt[n++] = (PUBLISH << 4) | (retain ? 1 : 0);
+  n += putLength(pkt + n, 2 + tlen + len);
+  pkt[n++] = tlen >> 8;
+  pkt[n++] = tlen & 0xFF;
+  memcpy(pkt + n, topic, tlen);
+  n += tlen;
+  memcpy(pkt + n, payload, len);
+  return n + len;
+}
+
+static void closeConn(int c, bool clean);
+
+static void flushConn(int c) {
+  CONN *k = &conns[c];
+  struct iovec iov[2];
+  int cnt = 1;
+  k->dirty = false;
+  if (k->fd < 0 || !k->txLen) return;
+  int first = TX_BUF - k->txHead;
+  iov[0].iov_base = k->tx + k->txHead;
+  iov[0].iov_len = first < k->txLen ? first : k->txLen;
+  if (first < k->txLen) {  // ring wraps
+    iov[1].iov_base = k->tx;
+    iov[1].iov_len = k->txLen - first;
+    cnt = 2;
+  }
+  ssize_t n = writev(k->fd, iov, cnt);
+  if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+    closeConn(c, false);
+    return;
+  }
+  if (n > 0) {
+    k->txHead = (k->txHead + n) % TX_BUF;
+    k->txLen -= n;
+  }
+  bool want = k->txLen > 0;
+  if (want != k->waitOut) {  // only ask for EPOLLOUT while backed up
+    struct epoll_event ev;
+    ev.events = EPOLLIN | (want ? (uint32_t)EPOLLOUT : 0);
+    ev.data.u32 = c;
+    epoll_ctl(epfd, EPOLL_CTL_MOD, k->fd, &ev);
+    k->waitOut = want;
+  }
+}
+
+//===================================  Retained Messages
+
+static RETAINED *findRetained(const char *topic, bool create) {
+  unsigned int h = hashTopic(topic);
+  RETAINED *freeSlot = NULL;
+  for (int i = 0; i < RETAIN_MAX; i++) {
+    RETAINED *r = &retained[(h + i) % RETAIN_MAX];
+    if (r->state == 0) return create ? (freeSlot ? freeSlot : r) : NULL;
+    if (r->state == 2) {
+      if (!freeSlot) freeSlot = r;
+    } else if (!strcmp(r->topic, topic)) {
+      return r;
+    }
+  }
+  return create ? freeSlot : NULL;
+}
+
+// Used topics are also chained by first level, so a subscription to one room
+// only looks at that room's retained messages
+static void storeRetained(const char *topic, const unsigned char *payload,
+                          int len) {
+  bool keep = len > 0 && len <= RETAIN_PAYLOAD;
+  RETAINED *r = findRetained(topic, keep);
+  int *p = &retainBucket[hashLevel(topic) & (BUCKETS - 1)];
+  if (!keep) {  // empty clears the topic; so does one too big to keep,
+    if (!r) return;  // rather than leave the old value for new subscribers
+    while (*p != r - retained) p = &retained[*p].next;
+    *p = r->next;
+    r->state = 2;
+    return;
+  }
+  if (!r) return;  // store full
+  if (r->state != 1) {
+    r->next = *p;
+    *p = r - retained;
+  }
+  r->state = 1;
+  strcpy(r->topic, topic);
+  memcpy(r->payload, payload, len);
+  r->len = len;
+}
+
+static void sendOneRetained(int c, const char *filter, RETAINED *r) {
+  unsigned char pkt[MAX_TOPIC + RETAIN_PAYLOAD + 8];
+  if (r->state != 1 || !topicMatch(filter, r->topic)) return;
+  int n = buildPublish(pkt, r->topic, r->payload, r->len, true);
+  if (queue(c, pkt, n))
+    statOut++;
+  else
+    statDrops++;
+}
+
+// Only filters starting with + or # need to look at every retained topic
+static void sendRetained(int c, const char *filter) {
+  if (*filter == '+' || *filter == '#') {
+    for (int i = 0; i < RETAIN_MAX; i++)
+      sendOneRetained(c, filter, &retained[i]);
+    return;
+  }
+  for (int i = retainBucket[hashLevel(filter) & (BUCKETS - 1)]; i >= 0;
+       i = retained[i].next)
+    sendOneRetained(c, filter, &retained[i]);
+}
+
+//===================================  Publish and Subscribe
+
+static void deliverList(int head, const char *topic, const unsigned char *pkt,
+                        int len) {
+  for (int s = head; s >= 0; s = sub[s].next) {
+    CONN *k = &conns[sub[s].conn];
+    if (k->stamp == pubStamp || !topicMatch(sub[s].filter, topic)) continue;
+    k->stamp = pubStamp;
+    if (queue(sub[s].conn, pkt, len))
+      statOut++;
+    else
+      statDrops++;  // subscriber too far behind
+  }
+}
+
+static void publish(const char *topic, const unsigned char *payload, int len,
+                    bool retain) {
+  static unsigned char pkt[MAX_PACKET + 8];
+  statIn++;
+  if (retain) storeRetained(topic, payload, len);
+  int n = buildPublish(pkt, topic, payload, len, false);
+  pubStamp++;
+  deliverList(bucket[hashLevel(topic) & (BUCKETS - 1)], topic, pkt, n);
+  deliverList(wildHead, topic, pkt, n);
+}
+
+static bool isWild(const char *filter) {
+  return *filter == '+' || *filter == '#';
+}
+
+static int *headFor(const char *filter) {
+  return isWild(filter) ? &wildHead : &bucket[hashLevel(filter) & (BUCKETS - 1)];
+}
+
+static void unlinkSub(int s) {
+  int *p = headFor(sub[s].filter);
+  while (*p != s) p = &sub[*p].next;
+  *p = sub[s].next;
+  sub[s].conn = -1;
+  sub[s].next = subFree;
+  subFree = s;
+}
+
+// Returns false if the client already has SUBS_PER_CLIENT filters
+static bool addSub(int c, const char *filter) {
+  CONN *k = &conns[c];
+  int slot = -1;
+  for (int i = 0; i < SUBS_PER_CLIENT; i++) {
+    if (k->subs[i] < 0) {
+      if (slot < 0) slot = i;
+    } else if (!strcmp(sub[k->subs[i]].filter, filter)) {
+      return true;  // already subscribed
+    }
+  }
+  if (slot < 0 || subFree < 0) return false;
+  int s = subFree;
+  subFree = sub[s].next;
+  sub[s].conn = c;
+  strcpy(sub[s].filter, filter);
+  int *head = headFor(filter);
+  sub[s].next = *head;
+  *head = s;
+  k->subs[slot] = s;
+  return true;
+}
+
+static void removeSub(int c, const char *filter) {
+  CONN *k = &conns[c];
+  for (int i = 0; i < SUBS_PER_CLIENT; i++) {
+    if (k->subs[i] >= 0 && !strcmp(sub[k->subs[i]].filter, filter)) {
+      unlinkSub(k->subs[i]);
+      k->subs[i] = -1;
+    }
+  }
+}
+
+//===================================  Connections
+
+static void closeConn(int c, bool clean) {
+  CONN *k = &conns[c];
+  if (k->fd < 0) return;
+  epoll_ctl(epfd, EPOLL_CTL_DEL, k->fd, NULL);
+  close(k->fd);
+  k->fd = -1;
+  for (int i = 0; i < SUBS_PER_CLIENT; i++) {
+    if (k->subs[i] >= 0) unlinkSub(k->subs[i]);
+    k->subs[i] = -1;
+  }
+  if (k->connected) statClients--;
+  if (k->connected && !clean && k->hasWill)  // tutor's heartbeat last will
+    publish(k->willTopic, k->will, k->willLen, k->willRetain);
+  k->connected = false;
+}
+
+static void acceptConns(void) {
+  int fd, one = 1;
+  while ((fd = accept4(listener, NULL, NULL, SOCK_NONBLOCK)) >= 0) {
+    int c = -1;
+    for (int i = 0; i < maxConns && c < 0; i++)
+      if (conns[i].fd < 0) c = i;  // accepts are rare next to publishes
+    if (c < 0) {
+      close(fd);
+      continue;
+    }
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    CONN *k = &conns[c];
+    k->fd = fd;
+    k->connected = k->waitOut = k->hasWill = false;  // dirty: still listed
+    k->rxLen = k->txHead = k->txLen = 0;
+    k->keepalive = 0;
+    k->lastIn = time(NULL);
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.u32 = c;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev);
+  }
+}
+
+//===================================  Packets
+
+// Read a length-prefixed string at *p, leaving it NUL terminated in out
+static bool getString(unsigned char **p, unsigned char *end, char *out,
+                      int size) {
+  if (end - *p < 2) return false;
+  int len = (*p)[0] << 8 | (*p)[1];
+  *p += 2;
+  if (len >= size || end - *p < len) return false;
+  memcpy(out, *p, len);
+  out[len] = 0;
+  *p += len;
+  return true;
+}
+
+// Read length-prefixed binary data at *p into out, setting *len
+static bool getBytes(unsigned char **p, unsigned char *end, unsigned char *out,
+                     int size, int *len) {
+  if (end - *p < 2) return false;
+  *len = (*p)[0] << 8 | (*p)[1];
+  *p += 2;
+  if (*len > size || end - *p < *len) return false;
+  memcpy(out, *p, *len);
+  *p += *len;
+  return true;
+}
+
+static bool doConnect(int c, unsigned char *p, unsigned char *end) {
+  CONN *k = &conns[c];
+  char proto[8], id[64], user[64] = "", pass[64] = "";
+  unsigned char ack[4] = {CONNACK << 4, 2, 0, 0};
+  if (!getString(&p, end, proto, sizeof(proto)) || end - p < 4) return false;
+  int flags = p[1];
+  k->keepalive = p[2] << 8 | p[3];
+  p += 4;
+  if (!getString(&p, end, id, sizeof(id))) return false;
+  k->hasWill = flags & 0x04;
+  if (k->hasWill) {
+    if (!getString(&p, end, k->willTopic, sizeof(k->willTopic)) ||
+        !getBytes(&p, end, k->will, sizeof(k->will), &k->willLen))
+      return false;
+    k->willRetain = flags & 0x20;
+  }
+  if ((flags & 0x80) && !getString(&p, end, user, sizeof(user))) return false;
+  if ((flags & 0x40) && !getString(&p, end, pass, sizeof(pass))) return false;
+  if (auth) {
+    char given[130];
+    snprintf(given, sizeof(given), "%s:%s", user, pass);
+    if (strcmp(given, auth)) ack[3] = 4;  // bad user name or password
+  }
+  queue(c, ack, sizeof(ack));
+  if (ack[3]) return false;
+  k->connected = true;
+  statClients++;
+  if (verbose) printf("connect %s (%d)\n", id, c);
+  return true;
+}
+
+static bool doPublish(int c, int flags, unsigned char *p, unsigned char *end) {
+  char topic[MAX_TOPIC];
+  int qos = (flags >> 1) & 3;
+  if (!getString(&p, end, topic, sizeof(topic))) return false;
+  if (qos) {  // accept QoS 1 but deliver at QoS 0
+    if (end - p < 2) return false;
+    unsigned char ack[4] = {PUBACK << 4, 2, p[0], p[1]};
+    queue(c, ack, sizeof(ack));
+    p += 2;
+  }
+  if (strchr(topic, '+') || strchr(topic, '#')) return false;
+  publish(topic, p, end - p, flags & 1);
+  return true;
+}
+
+static bool doSubscribe(int c, int type, unsigned char *p, unsigned char *end) {
+  unsigned char ack[4 + SUBS_PER_CLIENT * 4];
+  char filter[MAX_TOPIC];
+  unsigned char *first = p + 2;
+  int n = 4;
+  if (end - p < 2) return false;
+  ack[2] = p[0];  // packet id
+  ack[3] = p[1];
+  for (p = first; p < end;) {
+    if (!getString(&p, end, filter, sizeof(filter))) return false;
+    if (type == SUBSCRIBE) {
+      if (p++ >= end) return false;  // requested QoS; we grant 0
+      if (n < (int)sizeof(ack)) ack[n++] = addSub(c, filter) ? 0 : 0x80;
+    } else {
+      removeSub(c, filter);
+    }
+  }
+  ack[0] = (type == SUBSCRIBE ? SUBACK : UNSUBACK) << 4;
+  ack[1] = n - 2;
+  queue(c, ack, n);
+  p = first;
+  for (int i = 4; type == SUBSCRIBE && p < end; p++, i++) {  // after SUBACK,
+    getString(&p, end, filter, sizeof(filter));  // only for accepted filters
+    if (i < n && !ack[i]) sendRetained(c, filter);
+  }
+  return true;
+}
+
+// Handle one complete packet.  False closes the connection.
+static bool packet(int c, unsigned char *p, int len, int hdr) {
+  int type = p[0] >> 4, flags = p[0] & 0x0F;
+  unsigned char *body = p + hdr, *end = p + len;
+  CONN *k = &conns[c];
+  if (!k->connected && type != CONNECT) return false;
+  switch (type) {
+    case CONNECT:
+      return !k->connected && doConnect(c, body, end);
+    case PUBLISH:
+      return doPublish(c, flags, body, end);
+    case SUBSCRIBE:
+    case UNSUBSCRIBE:
+      return doSubscribe(c, type, body, end);
+    case PINGREQ: {
+      unsigned char resp[2] = {PINGRESP << 4, 0};
+      queue(c, resp, sizeof(resp));
+      return true;
+    }
+    case DISCONNECT:
+      k->hasWill = false;  // clean goodbye: no last will
+      return false;
+    default:
+      return true;  // PUBACK etc. for QoS we never send
+  }
+}
+
+static void readConn(int c) {
+  CONN *k = &conns[c];
+  int n = recv(k->fd, k->rx + k->rxLen, sizeof(k->rx) - k->rxLen, 0);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+    closeConn(c, false);
+    return;
+  }
+  if (n < 0) return;
+  k->rxLen += n;
+  k->lastIn = time(NULL);
+
+  int pos = 0;
+  while (k->rxLen - pos >= 2) {
+    int len = 0, mult = 1, hdr = 1;
+    do {  // remaining length varint
+      if (pos + hdr >= k->rxLen) goto partial;
+      len += (k->rx[pos + hdr] & 0x7F) * mult;
+      mult *= 128;
+    } while ((k->rx[pos + hdr++] & 0x80) && hdr < 5);
+    if (len + hdr > MAX_PACKET) {
+      closeConn(c, false);
+      return;
+    }
+    if (pos + hdr + len > k->rxLen) break;
+    if (!packet(c, k->rx + pos, hdr + len, hdr)) {
+      flushConn(c);  // CONNACK refusal goes out first
+      closeConn(c, k->connected && !k->hasWill);
+      return;
+    }
+    pos += hdr + len;
+  }
+partial:
+  memmove(k->rx, k->rx + pos, k->rxLen - pos);
+  k->rxLen -= pos;
+}
+
+static void checkKeepalive(void) {
+  time_t now = time(NULL);
+  for (int c = 0; c < maxConns; c++) {
+    CONN *k = &conns[c];
+    if (k->fd < 0) continue;
+    if ((k->keepalive && now - k->lastIn > k->keepalive * KEEPALIVE_GRACE) ||
+        (!k->connected && now - k->lastIn > 10))
+      closeConn(c, false);
+  }
+}
+
+static int runRelay(int port) {
+  struct sockaddr_in addr;
+  struct epoll_event ev, events[EVENTS];
+  int one = 1;
+  time_t lastCheck = time(NULL), lastStats = lastCheck;
+
+  conns = (CONN *)calloc(maxConns, sizeof(CONN));
+  unsigned char *txPool = (unsigned char *)malloc((size_t)maxConns * TX_BUF);
+  sub = (SUB *)calloc((size_t)maxConns * SUBS_PER_CLIENT, sizeof(SUB));
+  retained = (RETAINED *)calloc(RETAIN_MAX, sizeof(RETAINED));
+  dirtyList = (int *)malloc(maxConns * sizeof(int));
+  if (!conns || !txPool || !sub || !retained || !dirtyList) {
+    fprintf(stderr, "relay: not enough memory for %d clients\n", maxConns);
+    return 1;
+  }
+  for (int c = 0; c < maxConns; c++) {
+    conns[c].fd = -1;
+    conns[c].tx = txPool + (size_t)c * TX_BUF;
+    for (int i = 0; i < SUBS_PER_CLIENT; i++) conns[c].subs[i] = -1;
+  }
+  for (int s = maxConns * SUBS_PER_CLIENT - 1; s >= 0; s--) {
+    sub[s].conn = -1;
+    sub[s].next = subFree;
+    subFree = s;
+  }
+  for (int b = 0; b < BUCKETS; b++) bucket[b] = retainBucket[b] = -1;
+
+  listener = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+  setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(listener, (struct sockaddr *)&addr, sizeof(addr)) ||
+      listen(listener, 1024)) {
+    perror("relay: bind");
+    return 1;
+  }
+  epfd = epoll_create1(0);
+  ev.events = EPOLLIN;
+  ev.data.u32 = 0xFFFFFFFF;  // listener
+  epoll_ctl(epfd, EPOLL_CTL_ADD, listener, &ev);
+  printf("relay: port %d, %d clients, %lu MB\n", port, maxConns,
+         ((size_t)maxConns * (sizeof(CONN) + TX_BUF +
+                              SUBS_PER_CLIENT * sizeof(SUB)) +
+          RETAIN_MAX * sizeof(RETAINED)) >> 20);
+
+  for (;;) {
+    int n = epoll_wait(epfd, events, EVENTS, 1000);
+    for (int i = 0; i < n; i++) {
+      unsigned int c = events[i].data.u32;
+      if (c == 0xFFFFFFFF) {
+        acceptConns();
+        continue;
+      }
+      if (conns[c].fd < 0) continue;  // closed earlier this round
+      if (events[i].events & (EPOLLERR | EPOLLHUP))
+        closeConn(c, false);
+      else if (events[i].events & EPOLLIN)
+        readConn(c);
+      if (conns[c].fd >= 0 && (events[i].events & EPOLLOUT)) markDirty(c);
+    }
+    time_t now = time(NULL);
+    if (now != lastCheck) {
+      lastCheck = now;
+      checkKeepalive();
+    }
+    // Taken off the list before flushing: a failed write closes the client
+    // and its will can mark clients flushed earlier this round dirty again
+    while (dirtyCount) flushConn(dirtyList[--dirtyCount]);
+    if (verbose && now - lastStats >= 10) {
+      printf("clients %lu  in %lu  out %lu  dropped %lu\n", statClients,
+             statIn, statOut, statDrops);
+      lastStats = now;
+    }
+  }
+}
+
+//===================================  Benchmark
+// Connects many simulated tutors spread over rooms, has each type tutor
+// character messages ("<id>:<c>") into its room at a steady rate and counts
+// what comes back.  Run against a relay started separately.
+
+typedef struct {
+  int fd;
+  int rxLen;
+  unsigned char rx[2048];
+  char id[8];
+  int room;
+} BENCH;
+
+static double seconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Count PUBLISH packets in what arrived; returns how many
+static long benchRead(BENCH *b) {
+  long count = 0;
+  int n;
+  while ((n = recv(b->fd, b->rx + b->rxLen, sizeof(b->rx) - b->rxLen, 0)) > 0) {
+    b->rxLen += n;
+    int pos = 0;
+    while (b->rxLen - pos >= 2) {
+      int len = 0, mult = 1, hdr = 1;
+      do {
+        if (pos + hdr >= b->rxLen) goto partial;
+        len += (b->rx[pos + hdr] & 0x7F) * mult;
+        mult *= 128;
+      } while (b->rx[pos + hdr++] & 0x80);
+      if (pos + hdr + len > b->rxLen) break;
+      if ((b->rx[pos] >> 4) == PUBLISH) count++;
+      pos += hdr + len;
+    }
+  partial:
+    memmove(b->rx, b->rx + pos, b->rxLen - pos);
+    b->rxLen -= pos;
+  }
+  return count;
+}
+
+static int benchPacket(unsigned char *pkt, int type, const char *a,
+                       const char *b) {
+  unsigned char body[256];
+  int n = 0, la = strlen(a), lb = b ? strlen(b) : 0;
+  if (type == CONNECT) {  // protocol, level 4, clean session, keepalive 60
+    memcpy(body, "\0\4MQTT\4\2\0\74", 10);
+    n = 10;
+    body[n++] = la >> 8;
+    body[n++] = la;
+    memcpy(body + n, a, la);
+    n += la;
+    const char *colon = auth && strlen(auth) < 200 ? strchr(auth, ':') : NULL;
+    if (colon) {  // -a user:password given: log in with it
+      int lu = colon - auth, lp = strlen(colon + 1);
+      body[7] |= 0xC0;
+      body[n++] = lu >> 8;
+      body[n++] = lu;
+      memcpy(body + n, auth, lu);
+      n += lu;
+      body[n++] = lp >> 8;
+      body[n++] = lp;
+      memcpy(body + n, colon + 1, lp);
+      n += lp;
+    }
+  } else if (type == SUBSCRIBE) {
+    body[n++] = 0;
+    body[n++] = 1;
+    body[n++] = la >> 8;
+    body[n++] = la;
+    memcpy(body + n, a, la);
+    n += la;
+    body[n++] = 0;
+  } else {  // PUBLISH topic a, payload b
+    body[n++] = la >> 8;
+    body[n++] = la;
+    memcpy(body + n, a, la);
+    n += la;
+    memcpy(body + n, b, lb);
+    n += lb;
+  }
+  int h = 0;
+  pkt[h++] = (type << 4) | (type == SUBSCRIBE ? 2 : 0);
+  h += putLength(pkt + h, n);
+  memcpy(pkt + h, body, n);
+  return h + n;
+}
+
+static int runBench(const char *host, int port, int clients, int rooms,
+                    double rate, int duration) {
+  struct sockaddr_in addr;
+  unsigned char pkt[300];
+  char topic[32], msg[16];
+  BENCH *b = (BENCH *)calloc(clients, sizeof(BENCH));
+  int ep = epoll_create1(0), one = 1;
+  long sent = 0, received = 0, skipped = 0;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) {
+    fprintf(stderr, "bench: bad address %s\n", host);
+    return 1;
+  }
+  for (int i = 0; i < clients; i++) {
+    b[i].fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (b[i].fd < 0 ||
+        connect(b[i].fd, (struct sockaddr *)&addr, sizeof(addr))) {
+      fprintf(stderr, "bench: connect %d failed: %s\n", i, strerror(errno));
+      return 1;
+    }
+    setsockopt(b[i].fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    snprintf(b[i].id, sizeof(b[i].id), "%c%c%c", 'A' + i % 26,
+             'A' + i / 26 % 26, 'A' + i / 676 % 26);
+    b[i].room = i % rooms;
+    snprintf(topic, sizeof(topic), "bench%d", b[i].room);
+    int n = benchPacket(pkt, CONNECT, b[i].id, NULL);
+    n += benchPacket(pkt + n, SUBSCRIBE, topic, NULL);
+    if (send(b[i].fd, pkt, n, 0) != n) return 1;
+    fcntl(b[i].fd, F_SETFL, O_NONBLOCK);
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.u32 = i;
+    epoll_ctl(ep, EPOLL_CTL_ADD, b[i].fd, &ev);
+  }
+  printf("bench: %d clients in %d rooms, %.1f msgs/sec each, %d seconds\n",
+         clients, rooms, rate, duration);
+  usleep(500000);  // let CONNACK and SUBACK arrive
+  for (int i = 0; i < clients; i++) benchRead(&b[i]);
+
+  double start = seconds(), due = start, step = 1.0 / (rate * clients);
+  int next = 0;
+  struct epoll_event events[EVENTS];
+  while (seconds() - start < duration) {
+    double now = seconds();
+    while (due <= now) {  // spread sends evenly over all clients
+      BENCH *s = &b[next];
+      snprintf(topic, sizeof(topic), "bench%d", s->room);
+      snprintf(msg, sizeof(msg), "%s:%c", s->id, 'A' + (int)(sent % 26));
+      int n = benchPacket(pkt, PUBLISH, topic, msg);
+      if (send(s->fd, pkt, n, MSG_DONTWAIT) == n)
+        sent++;
+      else
+        skipped++;
+      next = (next + 1) % clients;
+      due += step;
+    }
+    int n = epoll_wait(ep, events, EVENTS, 1);
+    for (int i = 0; i < n; i++) received += benchRead(&b[events[i].data.u32]);
+  }
+  double elapsed = seconds() - start;
+  usleep(500000);  // collect stragglers
+  for (int i = 0; i < clients; i++) received += benchRead(&b[i]);
+
+  double fanout = (double)clients / rooms;
+  printf("published %ld (%.0f/sec), delivered %ld (%.0f/sec), skipped %ld\n",
+         sent, sent / elapsed, received, received / elapsed, skipped);
+  printf("expected deliveries %.0f, delivered %.1f%%\n", sent * fanout,
+         sent ? 100.0 * received / (sent * fanout) : 0.0);
+  return 0;
+}
+
+//===================================  Main
+
+int main(int argc, char **argv) {
+  int opt, port = DEFAULT_PORT, clients = 1000, rooms = 50, duration = 10;
+  double rate = 2.0;  // characters per second per unit: a fast typist
+  const char *host = "127.0.0.1";
+  bool bench = false;
+
+  while ((opt = getopt(argc, argv, "p:n:a:vbh:c:r:m:t:")) != -1) {
+    switch (opt) {
+      case 'p':
+        port = atoi(optarg);
+        break;
+      case 'n':
+        maxConns = atoi(optarg);
+        break;
+      case 'a':
+        auth = optarg;
+        break;
+      case 'v':
+        verbose = true;
+        break;
+      case 'b':
+        bench = true;
+        break;
+      case 'h':
+        host = optarg;
+        break;
+      case 'c':
+        clients = atoi(optarg);
+        break;
+      case 'r':
+        rooms = atoi(optarg);
+        break;
+      case 'm':
+        rate = atof(optarg);
+        break;
+      case 't':
+        duration = atoi(optarg);
+        break;
+      default:
+        fprintf(stderr,
+                "usage: relay [-p port] [-n clients] [-a user:pass] [-v]\n"
+                "       relay -b [-h host] [-p port] [-a user:pass] [-c clients] "
+                "[-r rooms] [-m msgs/sec] [-t seconds]\n");
+        return 2;
+    }
+  }
+  if (maxConns < 1 || clients < 1 || rooms < 1 || rate <= 0) return 2;
+
+  struct rlimit rl;  // one descriptor per unit
+  if (!getrlimit(RLIMIT_NOFILE, &rl)) {
+    rl.rlim_cur = rl.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &rl);
+  }
+  signal(SIGPIPE, SIG_IGN);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  if (bench) return runBench(host, port, clients, rooms, rate, duration);
+  return runRelay(port);
+}
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Run CLI commands on Morse Tutors over MQTT.
+
+Each unit must have a remote CLI key set with the serial 'K' command.
+Usage:
+    remote_cli.py -s broker -k KEY VE3OOI-a1b2c3 "R CLUBROOM" "S"
+    remote_cli.py -s broker -k KEY -f units.txt "W S NEWWIFI" "W P secret" "S"
+
+Device names are "<call>-<mac>" as shown in telemetry topics.  Commands run
+in order on each unit; the script stops on a unit at the first ERR.
+
+Software is licensed under a Creative Commons Attribution 4.0 International
+License.
+"""
+
+import argparse
+import hashlib
+import hmac
+import queue
+import sys
+
+import paho.mqtt.client as mqtt
+
+TIMEOUT = 10  # seconds to wait for the challenge and each reply
+
+
+def run_unit(client, replies, key, dev, commands):
+    replies.queue.clear()
+    client.subscribe("cmd/%s/challenge" % dev)
+    client.subscribe("cmd/%s/reply" % dev)
+    try:
+        topic, challenge = replies.get(timeout=TIMEOUT)
+        while not topic.endswith("/challenge"):
+            topic, challenge = replies.get(timeout=TIMEOUT)
+    except queue.Empty:
+        print("%s: no challenge, unit offline or no key set" % dev)
+        return False
+
+    ok = True
+    for seq, command in enumerate(commands, 1):
+        signed = "%s:%d:%s" % (challenge, seq, command)
+        mac = hmac.new(key.encode(), signed.encode(), hashlib.sha256).hexdigest()
+        client.publish("cmd/%s" % dev, "%d %s %s" % (seq, mac, command))
+        print("%s> %s" % (dev, command))
+        while True:
+            try:
+                topic, text = replies.get(timeout=TIMEOUT)
+            except queue.Empty:
+                print("%s: no reply" % dev)
+                return False
+            if not topic.endswith("/reply"):
+                continue
+            rseq, _, text = text.partition(" ")
+            if rseq != str(seq):
+                continue
+            if text == "OK":
+                break
+            if text.startswith("ERR"):
+                print("%s: %s" % (dev, text))
+                ok = False
+                break
+            sys.stdout.write(text)
+        if not ok:
+            break
+    client.unsubscribe("cmd/%s/challenge" % dev)
+    client.unsubscribe("cmd/%s/reply" % dev)
+    return ok
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument("-s", "--server", required=True)
+    p.add_argument("-p", "--port", type=int, default=1883)
+    p.add_argument("-u", "--user")
+    p.add_argument("-w", "--password")
+    p.add_argument("-k", "--key", required=True, help="remote CLI key")
+    p.add_argument("-f", "--file", help="file of device names, one per line")
+    p.add_argument("device", nargs="?", help="single device name")
+    p.add_argument("commands", nargs="+")
+    args = p.parse_args()
+
+    if args.file:
+        if args.device:
+            args.commands.insert(0, args.device)
+        with open(args.file) as f:
+            devices = [line.strip() for line in f if line.strip()]
+    elif args.device:
+        devices = [args.device]
+    else:
+        p.error("give a device name or --file")
+
+    replies = queue.Queue()
+    client = mqtt.Client()
+    if args.user:
+        client.username_pw_set(args.user, args.password)
+    client.on_message = lambda c, u, m: replies.put(
+        (m.topic, m.payload.decode(errors="replace")))
+    client.connect(args.server, args.port)
+    client.loop_start()
+
+    failed = [d for d in devices
+              if not run_unit(client, replies, args.key, d, args.commands)]
+    client.loop_stop()
+    if failed:
+        print("Failed: " + " ".join(failed))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
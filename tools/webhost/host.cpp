@@ -0,0 +1,99 @@
+/*
+
+  Linux test harness for src/webserver.cpp.
+
+  Serves the tutor's status page and WebSocket on port 8080.  Lines typed on
+  stdin are pushed to browsers as characters sent; a line starting with '>'
+  is pushed as received from the room.  Text, CLI commands and mode changes
+  from the browser are printed.  The CLI key is "testkey1"; checking it
+  needs OpenSSL (libssl-dev).
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <fcntl.h>
+#include <openssl/hmac.h>
+#include <openssl/sha.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "webserver.h"
+
+static int mode = -1;
+static int wpm = 13;
+
+bool webNetworkUp(void) { return true; }
+
+unsigned long webMillis(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000UL + ts.tv_nsec / 1000000;
+}
+
+void webStatus(char *json, int size) {
+  snprintf(json, size,
+           "{\"call\":\"W8BH\",\"room\":\"test\",\"wpm\":%d,\"mode\":%d,"
+           "\"connected\":true}",
+           wpm, mode);
+}
+
+void webChallenge(char *challenge, int size) {
+  int i;
+  for (i = 0; i < size - 1; i++)
+    challenge[i] = "0123456789abcdef"[rand() & 15];
+  challenge[i] = 0;
+}
+
+bool webAuthorize(const char *challenge, const char *mac) {
+  static const char key[] = "testkey1";
+  char text[WEB_CHALLENGE_LEN + 8], hex[2 * SHA256_DIGEST_LENGTH + 1];
+  unsigned char digest[SHA256_DIGEST_LENGTH];
+  int n = snprintf(text, sizeof(text), "web:%s", challenge);
+  HMAC(EVP_sha256(), key, strlen(key), (unsigned char *)text, n, digest, NULL);
+  for (int i = 0; i < SHA256_DIGEST_LENGTH; i++)
+    sprintf(hex + 2 * i, "%02x", digest[i]);
+  return !strcmp(mac, hex);
+}
+
+void webConfig(const char *command, char *reply, int size) {
+  printf("cli: %s\n", command);
+  snprintf(reply, size, "Current: W8BH\nran \"%s\"\n", command);
+}
+
+bool webMode(int selection) {
+  if (selection < -1 || selection > 28) return false;
+  printf("mode: %d\n", selection);
+  mode = selection;
+  return true;
+}
+
+int main(void) {
+  char line[128];
+  int n = 0;
+  fcntl(0, F_SETFL, O_NONBLOCK);
+  srand(time(NULL));  // challenges
+  printf("http://localhost:%d/\n", WEB_PORT);
+  for (;;) {
+    char ch;
+    while (read(0, &ch, 1) == 1) {
+      if (ch != '\n') {
+        if (n < (int)sizeof(line) - 1) line[n++] = ch;
+        continue;
+      }
+      line[n] = 0;
+      char type = (line[0] == '>') ? WEB_EV_RX : WEB_EV_OUT;
+      for (char *p = line + (type == WEB_EV_RX); *p; p++) webEvent(type, *p);
+      webEvent(type, ' ');
+      n = 0;
+    }
+    while ((ch = webText())) putchar(ch);
+    fflush(stdout);
+    webPoll();
+    usleep(10000);  // same cadence as the tutor's network task
+  }
+}
@@ -0,0 +1,307 @@
+/*
+
+  Builds frequency-weighted word lists for the tutor (see src/wordlist.h):
+  a WORDS.MTW file for the SD card or flash store, or with -c the list built
+  into the firmware (src/worddata.cpp).
+
+  Each input line is a word, optionally followed by how often it is used,
+  e.g. "THE 69971".  Lines without a count are weighted by their place in
+  the file, as in a list sorted by frequency (the n'th word is used 1/n as
+  often as the first).  Words are read as the tutor reads texts
+  (src/normalize.cpp); those with characters that have no Morse, or longer
+  than WORDLIST_LEN - 1, are left out.  A word given twice has its counts
+  added.
+
+  The alias table is built with integer arithmetic (Vose's method), then
+  drawn from a million times to show that the most common words come up as
+  often as they should.  Words are then tagged with the Koch characters
+  they use and sorted by Koch level, and the number playable at each lesson
+  is shown.
+
+  Usage:
+    wordgen [-o file] [-c] file...
+
+  -o is the file to write (default WORDS.MTW, or ../../src/worddata.cpp with
+  -c).
+
+  Software is licensed under a Creative Commons Attribution 4.0 International
+  License.
+
+*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "normalize.h"
+#include "wordlist.h"
+
+static_assert(sizeof(KOCH_ORDER) - 1 == WORDLIST_LEVELS, "KOCH_ORDER length");
+
+#define ZIPF_TOP 1000000ULL  // weight of the first word of a list without counts
+
+struct Word {
+  std::string text;
+  unsigned long long count;
+};
+
+static bool readList(const char *path, std::vector<Word> &list,
+                     std::map<std::string, size_t> &seen, long *dropped,
+                     long *ranked) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  char line[256], word[256];
+  unsigned long long count, rank = 0;
+  while (fgets(line, sizeof(line), f)) {
+    int fields = sscanf(line, "%255s %llu", word, &count);
+    if (fields < 1 || word[0] == '#') continue;
+    if (fields < 2) {
+      count = ZIPF_TOP / ++rank;
+      (*ranked)++;
+    }
+    std::string text;
+    char out[NORM_MAX];
+    normReset();
+    for (char *p = word; *p; p++) text.append(out, normByte((uint8_t)*p, out));
+    text.append(out, normEnd(out));
+    bool ok = !normDropped && !text.empty() && text.size() < WORDLIST_LEN;
+    for (unsigned char c : text)
+      if (c <= ' ' || c >= NORM_PROSIGN) ok = false;  // one plain word
+    if (!ok || !count) {
+      (*dropped)++;
+      continue;
+    }
+    auto it = seen.find(text);
+    if (it != seen.end()) {
+      list[it->second].count += count;
+    } else {
+      seen[text] = list.size();
+      list.push_back({text, count});
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+// Vose's alias method in integers: word i's share of n draws is
+// count[i] * n / total, compared against "total" for one whole draw
+static std::vector<WORDLIST_ALIAS> aliasTable(const std::vector<Word> &list) {
+  size_t n = list.size();
+  unsigned long long total = 0;
+  for (auto &w : list) total += w.count;
+  std::vector<unsigned __int128> share(n);
+  std::vector<size_t> small, large;
+  for (size_t i = 0; i < n; i++) {
+    share[i] = (unsigned __int128)list[i].count * n;
+    (share[i] < total ? small : large).push_back(i);
+  }
+  std::vector<WORDLIST_ALIAS> table(n);
+  while (!small.empty() && !large.empty()) {
+    size_t s = small.back(), l = large.back();
+    small.pop_back();
+    table[s].cut = (uint16_t)(share[s] * WORDLIST_ONE / total);
+    table[s].alias = l;
+    share[l] -= total - share[s];  // l fills the rest of s's draw
+    if (share[l] < total) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  for (size_t i : small) table[i] = {(uint16_t)(WORDLIST_ONE - 1), (uint16_t)i};
+  for (size_t i : large) table[i] = {(uint16_t)(WORDLIST_ONE - 1), (uint16_t)i};
+  return table;
+}
+
+template <typename T>
+static void append(std::vector<uint8_t> &image, const T &v) {
+  const uint8_t *p = (const uint8_t *)&v;
+  image.insert(image.end(), p, p + sizeof(v));
+}
+
+// Koch characters a word uses, one bit each; false if it has any other
+static bool kochMask(const std::string &text, uint64_t *mask, int *level) {
+  static const char order[] = KOCH_ORDER;
+  *mask = 0;
+  *level = -1;
+  for (char c : text) {
+    const char *p = strchr(order, toupper((unsigned char)c));
+    if (!p) return false;
+    int i = p - order;
+    *mask |= 1ULL << i;
+    if (i > *level) *level = i;
+  }
+  return *level >= 0;
+}
+
+// The Koch index: level starts, then tags sorted by level, word order kept
+// within a level (so more common words come first)
+static std::vector<uint8_t> kochIndex(const std::vector<Word> &list) {
+  std::vector<std::vector<WORDLIST_KOCH>> levels(WORDLIST_LEVELS);
+  for (size_t i = 0; i < list.size(); i++) {
+    uint64_t mask;
+    int level;
+    if (!kochMask(list[i].text, &mask, &level)) continue;
+    levels[level].push_back(
+        {(uint32_t)mask, (uint16_t)(mask >> 32), (uint16_t)i});
+  }
+  std::vector<uint8_t> index;
+  uint16_t start = 0;
+  for (int n = 0; n <= WORDLIST_LEVELS; n++) {
+    append(index, start);
+    if (n < WORDLIST_LEVELS) start += levels[n].size();
+  }
+  for (auto &level : levels)
+    for (auto &k : level) append(index, k);
+  return index;
+}
+
+static std::vector<uint8_t> buildImage(const std::vector<Word> &list,
+                                       const std::vector<WORDLIST_ALIAS> &table,
+                                       const std::vector<uint8_t> &koch) {
+  std::vector<uint8_t> image;
+  WORDLIST_HEADER h = {WORDLIST_MAGIC, (uint32_t)list.size(), 0, 0};
+  h.koch = sizeof(h) + list.size() * (sizeof(WORDLIST_ALIAS) + 4);
+  h.text = h.koch + koch.size();
+  append(image, h);
+  for (auto &a : table) append(image, a);
+  uint32_t offset = 0;
+  for (auto &w : list) {
+    append(image, offset);
+    offset += w.text.size() + 1;
+  }
+  image.insert(image.end(), koch.begin(), koch.end());
+  for (auto &w : list) image.insert(image.end(), w.text.c_str(), w.text.c_str() + w.text.size() + 1);
+  image.insert(image.end(), WORDLIST_LEN, 0);
+  return image;
+}
+
+static void checkDraws(const std::vector<Word> &list,
+                       const std::vector<WORDLIST_ALIAS> &table) {
+  const long draws = 1000000;
+  std::vector<long> got(list.size(), 0);
+  unsigned long long total = 0;
+  for (auto &w : list) total += w.count;
+  srandom(1);
+  for (long d = 0; d < draws; d++) {  // as wordListPick()
+    size_t i = random() % list.size();
+    if (random() % WORDLIST_ONE >= table[i].cut) i = table[i].alias;
+    got[i]++;
+  }
+  std::vector<size_t> order(list.size());
+  for (size_t i = 0; i < order.size(); i++) order[i] = i;
+  std::sort(order.begin(), order.end(),
+            [&](size_t a, size_t b) { return list[a].count > list[b].count; });
+  printf("most common of %ld draws:  expected  drawn\n", draws);
+  for (size_t k = 0; k < order.size() && k < 8; k++) {
+    size_t i = order[k];
+    printf("  %-16s %8.0f %8ld\n", list[i].text.c_str(),
+           (double)list[i].count * draws / total, got[i]);
+  }
+}
+
+// Words playable at each lesson, as wordListKochCount()
+static void showKoch(const std::vector<uint8_t> &koch) {
+  static const char order[] = KOCH_ORDER;
+  const uint16_t *start = (const uint16_t *)koch.data();
+  printf("words playable at each Koch lesson:\n");
+  for (int n = 1; n < WORDLIST_LEVELS; n++)
+    printf("  %2d %c %5u%s", n, order[n], start[n + 1], n % 5 ? "" : "\n");
+  printf("\n");
+}
+
+static bool writeSource(const char *path, const std::vector<uint8_t> &image,
+                        long words, bool ranked, int inputs, char **names) {
+  FILE *f = fopen(path, "w");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  if (ranked)  // say so: these weights are a guess, not measured
+    fprintf(f, "/*\n\n  Practice words built into the tutor, weighted by "
+               "rank.  The list has no\n  counts, so the n'th word is taken "
+               "to be used 1/n as often as the first.\n\n");
+  else
+    fprintf(f, "/*\n\n  Practice words built into the tutor, weighted by "
+               "use.\n\n");
+  fprintf(f, "  Made by tools/words/wordgen -c from:\n");
+  for (int i = 0; i < inputs; i++) fprintf(f, "    %s\n", names[i]);
+  fprintf(f, "  Do not edit: change the list and run it again.\n\n"
+             "  Software is licensed under a Creative Commons Attribution 4.0 "
+             "International\n  License.\n\n*/\n\n"
+             "#ifdef ARDUINO\n#include <Arduino.h>\n#include \"main.h\"\n"
+             "#endif\n#include <stdint.h>\n\n#include \"wordlist.h\"\n\n");
+  fprintf(f, "// %ld words in %zu bytes\nconst uint8_t wordListData[] = {", words,
+          image.size());
+  for (size_t i = 0; i < image.size(); i++)
+    fprintf(f, "%s0x%02x,", i % 12 ? " " : "\n    ", image[i]);
+  fprintf(f, "\n};\n");
+  return fclose(f) == 0;
+}
+
+int main(int argc, char **argv) {
+  const char *outPath = NULL;
+  bool source = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "o:c")) != -1) {
+    switch (opt) {
+      case 'o':
+        outPath = optarg;
+        break;
+      case 'c':
+        source = true;
+        break;
+      default:
+        optind = argc + 1;
+    }
+  }
+  if (optind >= argc) {
+    fprintf(stderr, "usage: wordgen [-o file] [-c] file...\n");
+    return 2;
+  }
+  if (!outPath) outPath = source ? "../../src/worddata.cpp" : "WORDS.MTW";
+
+  std::vector<Word> list;
+  std::map<std::string, size_t> seen;
+  long dropped = 0, ranked = 0;
+  for (int i = optind; i < argc; i++)
+    if (!readList(argv[i], list, seen, &dropped, &ranked)) return 1;
+  if (list.empty() || list.size() > WORDLIST_MAX) {
+    fprintf(stderr, "wordgen: %zu words; a list holds 1 to %d\n", list.size(),
+            WORDLIST_MAX);
+    return 1;
+  }
+  std::vector<WORDLIST_ALIAS> table = aliasTable(list);
+  std::vector<uint8_t> koch = kochIndex(list);
+  std::vector<uint8_t> image = buildImage(list, table, koch);
+
+  bool ok;
+  if (source) {
+    ok = writeSource(outPath, image, list.size(), ranked > 0, argc - optind,
+                     argv + optind);
+  } else {
+    FILE *f = fopen(outPath, "wb");
+    ok = f && fwrite(image.data(), 1, image.size(), f) == image.size();
+    if (f && fclose(f)) ok = false;
+    if (!ok) perror(outPath);
+  }
+  if (!ok) return 1;
+  printf("%zu words (%ld left out) in %zu bytes, %.1f per word: %s\n",
+         list.size(), dropped, image.size(), (double)image.size() / list.size(),
+         outPath);
+  if (ranked)
+    printf("%ld words had no count and were weighted by their place\n",
+           ranked);
+  checkDraws(list, table);
+  showKoch(koch);
+  return 0;
+}